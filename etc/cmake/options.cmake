@@ -211,6 +211,11 @@ if(OT_EXTERNAL_HEAP)
     target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE=1")
 endif()
 
+option(OT_HDLC_FCS_SLICE_BY_8 "enable slice-by-8 FCS calculation in the HDLC-lite encoder/decoder")
+if(OT_HDLC_FCS_SLICE_BY_8)
+    target_compile_definitions(ot-config INTERFACE "OPENTHREAD_HDLC_CONFIG_FCS_SLICE_BY_8_ENABLE=1")
+endif()
+
 option(OT_HISTORY_TRACKER "enable history tracker support")
 if(OT_HISTORY_TRACKER)
     target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE=1")
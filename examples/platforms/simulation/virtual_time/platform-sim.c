@@ -46,6 +46,7 @@
 #include <stdlib.h>
 #include <syslog.h>
 
+#include <openthread/logging.h>
 #include <openthread/tasklet.h>
 #include <openthread/platform/alarm-milli.h>
 
@@ -277,6 +278,10 @@ void otSysProcessDrivers(otInstance *aInstance)
         exit(0);
     }
 
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    otLoggingProcessBinaryLogs();
+#endif
+
     FD_ZERO(&read_fds);
     FD_ZERO(&write_fds);
     FD_ZERO(&error_fds);
@@ -96,6 +96,18 @@ typedef struct otDnsQueryConfig
     otDnsNat64Mode     mNat64Mode;       ///< Allow/Disallow NAT64 address translation during address resolution.
 } otDnsQueryConfig;
 
+/**
+ * This structure represents the DNS client cache counters.
+ *
+ */
+typedef struct otDnsCacheCounters
+{
+    uint32_t mHits;         ///< Number of lookups served from a cached response.
+    uint32_t mNegativeHits; ///< Number of lookups served from a cached negative response (included in `mHits`).
+    uint32_t mMisses;       ///< Number of lookups with no unexpired cached response.
+    uint32_t mEvictions;    ///< Number of unexpired responses evicted to make room for a new response.
+} otDnsCacheCounters;
+
 /**
  * This function gets the current default query config used by DNS client.
  *
@@ -136,6 +148,38 @@ const otDnsQueryConfig *otDnsClientGetDefaultConfig(otInstance *aInstance);
  */
 void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *aConfig);
 
+/**
+ * This function gets the DNS client cache counters.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the DNS client cache counters.
+ *
+ */
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the DNS client cache counters.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientResetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function removes all responses from the DNS client cache.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientClearCache(otInstance *aInstance);
+
 /**
  * This type is an opaque representation of a response to an address resolution DNS query.
  *
@@ -207,6 +251,31 @@ otError otDnsClientResolveAddress(otInstance *            aInstance,
                                   void *                  aContext,
                                   const otDnsQueryConfig *aConfig);
 
+/**
+ * This function looks up a cached response to an address resolution query for a given host name.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` is enabled.
+ *
+ * Responses received for `otDnsClientResolveAddress()` queries (including negative responses) are cached until the
+ * smallest TTL of their records expires. On a cache hit, @p aCallback is invoked with the cached response before this
+ * function returns, the same way it is invoked for a response received from the server, and the TTLs read from the
+ * response are reduced by the time spent in the cache. No query is sent on a cache miss, so the caller can then use
+ * `otDnsClientResolveAddress()`.
+ *
+ * @param[in]  aInstance        A pointer to an OpenThread instance.
+ * @param[in]  aHostName        The host name to look up (MUST NOT be NULL).
+ * @param[in]  aCallback        A function pointer that shall be called with the cached response.
+ * @param[in]  aContext         A pointer to arbitrary context information.
+ *
+ * @retval OT_ERROR_NONE        A cached response was found and reported through @p aCallback.
+ * @retval OT_ERROR_NOT_FOUND   There is no unexpired cached response for @p aHostName.
+ *
+ */
+otError otDnsClientLookupAddress(otInstance *         aInstance,
+                                 const char *         aHostName,
+                                 otDnsAddressCallback aCallback,
+                                 void *               aContext);
+
 /**
  * This function gets the full host name associated with an address resolution DNS response.
  *
@@ -319,6 +388,30 @@ otError otDnsClientBrowse(otInstance *            aInstance,
                           void *                  aContext,
                           const otDnsQueryConfig *aConfig);
 
+/**
+ * This function looks up a cached response to a DNS browse (service instance enumeration) query for a given service
+ * name.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE` and
+ * `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` are enabled.
+ *
+ * On a cache hit, @p aCallback is invoked with the cached response before this function returns. No query is sent on
+ * a cache miss (see `otDnsClientLookupAddress()`).
+ *
+ * @param[in]  aInstance        A pointer to an OpenThread instance.
+ * @param[in]  aServiceName     The service name to look up (MUST NOT be NULL).
+ * @param[in]  aCallback        A function pointer that shall be called with the cached response.
+ * @param[in]  aContext         A pointer to arbitrary context information.
+ *
+ * @retval OT_ERROR_NONE        A cached response was found and reported through @p aCallback.
+ * @retval OT_ERROR_NOT_FOUND   There is no unexpired cached response for @p aServiceName.
+ *
+ */
+otError otDnsClientLookupBrowse(otInstance *        aInstance,
+                                const char *        aServiceName,
+                                otDnsBrowseCallback aCallback,
+                                void *              aContext);
+
 /**
  * This function gets the service name associated with a DNS browse (service instance enumeration) response.
  *
@@ -474,6 +567,32 @@ otError otDnsClientResolveService(otInstance *            aInstance,
                                   void *                  aContext,
                                   const otDnsQueryConfig *aConfig);
 
+/**
+ * This function looks up a cached response to a DNS service instance resolution query for a given service instance.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE` and
+ * `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE` are enabled.
+ *
+ * On a cache hit, @p aCallback is invoked with the cached response before this function returns. No query is sent on
+ * a cache miss (see `otDnsClientLookupAddress()`).
+ *
+ * @param[in]  aInstance          A pointer to an OpenThread instance.
+ * @param[in]  aInstanceLabel     The service instance label.
+ * @param[in]  aServiceName       The service name (together with @p aInstanceLabel form full instance name).
+ * @param[in]  aCallback          A function pointer that shall be called with the cached response.
+ * @param[in]  aContext           A pointer to arbitrary context information.
+ *
+ * @retval OT_ERROR_NONE          A cached response was found and reported through @p aCallback.
+ * @retval OT_ERROR_NOT_FOUND     There is no unexpired cached response for the service instance.
+ * @retval OT_ERROR_INVALID_ARGS  @p aInstanceLabel is NULL.
+ *
+ */
+otError otDnsClientLookupService(otInstance *         aInstance,
+                                 const char *         aInstanceLabel,
+                                 const char *         aServiceName,
+                                 otDnsServiceCallback aCallback,
+                                 void *               aContext);
+
 /**
  * This function gets the service instance name associated with a DNS service instance resolution response.
  *
@@ -53,7 +53,7 @@ extern "C" {
  * @note This number versions both OpenThread platform and user APIs.
  *
  */
-#define OPENTHREAD_API_VERSION (162)
+#define OPENTHREAD_API_VERSION (172)
 
 /**
  * @addtogroup api-instance
@@ -238,6 +238,57 @@ otError otSetStateChangedCallback(otInstance *aInstance, otStateChangedCallback
  */
 void otRemoveStateChangeCallback(otInstance *aInstance, otStateChangedCallback aCallback, void *aContext);
 
+/**
+ * This structure represents the statistics of a core module handling `Notifier` events.
+ *
+ */
+typedef struct otNotifierHandlerStats
+{
+    const char *mName;      ///< The module name.
+    uint32_t    mCalls;     ///< Number of times the module handler was invoked.
+    uint32_t    mSkips;     ///< Number of emissions skipped since none of the events were of interest to the module.
+    uint64_t    mTotalTime; ///< Total time spent in the module handler (in microseconds).
+    uint32_t    mMaxTime;   ///< Longest single invocation of the module handler (in microseconds).
+} otNotifierHandlerStats;
+
+/**
+ * This function gets the statistics of a core module handling state changes.
+ *
+ * This function requires `OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aIndex     The module index (starting from zero).
+ * @param[out] aStats     A pointer to an `otNotifierHandlerStats` to output the statistics.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the statistics.
+ * @retval OT_ERROR_NOT_FOUND  @p aIndex is beyond the last module.
+ *
+ */
+otError otInstanceGetNotifierHandlerStats(otInstance *aInstance, uint8_t aIndex, otNotifierHandlerStats *aStats);
+
+/**
+ * This function gets the number of state change emissions which included a given flag.
+ *
+ * This function requires `OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aFlag      A single `OT_CHANGED_*` flag.
+ *
+ * @returns The number of emissions which included @p aFlag.
+ *
+ */
+uint32_t otInstanceGetNotifierEventCount(otInstance *aInstance, otChangedFlags aFlag);
+
+/**
+ * This function resets the state change statistics.
+ *
+ * This function requires `OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otInstanceResetNotifierStats(otInstance *aInstance);
+
 /**
  * This method triggers a platform reset.
  *
@@ -35,6 +35,9 @@
 #ifndef OPENTHREAD_LOGGING_H_
 #define OPENTHREAD_LOGGING_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <openthread/error.h>
 #include <openthread/platform/logging.h>
 
@@ -76,6 +79,46 @@ otLogLevel otLoggingGetLevel(void);
  */
 otError otLoggingSetLevel(otLogLevel aLogLevel);
 
+/**
+ * This function formats all the pending deferred log lines and passes them to `otPlatLog()`.
+ *
+ * The platform calls this function from a context where the formatting cost is acceptable (e.g., from its main loop).
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ */
+void otLoggingProcessBinaryLogs(void);
+
+/**
+ * This function reads and formats the oldest pending deferred log line.
+ *
+ * This function can be called from a different thread than the one running OpenThread (e.g., a logging thread), as
+ * long as all the calls are made from the same thread. The formatted log line does not include the
+ * `OPENTHREAD_CONFIG_LOG_SUFFIX` and is truncated to fit in @p aLogLine.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * @param[out]  aLogLevel   A pointer to output the log level.
+ * @param[out]  aLogRegion  A pointer to output the log region.
+ * @param[out]  aLogLine    A pointer to a buffer to output the formatted log line as a null-terminated string.
+ * @param[in]   aSize       The size of @p aLogLine.
+ *
+ * @retval TRUE   Successfully read a log line.
+ * @retval FALSE  There is no pending log line.
+ *
+ */
+bool otLoggingReadBinaryLog(otLogLevel *aLogLevel, otLogRegion *aLogRegion, char *aLogLine, uint16_t aSize);
+
+/**
+ * This function returns the number of deferred log lines dropped because the log buffer was full.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * @returns The number of dropped log lines.
+ *
+ */
+uint32_t otLoggingGetBinaryLogDropCount(void);
+
 /**
  * @}
  *
@@ -84,6 +84,7 @@ typedef struct otBufferInfo
     uint16_t mCoapSecureBuffers;       ///< The number of buffers in the CoAP secure send queue.
     uint16_t mApplicationCoapMessages; ///< The number of messages in the application CoAP send queue.
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
+    uint16_t mMaxUsedBuffers;          ///< The max number of used buffers at the same time since stack start or reset.
 } otBufferInfo;
 
 /**
@@ -290,6 +291,41 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
  */
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength);
 
+/**
+ * This structure represents a contiguous chunk of a message's content.
+ *
+ * A message is stored as a chain of buffers. Chunks give direct (zero-copy) access to the buffer data holding a range
+ * of the message, e.g., to build an `iovec` array for scatter/gather I/O.
+ *
+ */
+typedef struct otMessageChunk
+{
+    const uint8_t *mData;   ///< Pointer to the start of the chunk data.
+    uint16_t       mLength; ///< Length of the chunk data in bytes.
+} otMessageChunk;
+
+/**
+ * Get the chunks holding a range of a message's content.
+ *
+ * If the range extends beyond the end of the message, it is truncated to the message length. The chunk data remains
+ * valid as long as the message is not modified (e.g., its length changed) or freed.
+ *
+ * @param[in]     aMessage    A pointer to a message buffer.
+ * @param[in]     aOffset     The offset in bytes to the start of the range.
+ * @param[in]     aLength     The length in bytes of the range.
+ * @param[out]    aChunks     A pointer to an array to output the chunks.
+ * @param[inout]  aNumChunks  On entry, the number of entries in @p aChunks. On exit, the number of chunks output.
+ *
+ * @retval OT_ERROR_NONE     Successfully output the chunks covering the whole range.
+ * @retval OT_ERROR_NO_BUFS  The range spans more chunks than @p aChunks can hold.
+ *
+ */
+otError otMessageGetChunks(const otMessage *aMessage,
+                           uint16_t         aOffset,
+                           uint16_t         aLength,
+                           otMessageChunk * aChunks,
+                           uint16_t *       aNumChunks);
+
 /**
  * This structure represents an OpenThread message queue.
  */
@@ -368,6 +404,16 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Reset the Message Buffer information counter tracking the maximum number of buffers in use at the same time.
+ *
+ * This resets `mMaxUsedBuffers` in `otBufferInfo` to the number of buffers currently in use.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetBufferInfo(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -181,6 +181,64 @@ typedef struct otMleCounters
     uint16_t mParentChanges;
 } otMleCounters;
 
+/**
+ * This structure represents the Thread key derivation counters.
+ *
+ */
+typedef struct otKeyManagerCounters
+{
+    uint32_t mKeyDerivations;          ///< Number of MAC/MLE key derivations (HMAC-SHA256 over the network key).
+    uint32_t mTrelKeyDerivations;      ///< Number of TREL key derivations (HKDF-SHA256 over the network key).
+    uint32_t mTemporaryKeyCacheHits;   ///< Number of previous/next key sequence lookups served from the cache.
+    uint32_t mTemporaryKeyCacheMisses; ///< Number of other key sequence lookups which required a key derivation.
+} otKeyManagerCounters;
+
+/**
+ * This structure represents the 6LoWPAN reassembly counters.
+ *
+ */
+typedef struct otReassemblyCounters
+{
+    uint32_t mDatagrams;           ///< Number of datagrams successfully reassembled.
+    uint32_t mFragments;           ///< Number of fragments accepted for reassembly.
+    uint32_t mOutOfOrderFragments; ///< Number of accepted "next fragments" which were received out of order.
+    uint32_t mDuplicateFragments;  ///< Number of duplicate or overlapping fragments which were dropped.
+    uint32_t mTimeouts;            ///< Number of datagrams dropped due to the reassembly timeout.
+    uint32_t mEvictions;           ///< Number of datagrams dropped to make room for a new datagram.
+    uint32_t mTotalLatency;        ///< Sum of the reassembly latencies (first to last fragment) in milliseconds.
+    uint32_t mMaxLatency;          ///< Maximum reassembly latency (first to last fragment) in milliseconds.
+} otReassemblyCounters;
+
+/**
+ * The number of bins in a send queue delay histogram.
+ *
+ * Bin 0 counts delays below 1 ms, bin `n` counts delays in the range [2^(n-1), 2^n) ms and the last bin counts all
+ * longer delays.
+ *
+ */
+#define OT_SEND_QUEUE_DELAY_HISTOGRAM_BINS 12
+
+/**
+ * The number of priority levels in the send queue statistics (low, normal, high and network control).
+ *
+ */
+#define OT_SEND_QUEUE_NUM_PRIORITIES 4
+
+/**
+ * This structure represents the mesh forwarder send queue statistics.
+ *
+ * The queueing delay of a direct transmission is the time from the message being queued until its first frame is
+ * handed to the MAC layer. The arrays are indexed by message priority level (`otMessagePriority`, followed by the
+ * network control level).
+ *
+ */
+typedef struct otSendQueueStats
+{
+    uint32_t mDelayHistogram[OT_SEND_QUEUE_NUM_PRIORITIES][OT_SEND_QUEUE_DELAY_HISTOGRAM_BINS]; ///< Delay histograms.
+    uint32_t mMaxDelay[OT_SEND_QUEUE_NUM_PRIORITIES]; ///< Maximum queueing delay in milliseconds.
+    uint32_t mDestinationLimitEvictions;              ///< Number of messages evicted by the per-destination limit.
+} otSendQueueStats;
+
 /**
  * This structure represents the MLE Parent Response data.
  *
@@ -872,6 +930,68 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance);
  */
 void otThreadResetMleCounters(otInstance *aInstance);
 
+/**
+ * Get the Thread key derivation counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Thread key derivation counters.
+ *
+ */
+const otKeyManagerCounters *otThreadGetKeyManagerCounters(otInstance *aInstance);
+
+/**
+ * Reset the Thread key derivation counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetKeyManagerCounters(otInstance *aInstance);
+
+/**
+ * Get the 6LoWPAN reassembly counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the 6LoWPAN reassembly counters.
+ *
+ */
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Reset the 6LoWPAN reassembly counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Get the mesh forwarder send queue statistics.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the send queue statistics.
+ *
+ */
+const otSendQueueStats *otThreadGetSendQueueStats(otInstance *aInstance);
+
+/**
+ * Reset the mesh forwarder send queue statistics.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetSendQueueStats(otInstance *aInstance);
+
 /**
  * This function pointer is called every time an MLE Parent Response message is received.
  *
@@ -121,6 +121,33 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * This structure represents the EID-to-RLOC cache counters.
+ *
+ */
+typedef struct otAddressCacheCounters
+{
+    uint32_t mHits;      ///< Number of address resolutions served from a cached or snooped entry.
+    uint32_t mMisses;    ///< Number of address resolutions that required (or awaited) an Address Query.
+    uint32_t mEvictions; ///< Number of entries evicted to make room for a new entry.
+} otAddressCacheCounters;
+
+/**
+ * This structure represents the source match table counters.
+ *
+ * The source match table holds the sleepy children with queued frames, for which the radio sets the frame pending bit
+ * in the acks to their data polls.
+ *
+ */
+typedef struct otSrcMatchCounters
+{
+    uint32_t mTableFullEvents; ///< Number of times source matching was disabled because the table was full.
+    uint32_t mAddressAdds;     ///< Number of addresses added to the source match table.
+    uint32_t mAddressClears;   ///< Number of addresses cleared from the source match table.
+    uint32_t mCoalescedClears; ///< Number of deferred clears canceled because the address was added again.
+    uint32_t mSkippedAdds;     ///< Number of additions not attempted because the table was known to be full.
+} otSrcMatchCounters;
+
 /**
  * Get the maximum number of children currently allowed.
  *
@@ -552,6 +579,42 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * Get the EID-to-RLOC cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID-to-RLOC cache counters.
+ *
+ */
+const otAddressCacheCounters *otThreadGetAddressCacheCounters(otInstance *aInstance);
+
+/**
+ * Reset the EID-to-RLOC cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetAddressCacheCounters(otInstance *aInstance);
+
+/**
+ * Get the source match table counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the source match table counters.
+ *
+ */
+const otSrcMatchCounters *otThreadGetSrcMatchCounters(otInstance *aInstance);
+
+/**
+ * Reset the source match table counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetSrcMatchCounters(otInstance *aInstance);
+
 /**
  * Get the Thread PSKc
  *
@@ -728,7 +728,7 @@ exit:
 
 otError Interpreter::ProcessBufferInfo(Arg aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgs);
+    otError error = OT_ERROR_NONE;
 
     struct BufferInfoName
     {
@@ -751,17 +751,28 @@ otError Interpreter::ProcessBufferInfo(Arg aArgs[])
 
     otBufferInfo bufferInfo;
 
+    if (aArgs[0] == "reset")
+    {
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+        otMessageResetBufferInfo(mInstance);
+        ExitNow();
+    }
+
+    VerifyOrExit(aArgs[0].IsEmpty(), error = OT_ERROR_INVALID_COMMAND);
+
     otMessageGetBufferInfo(mInstance, &bufferInfo);
 
     OutputLine("total: %d", bufferInfo.mTotalBuffers);
     OutputLine("free: %d", bufferInfo.mFreeBuffers);
+    OutputLine("max used: %d", bufferInfo.mMaxUsedBuffers);
 
     for (const BufferInfoName &info : kBufferInfoNames)
     {
         OutputLine("%s: %d %d", info.mName, bufferInfo.*info.mNumMessagesPtr, bufferInfo.*info.mNumBuffersPtr);
     }
 
-    return OT_ERROR_NONE;
+exit:
+    return error;
 }
 
 otError Interpreter::ProcessCcaThreshold(Arg aArgs[])
@@ -1548,6 +1559,62 @@ otError Interpreter::ProcessDns(Arg aArgs[])
         error = OT_ERROR_PENDING;
     }
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    else if (aArgs[0] == "cache")
+    {
+        // On a cache hit, the lookup callback is invoked synchronously
+        // and only outputs the response. The error it reports (e.g.,
+        // `OT_ERROR_NOT_FOUND` for a negative response) is then used as
+        // the command result.
+
+        otError lookupError = OT_ERROR_NONE;
+
+        if (aArgs[1].IsEmpty())
+        {
+            const otDnsCacheCounters *counters = otDnsClientGetCacheCounters(mInstance);
+
+            OutputLine("Hits: %u", counters->mHits);
+            OutputLine("NegativeHits: %u", counters->mNegativeHits);
+            OutputLine("Misses: %u", counters->mMisses);
+            OutputLine("Evictions: %u", counters->mEvictions);
+        }
+        else if (aArgs[1] == "reset")
+        {
+            otDnsClientResetCacheCounters(mInstance);
+        }
+        else if (aArgs[1] == "clear")
+        {
+            otDnsClientClearCache(mInstance);
+        }
+        else if (aArgs[1] == "resolve")
+        {
+            VerifyOrExit(!aArgs[2].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+            SuccessOrExit(error = otDnsClientLookupAddress(mInstance, aArgs[2].GetCString(),
+                                                           &Interpreter::HandleDnsCacheAddressResponse, &lookupError));
+            error = lookupError;
+        }
+#if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+        else if (aArgs[1] == "browse")
+        {
+            VerifyOrExit(!aArgs[2].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+            SuccessOrExit(error = otDnsClientLookupBrowse(mInstance, aArgs[2].GetCString(),
+                                                          &Interpreter::HandleDnsCacheBrowseResponse, &lookupError));
+            error = lookupError;
+        }
+        else if (aArgs[1] == "service")
+        {
+            VerifyOrExit(!aArgs[3].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+            SuccessOrExit(error = otDnsClientLookupService(mInstance, aArgs[2].GetCString(), aArgs[3].GetCString(),
+                                                           &Interpreter::HandleDnsCacheServiceResponse, &lookupError));
+            error = lookupError;
+        }
+#endif
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
     else
     {
@@ -1598,6 +1665,20 @@ void Interpreter::HandleDnsAddressResponse(otError aError, const otDnsAddressRes
 }
 
 void Interpreter::HandleDnsAddressResponse(otError aError, const otDnsAddressResponse *aResponse)
+{
+    OutputDnsAddressResponse(aError, aResponse);
+    OutputResult(aError);
+}
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+void Interpreter::HandleDnsCacheAddressResponse(otError aError, const otDnsAddressResponse *aResponse, void *aContext)
+{
+    *static_cast<otError *>(aContext) = aError;
+    Interpreter::GetInterpreter().OutputDnsAddressResponse(aError, aResponse);
+}
+#endif
+
+void Interpreter::OutputDnsAddressResponse(otError aError, const otDnsAddressResponse *aResponse)
 {
     char         hostName[OT_DNS_MAX_NAME_SIZE];
     otIp6Address address;
@@ -1620,7 +1701,6 @@ void Interpreter::HandleDnsAddressResponse(otError aError, const otDnsAddressRes
     }
 
     OutputLine("");
-    OutputResult(aError);
 }
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
@@ -1644,6 +1724,20 @@ void Interpreter::HandleDnsBrowseResponse(otError aError, const otDnsBrowseRespo
 }
 
 void Interpreter::HandleDnsBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse)
+{
+    OutputDnsBrowseResponse(aError, aResponse);
+    OutputResult(aError);
+}
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+void Interpreter::HandleDnsCacheBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse, void *aContext)
+{
+    *static_cast<otError *>(aContext) = aError;
+    Interpreter::GetInterpreter().OutputDnsBrowseResponse(aError, aResponse);
+}
+#endif
+
+void Interpreter::OutputDnsBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse)
 {
     char             name[OT_DNS_MAX_NAME_SIZE];
     char             label[OT_DNS_MAX_LABEL_SIZE];
@@ -1676,8 +1770,6 @@ void Interpreter::HandleDnsBrowseResponse(otError aError, const otDnsBrowseRespo
             OutputLine("");
         }
     }
-
-    OutputResult(aError);
 }
 
 void Interpreter::HandleDnsServiceResponse(otError aError, const otDnsServiceResponse *aResponse, void *aContext)
@@ -1686,6 +1778,20 @@ void Interpreter::HandleDnsServiceResponse(otError aError, const otDnsServiceRes
 }
 
 void Interpreter::HandleDnsServiceResponse(otError aError, const otDnsServiceResponse *aResponse)
+{
+    OutputDnsServiceResponse(aError, aResponse);
+    OutputResult(aError);
+}
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+void Interpreter::HandleDnsCacheServiceResponse(otError aError, const otDnsServiceResponse *aResponse, void *aContext)
+{
+    *static_cast<otError *>(aContext) = aError;
+    Interpreter::GetInterpreter().OutputDnsServiceResponse(aError, aResponse);
+}
+#endif
+
+void Interpreter::OutputDnsServiceResponse(otError aError, const otDnsServiceResponse *aResponse)
 {
     char             name[OT_DNS_MAX_NAME_SIZE];
     char             label[OT_DNS_MAX_LABEL_SIZE];
@@ -1709,8 +1815,6 @@ void Interpreter::HandleDnsServiceResponse(otError aError, const otDnsServiceRes
             OutputLine("");
         }
     }
-
-    OutputResult(aError);
 }
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
@@ -1759,21 +1863,41 @@ void Interpreter::OutputEidCacheEntry(const otCacheEntryInfo &aEntry)
 
 otError Interpreter::ProcessEidCache(Arg aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgs);
-
+    otError              error = OT_ERROR_NONE;
     otCacheEntryIterator iterator;
     otCacheEntryInfo     entry;
 
+    if (aArgs[0] == "counters")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            const otAddressCacheCounters *counters = otThreadGetAddressCacheCounters(mInstance);
+
+            OutputLine("Hits: %u", counters->mHits);
+            OutputLine("Misses: %u", counters->mMisses);
+            OutputLine("Evictions: %u", counters->mEvictions);
+        }
+        else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
+        {
+            otThreadResetAddressCacheCounters(mInstance);
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+
+        ExitNow();
+    }
+
     memset(&iterator, 0, sizeof(iterator));
 
-    for (uint8_t i = 0;; i++)
+    while (otThreadGetNextCacheEntry(mInstance, &entry, &iterator) == OT_ERROR_NONE)
     {
-        SuccessOrExit(otThreadGetNextCacheEntry(mInstance, &entry, &iterator));
         OutputEidCacheEntry(entry);
     }
 
 exit:
-    return OT_ERROR_NONE;
+    return error;
 }
 #endif
 
@@ -714,12 +714,22 @@ private:
     otError     GetDnsConfig(Arg aArgs[], otDnsQueryConfig *&aConfig);
     static void HandleDnsAddressResponse(otError aError, const otDnsAddressResponse *aResponse, void *aContext);
     void        HandleDnsAddressResponse(otError aError, const otDnsAddressResponse *aResponse);
+    void        OutputDnsAddressResponse(otError aError, const otDnsAddressResponse *aResponse);
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
     void        OutputDnsServiceInfo(uint8_t aIndentSize, const otDnsServiceInfo &aServiceInfo);
     static void HandleDnsBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse, void *aContext);
     void        HandleDnsBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse);
+    void        OutputDnsBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse);
     static void HandleDnsServiceResponse(otError aError, const otDnsServiceResponse *aResponse, void *aContext);
     void        HandleDnsServiceResponse(otError aError, const otDnsServiceResponse *aResponse);
+    void        OutputDnsServiceResponse(otError aError, const otDnsServiceResponse *aResponse);
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    static void HandleDnsCacheAddressResponse(otError aError, const otDnsAddressResponse *aResponse, void *aContext);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+    static void HandleDnsCacheBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse, void *aContext);
+    static void HandleDnsCacheServiceResponse(otError aError, const otDnsServiceResponse *aResponse, void *aContext);
+#endif
 #endif
 #endif
 
@@ -87,6 +87,29 @@ void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Dns::Client>().GetCacheCounters();
+}
+
+void otDnsClientResetCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Dns::Client>().ResetCacheCounters();
+}
+
+void otDnsClientClearCache(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Dns::Client>().ClearCache();
+}
+#endif
+
 otError otDnsClientResolveAddress(otInstance *            aInstance,
                                   const char *            aHostName,
                                   otDnsAddressCallback    aCallback,
@@ -99,6 +122,18 @@ otError otDnsClientResolveAddress(otInstance *            aInstance,
                                                       static_cast<const Dns::Client::QueryConfig *>(aConfig));
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+otError otDnsClientLookupAddress(otInstance *         aInstance,
+                                 const char *         aHostName,
+                                 otDnsAddressCallback aCallback,
+                                 void *               aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Dns::Client>().LookupAddress(aHostName, aCallback, aContext);
+}
+#endif
+
 otError otDnsAddressResponseGetHostName(const otDnsAddressResponse *aResponse,
                                         char *                      aNameBuffer,
                                         uint16_t                    aNameBufferSize)
@@ -133,6 +168,18 @@ otError otDnsClientBrowse(otInstance *            aInstance,
                                               static_cast<const Dns::Client::QueryConfig *>(aConfig));
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+otError otDnsClientLookupBrowse(otInstance *        aInstance,
+                                const char *        aServiceName,
+                                otDnsBrowseCallback aCallback,
+                                void *              aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Dns::Client>().LookupBrowse(aServiceName, aCallback, aContext);
+}
+#endif
+
 otError otDnsBrowseResponseGetServiceName(const otDnsBrowseResponse *aResponse,
                                           char *                     aNameBuffer,
                                           uint16_t                   aNameBufferSize)
@@ -187,6 +234,19 @@ otError otDnsClientResolveService(otInstance *            aInstance,
                                                       static_cast<const Dns::Client::QueryConfig *>(aConfig));
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+otError otDnsClientLookupService(otInstance *         aInstance,
+                                 const char *         aInstanceLabel,
+                                 const char *         aServiceName,
+                                 otDnsServiceCallback aCallback,
+                                 void *               aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Dns::Client>().LookupService(aInstanceLabel, aServiceName, aCallback, aContext);
+}
+#endif
+
 otError otDnsServiceResponseGetServiceName(const otDnsServiceResponse *aResponse,
                                            char *                      aLabelBuffer,
                                            uint8_t                     aLabelBufferSize,
@@ -131,6 +131,29 @@ void otRemoveStateChangeCallback(otInstance *aInstance, otStateChangedCallback a
     instance.Get<Notifier>().RemoveCallback(aCallback, aContext);
 }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+otError otInstanceGetNotifierHandlerStats(otInstance *aInstance, uint8_t aIndex, otNotifierHandlerStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Notifier>().GetHandlerStats(aIndex, *aStats);
+}
+
+uint32_t otInstanceGetNotifierEventCount(otInstance *aInstance, otChangedFlags aFlag)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Notifier>().GetEventCount(aFlag);
+}
+
+void otInstanceResetNotifierStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Notifier>().ResetStats();
+}
+#endif
+
 void otInstanceFactoryReset(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -115,6 +115,31 @@ int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint
     return aLength;
 }
 
+otError otMessageGetChunks(const otMessage *aMessage,
+                           uint16_t         aOffset,
+                           uint16_t         aLength,
+                           otMessageChunk * aChunks,
+                           uint16_t *       aNumChunks)
+{
+    Error          error     = kErrorNone;
+    const Message &message   = *static_cast<const Message *>(aMessage);
+    uint16_t       numChunks = 0;
+    Message::Chunk chunk;
+
+    for (message.GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; message.GetNextChunk(aLength, chunk))
+    {
+        VerifyOrExit(numChunks < *aNumChunks, error = kErrorNoBufs);
+
+        aChunks[numChunks].mData   = chunk.GetData();
+        aChunks[numChunks].mLength = chunk.GetLength();
+        numChunks++;
+    }
+
+exit:
+    *aNumChunks = numChunks;
+    return error;
+}
+
 void otMessageQueueInit(otMessageQueue *aQueue)
 {
     aQueue->mData = nullptr;
@@ -178,6 +203,8 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
     aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
 
+    aBufferInfo->mMaxUsedBuffers = instance.Get<MessagePool>().GetMaxUsedBufferCount();
+
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
 
     instance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
@@ -228,4 +255,9 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+void otMessageResetBufferInfo(otInstance *aInstance)
+{
+    static_cast<Instance *>(aInstance)->Get<MessagePool>().ResetMaxUsedBufferCount();
+}
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -563,6 +563,52 @@ void otThreadResetMleCounters(otInstance *aInstance)
     instance.Get<Mle::MleRouter>().ResetCounters();
 }
 
+const otKeyManagerCounters *otThreadGetKeyManagerCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<KeyManager>().GetCounters();
+}
+
+void otThreadResetKeyManagerCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<KeyManager>().ResetCounters();
+}
+
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetReassemblyCounters();
+}
+
+void otThreadResetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MeshForwarder>().ResetReassemblyCounters();
+}
+#endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+const otSendQueueStats *otThreadGetSendQueueStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetSendQueueStats();
+}
+
+void otThreadResetSendQueueStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MeshForwarder>().ResetSendQueueStats();
+}
+#endif
+
 void otThreadRegisterParentResponseCallback(otInstance *                   aInstance,
                                             otThreadParentResponseCallback aCallback,
                                             void *                         aContext)
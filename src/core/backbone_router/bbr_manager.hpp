@@ -225,6 +225,9 @@ private:
                                             const Ip6::Address &       aTarget,
                                             ThreadStatusTlv::DuaStatus aStatus);
 #endif
+
+    static constexpr Events::Flags kNotifierEvents = kEventThreadBackboneRouterStateChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     static void HandleTimer(Timer &aTimer);
@@ -35,6 +35,8 @@
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
@@ -48,28 +50,40 @@ namespace ot {
 
 namespace BackboneRouter {
 
+MulticastListenersTable::MulticastListenersTable(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mNumValidListeners(0)
+    , mCallback(nullptr)
+    , mCallbackContext(nullptr)
+{
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    memset(mIndex, 0xff, sizeof(mIndex));
+#endif
+}
+
 Error MulticastListenersTable::Add(const Ip6::Address &aAddress, Time aExpireTime)
 {
-    Error error = kErrorNone;
+    Error    error = kErrorNone;
+    uint16_t index;
 
     VerifyOrExit(aAddress.IsMulticastLargerThanRealmLocal(), error = kErrorInvalidArgs);
 
-    for (uint16_t i = 0; i < mNumValidListeners; i++)
-    {
-        Listener &listener = mListeners[i];
+    index = Find(aAddress);
 
-        if (listener.GetAddress() == aAddress)
-        {
-            listener.SetExpireTime(aExpireTime);
-            FixHeap(i);
-            ExitNow();
-        }
+    if (index != kNotFound)
+    {
+        mListeners[index].SetExpireTime(aExpireTime);
+        FixHeap(index);
+        ExitNow();
     }
 
     VerifyOrExit(mNumValidListeners < OT_ARRAY_LENGTH(mListeners), error = kErrorNoBufs);
 
     mListeners[mNumValidListeners].SetAddress(aAddress);
     mListeners[mNumValidListeners].SetExpireTime(aExpireTime);
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    AddToIndex(mNumValidListeners);
+#endif
     mNumValidListeners++;
 
     FixHeap(mNumValidListeners - 1);
@@ -87,31 +101,20 @@ exit:
 
 void MulticastListenersTable::Remove(const Ip6::Address &aAddress)
 {
-    Error error = kErrorNotFound;
+    Error    error = kErrorNotFound;
+    uint16_t index = Find(aAddress);
 
-    for (uint16_t i = 0; i < mNumValidListeners; i++)
-    {
-        Listener &listener = mListeners[i];
+    VerifyOrExit(index != kNotFound);
 
-        if (listener.GetAddress() == aAddress)
-        {
-            mNumValidListeners--;
-
-            if (i != mNumValidListeners)
-            {
-                listener = mListeners[mNumValidListeners];
-                FixHeap(i);
-            }
-
-            if (mCallback != nullptr)
-            {
-                mCallback(mCallbackContext, OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED, &aAddress);
-            }
+    RemoveAt(index);
 
-            ExitNow(error = kErrorNone);
-        }
+    if (mCallback != nullptr)
+    {
+        mCallback(mCallbackContext, OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED, &aAddress);
     }
 
+    error = kErrorNone;
+
 exit:
     LogMulticastListenersTable("Remove", aAddress, TimeMilli(0), error);
     CheckInvariants();
@@ -127,13 +130,7 @@ void MulticastListenersTable::Expire(void)
         LogMulticastListenersTable("Expire", mListeners[0].GetAddress(), mListeners[0].GetExpireTime(), kErrorNone);
         address = mListeners[0].GetAddress();
 
-        mNumValidListeners--;
-
-        if (mNumValidListeners > 0)
-        {
-            mListeners[0] = mListeners[mNumValidListeners];
-            FixHeap(0);
-        }
+        RemoveAt(0);
 
         if (mCallback != nullptr)
         {
@@ -158,6 +155,128 @@ void MulticastListenersTable::LogMulticastListenersTable(const char *        aAc
                  aExpireTime.GetValue(), ErrorToString(aError));
 }
 
+uint16_t MulticastListenersTable::Find(const Ip6::Address &aAddress) const
+{
+    uint16_t index = kNotFound;
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    for (uint16_t slot = GetHomeSlot(aAddress); mIndex[slot] != kEmptySlot; slot = GetNextSlot(slot))
+    {
+        if (mListeners[mIndex[slot]].GetAddress() == aAddress)
+        {
+            ExitNow(index = mIndex[slot]);
+        }
+    }
+#else
+    for (uint16_t i = 0; i < mNumValidListeners; i++)
+    {
+        if (mListeners[i].GetAddress() == aAddress)
+        {
+            ExitNow(index = i);
+        }
+    }
+#endif
+
+exit:
+    return index;
+}
+
+void MulticastListenersTable::RemoveAt(uint16_t aIndex)
+{
+    // Removes the listener at `aIndex` by moving the last listener
+    // of the heap into its place.
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    RemoveFromIndex(aIndex);
+#endif
+
+    mNumValidListeners--;
+
+    if (aIndex != mNumValidListeners)
+    {
+        PlaceListener(aIndex, mListeners[mNumValidListeners]);
+        FixHeap(aIndex);
+    }
+}
+
+void MulticastListenersTable::PlaceListener(uint16_t aIndex, const Listener &aListener)
+{
+    mListeners[aIndex] = aListener;
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    mIndex[aListener.mIndexSlot] = aIndex;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+
+uint16_t MulticastListenersTable::GetHomeSlot(const Ip6::Address &aAddress)
+{
+    uint32_t hash = 0;
+
+    for (uint32_t word : aAddress.mFields.m32)
+    {
+        hash = (hash ^ word) * 2654435761u;
+    }
+
+    return static_cast<uint16_t>((hash >> 16) % kIndexSize);
+}
+
+void MulticastListenersTable::AddToIndex(uint16_t aIndex)
+{
+    uint16_t slot = GetHomeSlot(mListeners[aIndex].GetAddress());
+
+    // There are at most `kMulticastListenersTableSize` entries in an
+    // index of size `kIndexSize`, so an empty slot is always found.
+
+    while (mIndex[slot] != kEmptySlot)
+    {
+        slot = GetNextSlot(slot);
+    }
+
+    mIndex[slot]                  = aIndex;
+    mListeners[aIndex].mIndexSlot = slot;
+}
+
+void MulticastListenersTable::RemoveFromIndex(uint16_t aIndex)
+{
+    uint16_t slot = mListeners[aIndex].mIndexSlot;
+
+    // Backward-shift deletion: move any subsequent entry in the same
+    // probe sequence into the freed slot so that lookups never need
+    // tombstones.
+
+    for (uint16_t next = GetNextSlot(slot); mIndex[next] != kEmptySlot; next = GetNextSlot(next))
+    {
+        Listener &listener = mListeners[mIndex[next]];
+        uint16_t  home     = GetHomeSlot(listener.GetAddress());
+        bool      canMove;
+
+        // An entry at `next` can move to `slot` only if its home slot
+        // is not cyclically within `(slot, next]`.
+
+        if (slot <= next)
+        {
+            canMove = (home <= slot) || (home > next);
+        }
+        else
+        {
+            canMove = (home <= slot) && (home > next);
+        }
+
+        if (canMove)
+        {
+            mIndex[slot]        = mIndex[next];
+            listener.mIndexSlot = slot;
+            slot                = next;
+        }
+    }
+
+    mIndex[slot] = kEmptySlot;
+}
+
+#endif // OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+
 void MulticastListenersTable::FixHeap(uint16_t aIndex)
 {
     if (!SiftHeapElemDown(aIndex))
@@ -175,6 +294,13 @@ void MulticastListenersTable::CheckInvariants(void) const
 
         OT_ASSERT(!(mListeners[child] < mListeners[parent]));
     }
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    for (uint16_t i = 0; i < mNumValidListeners; i++)
+    {
+        OT_ASSERT(mIndex[mListeners[i].mIndexSlot] == i);
+    }
+#endif
 #endif
 }
 
@@ -206,14 +332,14 @@ bool MulticastListenersTable::SiftHeapElemDown(uint16_t aIndex)
             break;
         }
 
-        mListeners[index] = mListeners[child];
+        PlaceListener(index, mListeners[child]);
 
         index = child;
     }
 
     if (index > aIndex)
     {
-        mListeners[index] = saveElem;
+        PlaceListener(index, saveElem);
     }
 
     return index > aIndex;
@@ -237,14 +363,14 @@ void MulticastListenersTable::SiftHeapElemUp(uint16_t aIndex)
             break;
         }
 
-        mListeners[index] = mListeners[parent];
+        PlaceListener(index, mListeners[parent]);
 
         index = parent;
     }
 
     if (index < aIndex)
     {
-        mListeners[index] = saveElem;
+        PlaceListener(index, saveElem);
     }
 }
 
@@ -268,6 +394,13 @@ void MulticastListenersTable::Clear(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    for (uint16_t i = 0; i < mNumValidListeners; i++)
+    {
+        mIndex[mListeners[i].mIndexSlot] = kEmptySlot;
+    }
+#endif
+
     mNumValidListeners = 0;
 
     CheckInvariants();
@@ -97,6 +97,9 @@ public:
 
         Ip6::Address mAddress;
         TimeMilli    mExpireTime;
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+        uint16_t mIndexSlot; // The slot in `mIndex` referring to this listener.
+#endif
     };
 
     /**
@@ -105,13 +108,7 @@ public:
      * @param[in] aInstance  A reference to the OpenThread instance.
      *
      */
-    explicit MulticastListenersTable(Instance &aInstance)
-        : InstanceLocator(aInstance)
-        , mNumValidListeners(0)
-        , mCallback(nullptr)
-        , mCallbackContext(nullptr)
-    {
-    }
+    explicit MulticastListenersTable(Instance &aInstance);
 
     /**
      * This method adds a Multicast Listener with given address and expire time.
@@ -195,6 +192,22 @@ private:
         kMulticastListenersTableSize >= 75,
         "Thread 1.2 Conformance requires the Multicast Listener Table size to be larger than or equal to 75.");
 
+    static constexpr uint16_t kNotFound = 0xffff; // Returned by `Find()` when the address is not in the table.
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    // The index uses linear probing and keeps the load factor at or
+    // below one half. Each slot stores the position of a listener in
+    // the `mListeners[]` heap (or `kEmptySlot`) and each listener
+    // stores its slot, so that the slot is updated whenever the heap
+    // moves the listener.
+
+    static constexpr uint16_t kIndexSize = 2 * kMulticastListenersTableSize + 1;
+    static constexpr uint16_t kEmptySlot = 0xffff;
+
+    static_assert(kMulticastListenersTableSize <= 32767,
+                  "OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS is too large for the Multicast Listeners Table index");
+#endif
+
     class IteratorBuilder : InstanceLocator
     {
     public:
@@ -212,13 +225,27 @@ private:
                                     TimeMilli           aExpireTime,
                                     Error               aError);
 
-    void FixHeap(uint16_t aIndex);
-    bool SiftHeapElemDown(uint16_t aIndex);
-    void SiftHeapElemUp(uint16_t aIndex);
-    void CheckInvariants(void) const;
+    uint16_t Find(const Ip6::Address &aAddress) const;
+    void     RemoveAt(uint16_t aIndex);
+    void     PlaceListener(uint16_t aIndex, const Listener &aListener);
+    void     FixHeap(uint16_t aIndex);
+    bool     SiftHeapElemDown(uint16_t aIndex);
+    void     SiftHeapElemUp(uint16_t aIndex);
+    void     CheckInvariants(void) const;
+
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    void AddToIndex(uint16_t aIndex);
+    void RemoveFromIndex(uint16_t aIndex);
+
+    static uint16_t GetHomeSlot(const Ip6::Address &aAddress);
+    static uint16_t GetNextSlot(uint16_t aSlot) { return (aSlot + 1 < kIndexSize) ? aSlot + 1 : 0; }
+#endif
 
     Listener mListeners[kMulticastListenersTableSize];
     uint16_t mNumValidListeners;
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+    uint16_t mIndex[kIndexSize];
+#endif
 
     otBackboneRouterMulticastListenerCallback mCallback;
     void *                                    mCallbackContext;
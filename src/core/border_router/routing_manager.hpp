@@ -266,6 +266,8 @@ private:
     typedef Array<Ip6::Prefix, kMaxOmrPrefixNum>           OmrPrefixArray;
     typedef Array<ExternalPrefix, kMaxDiscoveredPrefixNum> ExternalPrefixArray;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadNetdataChanged;
+
     void  EvaluateState(void);
     void  Start(void);
     void  Stop(void);
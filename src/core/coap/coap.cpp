@@ -59,7 +59,13 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     , mLastResponse(nullptr)
 #endif
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    , mNumUnindexedRequests(0)
+#endif
 {
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    memset(mTokenBuckets, 0, sizeof(mTokenBuckets));
+#endif
 }
 
 void CoapBase::ClearRequestsAndResponses(void)
@@ -82,7 +88,7 @@ void CoapBase::ClearRequests(const Ip6::Address *aAddress)
         Metadata metadata;
 
         nextMessage = message->GetNextCoapMessage();
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if ((aAddress == nullptr) || (metadata.mSourceAddress == *aAddress))
         {
@@ -424,7 +430,7 @@ void CoapBase::HandleRetransmissionTimer(void)
     {
         nextMessage = message->GetNextCoapMessage();
 
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if (now >= metadata.mNextTimerShot)
         {
@@ -447,7 +453,7 @@ void CoapBase::HandleRetransmissionTimer(void)
             metadata.mRetransmissionsRemaining--;
             metadata.mRetransmissionTimeout *= 2;
             metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(*message);
+            UpdateMetadata(*message, metadata);
 
             // Retransmit
             if (!metadata.mAcknowledged)
@@ -500,7 +506,7 @@ Error CoapBase::AbortTransaction(ResponseHandler aHandler, void *aContext)
     for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
     {
         nextMessage = message->GetNextCoapMessage();
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if (metadata.mResponseHandler == aHandler && metadata.mResponseContext == aContext)
         {
@@ -516,22 +522,63 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
 {
     Error    error       = kErrorNone;
     Message *messageCopy = nullptr;
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    RequestEntry *entry = mRequestEntries.Allocate();
+#endif
 
     VerifyOrExit((messageCopy = aMessage.Clone(aCopyLength)) != nullptr, error = kErrorNoBufs);
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    if (entry != nullptr)
+    {
+        entry->mMessage  = messageCopy;
+        entry->mMetadata = aMetadata;
+        AddRequestEntry(*entry);
+    }
+    else
+    {
+        // All index entries are in use. The metadata is appended to
+        // the message, same as without the index, and requests are
+        // matched by scanning the queue until such requests are gone.
+
+        SuccessOrExit(error = aMetadata.AppendTo(*messageCopy));
+        mNumUnindexedRequests++;
+    }
+#else
     SuccessOrExit(error = aMetadata.AppendTo(*messageCopy));
+#endif
 
     mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
 
     mPendingRequests.Enqueue(*messageCopy);
 
 exit:
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    if ((error != kErrorNone) && (entry != nullptr))
+    {
+        mRequestEntries.Free(*entry);
+    }
+#endif
     FreeAndNullMessageOnError(messageCopy, error);
     return messageCopy;
 }
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    RequestEntry *entry = FindRequestEntry(aMessage);
+
+    if (entry != nullptr)
+    {
+        RemoveRequestEntry(*entry);
+    }
+    else
+    {
+        OT_ASSERT(mNumUnindexedRequests > 0);
+        mNumUnindexedRequests--;
+    }
+#endif
+
     mPendingRequests.Dequeue(aMessage);
 
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
@@ -944,7 +991,17 @@ void CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessag
     Message *messageCopy = nullptr;
 
     // Create a message copy for lower layers.
-    messageCopy = aMessage.Clone(aMessage.GetLength() - sizeof(Metadata));
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    if (FindRequestEntry(aMessage) != nullptr)
+    {
+        messageCopy = aMessage.Clone();
+    }
+    else
+#endif
+    {
+        messageCopy = aMessage.Clone(aMessage.GetLength() - sizeof(Metadata));
+    }
+
     VerifyOrExit(messageCopy != nullptr, error = kErrorNoBufs);
 
     SuccessOrExit(error = Send(*messageCopy, aMessageInfo));
@@ -958,20 +1015,146 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+
+template <typename EntryType> static void AppendToBucket(LinkedList<EntryType> &aBucket, EntryType &aEntry)
+{
+    EntryType *tail = aBucket.GetTail();
+
+    if (tail == nullptr)
+    {
+        aBucket.Push(aEntry);
+    }
+    else
+    {
+        aBucket.PushAfter(aEntry, *tail);
+    }
+}
+
+uint16_t CoapBase::HashToken(const Message &aMessage)
+{
+    const uint8_t *token = aMessage.GetToken();
+    uint32_t       hash  = 2166136261u;
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        hash = (hash ^ token[i]) * 16777619u;
+    }
+
+    return static_cast<uint16_t>(hash % kNumRequestBuckets);
+}
+
+const CoapBase::RequestEntry *CoapBase::FindRequestEntry(const Message &aRequest) const
+{
+    return mIdBuckets[HashMessageId(aRequest.GetMessageId())].FindMatching(aRequest);
+}
+
+CoapBase::RequestEntry *CoapBase::FindRequestEntry(const Message &aRequest)
+{
+    return AsNonConst(AsConst(this)->FindRequestEntry(aRequest));
+}
+
+void CoapBase::AddRequestEntry(RequestEntry &aEntry)
+{
+    RequestEntry **link;
+
+    // Entries are appended to the tail of their buckets so that a
+    // lookup returns the oldest matching request first, same as a
+    // scan of `mPendingRequests`.
+
+    AppendToBucket(mIdBuckets[HashMessageId(aEntry.mMessage->GetMessageId())], aEntry);
+
+    aEntry.mNextByToken = nullptr;
+
+    for (link = &mTokenBuckets[HashToken(*aEntry.mMessage)]; *link != nullptr; link = &(*link)->mNextByToken)
+    {
+    }
+
+    *link = &aEntry;
+}
+
+void CoapBase::RemoveRequestEntry(RequestEntry &aEntry)
+{
+    RequestEntry **link;
+
+    IgnoreError(mIdBuckets[HashMessageId(aEntry.mMessage->GetMessageId())].Remove(aEntry));
+
+    for (link = &mTokenBuckets[HashToken(*aEntry.mMessage)]; *link != &aEntry; link = &(*link)->mNextByToken)
+    {
+        OT_ASSERT(*link != nullptr);
+    }
+
+    *link = aEntry.mNextByToken;
+
+    mRequestEntries.Free(aEntry);
+}
+
+Message *CoapBase::FindIndexedRequest(const Message &         aResponse,
+                                      const Ip6::MessageInfo &aMessageInfo,
+                                      Metadata &              aMetadata)
+{
+    Message *     message = nullptr;
+    RequestEntry *entry   = nullptr;
+
+    switch (aResponse.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        for (RequestEntry &idEntry : mIdBuckets[HashMessageId(aResponse.GetMessageId())])
+        {
+            if ((aResponse.GetMessageId() == idEntry.mMessage->GetMessageId()) &&
+                idEntry.mMetadata.MatchesSource(aMessageInfo))
+            {
+                entry = &idEntry;
+                break;
+            }
+        }
+
+        break;
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        for (entry = mTokenBuckets[HashToken(aResponse)]; entry != nullptr; entry = entry->mNextByToken)
+        {
+            if (aResponse.IsTokenEqual(*entry->mMessage) && entry->mMetadata.MatchesSource(aMessageInfo))
+            {
+                break;
+            }
+        }
+
+        break;
+    }
+
+    VerifyOrExit(entry != nullptr);
+
+    message   = entry->mMessage;
+    aMetadata = entry->mMetadata;
+
+exit:
+    return message;
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+
 Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       Metadata &              aMetadata)
 {
     Message *message;
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    // The index can only be used when it covers all pending requests.
+    if (mNumUnindexedRequests == 0)
+    {
+        ExitNow(message = FindIndexedRequest(aResponse, aMessageInfo, aMetadata));
+    }
+#endif
+
     for (message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
     {
-        aMetadata.ReadFrom(*message);
+        ReadMetadata(*message, aMetadata);
 
-        if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aMetadata.mDestinationAddress.IsMulticast() ||
-             aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
-            (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+        if (aMetadata.MatchesSource(aMessageInfo))
         {
             switch (aResponse.GetType())
             {
@@ -1085,7 +1268,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 if (metadata.mConfirmable)
                 {
                     metadata.mAcknowledged = true;
-                    metadata.UpdateIn(*request);
+                    UpdateMetadata(*request, metadata);
                 }
 
                 // Remove the message if response is not expected, otherwise await
@@ -1110,7 +1293,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
 
                 // Consider the message acknowledged at this point.
                 metadata.mAcknowledged = true;
-                metadata.UpdateIn(*request);
+                UpdateMetadata(*request, metadata);
             }
             else
 #endif
@@ -1422,6 +1605,45 @@ void CoapBase::Metadata::UpdateIn(Message &aMessage) const
     aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
 }
 
+bool CoapBase::Metadata::MatchesSource(const Ip6::MessageInfo &aMessageInfo) const
+{
+    return ((mDestinationAddress == aMessageInfo.GetPeerAddr()) || mDestinationAddress.IsMulticast() ||
+            mDestinationAddress.GetIid().IsAnycastLocator()) &&
+           (mDestinationPort == aMessageInfo.GetPeerPort());
+}
+
+void CoapBase::ReadMetadata(const Message &aRequest, Metadata &aMetadata) const
+{
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    const RequestEntry *entry = FindRequestEntry(aRequest);
+
+    if (entry != nullptr)
+    {
+        aMetadata = entry->mMetadata;
+    }
+    else
+#endif
+    {
+        aMetadata.ReadFrom(aRequest);
+    }
+}
+
+void CoapBase::UpdateMetadata(Message &aRequest, const Metadata &aMetadata)
+{
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    RequestEntry *entry = FindRequestEntry(aRequest);
+
+    if (entry != nullptr)
+    {
+        entry->mMetadata = aMetadata;
+    }
+    else
+#endif
+    {
+        aMetadata.UpdateIn(aRequest);
+    }
+}
+
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
     : mTimer(aInstance, ResponsesQueue::HandleTimer, this)
 {
@@ -1437,13 +1659,44 @@ Error ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
     cacheResponse = FindMatchedResponse(aRequest, aMessageInfo);
     VerifyOrExit(cacheResponse != nullptr, error = kErrorNotFound);
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    *aResponse = cacheResponse->Clone();
+#else
     *aResponse = cacheResponse->Clone(cacheResponse->GetLength() - sizeof(ResponseMetadata));
+#endif
     VerifyOrExit(*aResponse != nullptr, error = kErrorNoBufs);
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+
+const ResponsesQueue::ResponseEntry *ResponsesQueue::FindResponseEntry(const Message &aMessage) const
+{
+    return mBuckets[HashMessageId(aMessage.GetMessageId())].FindMatching(aMessage);
+}
+
+const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+{
+    const Message *message = nullptr;
+
+    for (const ResponseEntry &entry : mBuckets[HashMessageId(aRequest.GetMessageId())])
+    {
+        if ((entry.mMessage->GetMessageId() == aRequest.GetMessageId()) &&
+            (entry.mMetadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
+            (entry.mMetadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
+        {
+            message = entry.mMessage;
+            break;
+        }
+    }
+
+    return message;
+}
+
+#else // OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+
 const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
 {
     Message *message;
@@ -1467,12 +1720,29 @@ const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, cons
     return message;
 }
 
+#endif // OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+
+void ResponsesQueue::ReadMetadata(const Message &aMessage, ResponseMetadata &aMetadata) const
+{
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    const ResponseEntry *entry = FindResponseEntry(aMessage);
+
+    OT_ASSERT(entry != nullptr);
+    aMetadata = entry->mMetadata;
+#else
+    aMetadata.ReadFrom(aMessage);
+#endif
+}
+
 void ResponsesQueue::EnqueueResponse(Message &               aMessage,
                                      const Ip6::MessageInfo &aMessageInfo,
                                      const TxParameters &    aTxParameters)
 {
     Message *        responseCopy;
     ResponseMetadata metadata;
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    ResponseEntry *entry;
+#endif
 
     metadata.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
     metadata.mMessageInfo = aMessageInfo;
@@ -1481,9 +1751,19 @@ void ResponsesQueue::EnqueueResponse(Message &               aMessage,
 
     UpdateQueue();
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    VerifyOrExit((entry = mEntries.Allocate()) != nullptr);
+    VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr, mEntries.Free(*entry));
+
+    entry->mMessage  = responseCopy;
+    entry->mMetadata = metadata;
+
+    AppendToBucket(mBuckets[HashMessageId(responseCopy->GetMessageId())], *entry);
+#else
     VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr);
 
     VerifyOrExit(metadata.AppendTo(*responseCopy) == kErrorNone, responseCopy->Free());
+#endif
 
     mQueue.Enqueue(*responseCopy);
 
@@ -1507,7 +1787,7 @@ void ResponsesQueue::UpdateQueue(void)
     {
         ResponseMetadata metadata;
 
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
         {
@@ -1526,11 +1806,27 @@ void ResponsesQueue::UpdateQueue(void)
 
 void ResponsesQueue::DequeueResponse(Message &aMessage)
 {
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    ResponseEntry *entry = mBuckets[HashMessageId(aMessage.GetMessageId())].RemoveMatching(aMessage);
+
+    OT_ASSERT(entry != nullptr);
+    mEntries.Free(*entry);
+#endif
+
     mQueue.DequeueAndFree(aMessage);
 }
 
 void ResponsesQueue::DequeueAllResponses(void)
 {
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    mEntries.FreeAll();
+
+    for (LinkedList<ResponseEntry> &bucket : mBuckets)
+    {
+        bucket.Clear();
+    }
+#endif
+
     mQueue.DequeueAndFreeAll();
 }
 
@@ -1551,7 +1847,7 @@ void ResponsesQueue::HandleTimer(void)
 
         nextMessage = message->GetNextCoapMessage();
 
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if (now >= metadata.mDequeueTime)
         {
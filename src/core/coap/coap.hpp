@@ -39,6 +39,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "common/timer.hpp"
 #include "net/ip6.hpp"
 #include "net/netif.hpp"
@@ -338,7 +339,23 @@ private:
         Ip6::MessageInfo mMessageInfo;
     };
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    struct ResponseEntry : public LinkedListEntry<ResponseEntry>
+    {
+        bool Matches(const Message &aMessage) const { return mMessage == &aMessage; }
+
+        Message *        mMessage;  // The cached response.
+        ResponseEntry *  mNext;     // Storage for `LinkedListEntry` (Message ID bucket or pool free list).
+        ResponseMetadata mMetadata; // The metadata of the cached response.
+    };
+
+    static uint16_t HashMessageId(uint16_t aMessageId) { return aMessageId % kMaxCachedResponses; }
+
+    const ResponseEntry *FindResponseEntry(const Message &aMessage) const;
+#endif
+
     const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+    void           ReadMetadata(const Message &aMessage, ResponseMetadata &aMetadata) const;
     void           DequeueResponse(Message &aMessage);
     void           UpdateQueue(void);
 
@@ -347,6 +364,11 @@ private:
 
     MessageQueue      mQueue;
     TimerMilliContext mTimer;
+
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    Pool<ResponseEntry, kMaxCachedResponses> mEntries;
+    LinkedList<ResponseEntry>                mBuckets[kMaxCachedResponses];
+#endif
 };
 
 /**
@@ -690,6 +712,7 @@ private:
         Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void  ReadFrom(const Message &aMessage);
         void  UpdateIn(Message &aMessage) const;
+        bool  MatchesSource(const Ip6::MessageInfo &aMessageInfo) const;
 
         Ip6::Address    mSourceAddress;            // IPv6 address of the message source.
         Ip6::Address    mDestinationAddress;       // IPv6 address of the message destination.
@@ -717,9 +740,37 @@ private:
 #endif
     };
 
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    static constexpr uint16_t kNumRequestEntries = OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES;
+    static constexpr uint16_t kNumRequestBuckets = kNumRequestEntries;
+
+    struct RequestEntry : public LinkedListEntry<RequestEntry>
+    {
+        bool Matches(const Message &aMessage) const { return mMessage == &aMessage; }
+
+        Message *     mMessage;     // The stored copy of the request.
+        RequestEntry *mNext;        // Storage for `LinkedListEntry` (Message ID bucket or pool free list).
+        RequestEntry *mNextByToken; // Next entry in the same Token bucket.
+        Metadata      mMetadata;    // The metadata of the request.
+    };
+
+    static uint16_t HashMessageId(uint16_t aMessageId) { return aMessageId % kNumRequestBuckets; }
+    static uint16_t HashToken(const Message &aMessage);
+
+    const RequestEntry *FindRequestEntry(const Message &aRequest) const;
+    RequestEntry *      FindRequestEntry(const Message &aRequest);
+    void                AddRequestEntry(RequestEntry &aEntry);
+    void                RemoveRequestEntry(RequestEntry &aEntry);
+    Message *           FindIndexedRequest(const Message &         aResponse,
+                                           const Ip6::MessageInfo &aMessageInfo,
+                                           Metadata &              aMetadata);
+#endif
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
+    void     ReadMetadata(const Message &aRequest, Metadata &aMetadata) const;
+    void     UpdateMetadata(Message &aRequest, const Metadata &aMetadata);
     void     ClearRequests(const Ip6::Address *aAddress);
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata);
     void     DequeueMessage(Message &aMessage);
@@ -786,6 +837,12 @@ private:
     LinkedList<ResourceBlockWise> mBlockWiseResources;
     Message *                     mLastResponse;
 #endif
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    Pool<RequestEntry, kNumRequestEntries> mRequestEntries;
+    LinkedList<RequestEntry>               mIdBuckets[kNumRequestBuckets];
+    RequestEntry *                         mTokenBuckets[kNumRequestBuckets];
+    uint16_t                               mNumUnindexedRequests;
+#endif
 };
 
 /**
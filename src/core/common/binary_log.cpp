@@ -0,0 +1,623 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary (deferred formatting) log buffer.
+ */
+
+#include "binary_log.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#include <stddef.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+
+void BinaryLogBuffer::Record(otLogLevel  aLevel,
+                             otLogRegion aRegion,
+                             uint64_t    aUptime,
+                             const char *aFormat,
+                             va_list     aArgs)
+{
+    uint8_t  staging[kMaxRecordSize];
+    uint8_t *record = staging;
+    uint32_t head   = mHead;
+    uint32_t tail   = LoadAcquire(mTail);
+    uint32_t freeSize;
+    bool     inPlace;
+    Header   header;
+
+    // One byte is always left unused so that a full buffer can be told apart from an empty one.
+    freeSize = kBufferSize - 1 - ((head + kBufferSize - tail) % kBufferSize);
+
+    // The record is encoded directly in the buffer when the largest
+    // possible record fits there contiguously (the common case).
+    // Otherwise it is encoded in `staging` and copied (wrapping
+    // around the end of the buffer) once its length is known.
+    inPlace = (freeSize >= kMaxRecordSize) && (kBufferSize - head >= kMaxRecordSize);
+
+    if (inPlace)
+    {
+        record = &mBuffer[head];
+    }
+
+    header.mLength = sizeof(Header) + EncodeArgs(aFormat, aArgs, &record[sizeof(Header)], header.mNumArgs);
+    header.mLevel  = static_cast<uint8_t>(aLevel);
+    header.mRegion = static_cast<uint8_t>(aRegion);
+    header.mUptime = aUptime;
+    header.mFormat = aFormat;
+    memcpy(record, &header, sizeof(Header));
+
+    if (!inPlace)
+    {
+        if (header.mLength > freeSize)
+        {
+            mDropCount++;
+            ExitNow();
+        }
+
+        CopyIn(head, record, header.mLength);
+    }
+
+    StoreRelease(mHead, (head + header.mLength) % kBufferSize);
+
+exit:
+    return;
+}
+
+bool BinaryLogBuffer::Read(Entry &aEntry)
+{
+    bool     didRead = false;
+    uint32_t tail    = mTail;
+    Header   header;
+
+    VerifyOrExit(LoadAcquire(mHead) != tail);
+
+    CopyOut(tail, &header, sizeof(Header));
+
+    aEntry.mLevel      = static_cast<otLogLevel>(header.mLevel);
+    aEntry.mRegion     = static_cast<otLogRegion>(header.mRegion);
+    aEntry.mUptime     = header.mUptime;
+    aEntry.mFormat     = header.mFormat;
+    aEntry.mNumArgs    = header.mNumArgs;
+    aEntry.mArgsLength = header.mLength - sizeof(Header);
+    CopyOut((tail + sizeof(Header)) % kBufferSize, aEntry.mArgs, aEntry.mArgsLength);
+
+    StoreRelease(mTail, (tail + header.mLength) % kBufferSize);
+    didRead = true;
+
+exit:
+    return didRead;
+}
+
+void BinaryLogBuffer::Format(const Entry &aEntry, StringWriter &aWriter)
+{
+    const char *cursor  = aEntry.mFormat;
+    uint16_t    offset  = 0;
+    uint8_t     numArgs = 0;
+
+    while (true)
+    {
+        Spec        spec;
+        const char *next = FindSpec(cursor, spec);
+        const char *end  = (next != nullptr) ? spec.mStart : cursor + strlen(cursor);
+        char        specString[kMaxSpecLength + 1];
+        const char *specPtr = nullptr;
+        int         stars[2];
+
+        if (end > cursor)
+        {
+            aWriter.Append("%.*s", static_cast<int>(end - cursor), cursor);
+        }
+
+        VerifyOrExit(next != nullptr);
+        cursor = next;
+
+        if (spec.mType == kArgNone)
+        {
+            aWriter.Append("%%");
+            continue;
+        }
+
+        // Stop at the first argument which did not fit in the record (the log line was truncated).
+        numArgs += static_cast<uint8_t>(spec.mNumStars + 1);
+        VerifyOrExit(numArgs <= aEntry.mNumArgs);
+
+        for (uint8_t i = 0; i < spec.mNumStars; i++)
+        {
+            VerifyOrExit(DecodeArg(aEntry, offset, stars[i]));
+        }
+
+        if (spec.mLength <= kMaxSpecLength)
+        {
+            memcpy(specString, spec.mStart, spec.mLength);
+            specString[spec.mLength] = '\0';
+            specPtr                  = specString;
+        }
+
+        switch (spec.mType)
+        {
+        case kArgInt:
+        {
+            int value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgLong:
+        {
+            long value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgLongLong:
+        {
+            long long value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgSize:
+        {
+            size_t value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgIntMax:
+        {
+            intmax_t value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgPtrDiff:
+        {
+            ptrdiff_t value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgDouble:
+        {
+            double value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgLongDouble:
+        {
+            long double value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgPointer:
+        {
+            const void *value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgString:
+        {
+            const char *value = reinterpret_cast<const char *>(&aEntry.mArgs[offset]);
+            const void *nul   = memchr(value, '\0', aEntry.mArgsLength - offset);
+
+            VerifyOrExit(nul != nullptr);
+            offset += static_cast<uint16_t>(static_cast<const char *>(nul) - value) + 1;
+            AppendArg(aWriter, specPtr, stars, spec.mNumStars, value);
+            break;
+        }
+
+        case kArgOutputCount:
+        {
+            const void *value;
+
+            VerifyOrExit(DecodeArg(aEntry, offset, value));
+            break;
+        }
+
+        case kArgNone:
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+const char *BinaryLogBuffer::FindSpec(const char *aFormat, Spec &aSpec)
+{
+    // Parses the next conversion specification "%[flags][width][.precision][length]conversion" in `aFormat`,
+    // returning a pointer past it, or `nullptr` if there is none.
+
+    // Plain loops are used instead of `strchr()` since the format
+    // strings are short and this is on the logging fast path.
+
+    const char *cursor   = aFormat;
+    uint8_t     numLongs = 0;
+
+    while ((*cursor != '%') && (*cursor != '\0'))
+    {
+        cursor++;
+    }
+
+    VerifyOrExit(*cursor == '%', cursor = nullptr);
+
+    aSpec.mStart    = cursor++;
+    aSpec.mNumStars = 0;
+    aSpec.mType     = kArgInt;
+
+    while ((*cursor == '-') || (*cursor == '+') || (*cursor == ' ') || (*cursor == '#') || (*cursor == '0') ||
+           (*cursor == '\''))
+    {
+        cursor++;
+    }
+
+    for (uint8_t field = 0; field < 2; field++)
+    {
+        if (field == 1)
+        {
+            if (*cursor != '.')
+            {
+                break;
+            }
+
+            cursor++;
+        }
+
+        if (*cursor == '*')
+        {
+            aSpec.mNumStars++;
+            cursor++;
+        }
+        else
+        {
+            while (*cursor >= '0' && *cursor <= '9')
+            {
+                cursor++;
+            }
+        }
+    }
+
+    switch (*cursor)
+    {
+    case 'h':
+        while (*cursor == 'h')
+        {
+            cursor++;
+        }
+        break;
+
+    case 'l':
+        while (*cursor == 'l')
+        {
+            numLongs++;
+            cursor++;
+        }
+        aSpec.mType = (numLongs == 1) ? kArgLong : kArgLongLong;
+        break;
+
+    case 'q':
+        aSpec.mType = kArgLongLong;
+        cursor++;
+        break;
+
+    case 'z':
+        aSpec.mType = kArgSize;
+        cursor++;
+        break;
+
+    case 'j':
+        aSpec.mType = kArgIntMax;
+        cursor++;
+        break;
+
+    case 't':
+        aSpec.mType = kArgPtrDiff;
+        cursor++;
+        break;
+
+    case 'L':
+        aSpec.mType = kArgLongDouble;
+        cursor++;
+        break;
+
+    default:
+        break;
+    }
+
+    switch (*cursor)
+    {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    case 'c':
+        if (aSpec.mType == kArgLongDouble)
+        {
+            aSpec.mType = kArgLongLong;
+        }
+        break;
+
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        if (aSpec.mType != kArgLongDouble)
+        {
+            aSpec.mType = kArgDouble;
+        }
+        break;
+
+    case 'p':
+        aSpec.mType = kArgPointer;
+        break;
+
+    case 's':
+        aSpec.mType = kArgString;
+        break;
+
+    case 'n':
+        aSpec.mType = kArgOutputCount;
+        break;
+
+    case '%':
+        aSpec.mType     = kArgNone;
+        aSpec.mNumStars = 0;
+        break;
+
+    default:
+        // Incomplete or unknown conversion, treat the remaining format string as text.
+        ExitNow(cursor = nullptr);
+    }
+
+    cursor++;
+    aSpec.mLength = static_cast<uint8_t>(OT_MIN(cursor - aSpec.mStart, static_cast<ptrdiff_t>(UINT8_MAX)));
+
+exit:
+    return cursor;
+}
+
+uint16_t BinaryLogBuffer::EncodeArgs(const char *aFormat, va_list aArgs, uint8_t *aBuffer, uint8_t &aNumArgs)
+{
+    uint16_t length = 0;
+    Spec     spec;
+
+    aNumArgs = 0;
+
+    while ((aFormat = FindSpec(aFormat, spec)) != nullptr)
+    {
+        for (uint8_t i = 0; i < spec.mNumStars; i++)
+        {
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, int)));
+            aNumArgs++;
+        }
+
+        switch (spec.mType)
+        {
+        case kArgNone:
+            continue;
+
+        case kArgInt:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, int)));
+            break;
+
+        case kArgLong:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, long)));
+            break;
+
+        case kArgLongLong:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, long long)));
+            break;
+
+        case kArgSize:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, size_t)));
+            break;
+
+        case kArgIntMax:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, intmax_t)));
+            break;
+
+        case kArgPtrDiff:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, ptrdiff_t)));
+            break;
+
+        case kArgDouble:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, double)));
+            break;
+
+        case kArgLongDouble:
+            VerifyOrExit(EncodeArg(aBuffer, length, va_arg(aArgs, long double)));
+            break;
+
+        case kArgPointer:
+        case kArgOutputCount:
+            VerifyOrExit(EncodeArg(aBuffer, length, static_cast<const void *>(va_arg(aArgs, void *))));
+            break;
+
+        case kArgString:
+            VerifyOrExit(EncodeString(aBuffer, length, va_arg(aArgs, const char *)));
+            break;
+        }
+
+        aNumArgs++;
+    }
+
+exit:
+    return length;
+}
+
+bool BinaryLogBuffer::EncodeString(uint8_t *aBuffer, uint16_t &aLength, const char *aString)
+{
+    // Copies the string (truncated if needed) including its null
+    // terminator, so that it can be freed or changed after logging.
+
+    bool didEncode = false;
+
+    VerifyOrExit(aLength < kMaxEntrySize);
+
+    if (aString == nullptr)
+    {
+        aString = "(null)";
+    }
+
+    // Log string arguments are short, a byte loop beats `strlen()` and `memcpy()`.
+    while ((*aString != '\0') && (aLength < kMaxEntrySize - 1))
+    {
+        aBuffer[aLength++] = static_cast<uint8_t>(*aString++);
+    }
+
+    aBuffer[aLength++] = '\0';
+    didEncode          = true;
+
+exit:
+    return didEncode;
+}
+
+template <typename Type> bool BinaryLogBuffer::EncodeArg(uint8_t *aBuffer, uint16_t &aLength, Type aValue)
+{
+    bool didEncode = false;
+
+    VerifyOrExit(aLength + sizeof(Type) <= kMaxEntrySize);
+    memcpy(&aBuffer[aLength], &aValue, sizeof(Type));
+    aLength += sizeof(Type);
+    didEncode = true;
+
+exit:
+    return didEncode;
+}
+
+template <typename Type> bool BinaryLogBuffer::DecodeArg(const Entry &aEntry, uint16_t &aOffset, Type &aValue)
+{
+    bool didDecode = false;
+
+    VerifyOrExit(aOffset + sizeof(Type) <= aEntry.mArgsLength);
+    memcpy(&aValue, &aEntry.mArgs[aOffset], sizeof(Type));
+    aOffset += sizeof(Type);
+    didDecode = true;
+
+exit:
+    return didDecode;
+}
+
+template <typename Type>
+void BinaryLogBuffer::AppendArg(StringWriter &aWriter,
+                                const char *  aSpec,
+                                const int *   aStars,
+                                uint8_t       aNumStars,
+                                Type          aValue)
+{
+    VerifyOrExit(aSpec != nullptr);
+
+    switch (aNumStars)
+    {
+    case 0:
+        aWriter.Append(aSpec, aValue);
+        break;
+
+    case 1:
+        aWriter.Append(aSpec, aStars[0], aValue);
+        break;
+
+    default:
+        aWriter.Append(aSpec, aStars[0], aStars[1], aValue);
+        break;
+    }
+
+exit:
+    return;
+}
+
+void BinaryLogBuffer::CopyIn(uint32_t aPosition, const void *aData, uint16_t aLength)
+{
+    uint16_t firstLength = static_cast<uint16_t>(OT_MIN(static_cast<uint32_t>(aLength), kBufferSize - aPosition));
+
+    memcpy(&mBuffer[aPosition], aData, firstLength);
+    memcpy(mBuffer, static_cast<const uint8_t *>(aData) + firstLength, aLength - firstLength);
+}
+
+void BinaryLogBuffer::CopyOut(uint32_t aPosition, void *aData, uint16_t aLength) const
+{
+    uint16_t firstLength = static_cast<uint16_t>(OT_MIN(static_cast<uint32_t>(aLength), kBufferSize - aPosition));
+
+    memcpy(aData, &mBuffer[aPosition], firstLength);
+    memcpy(static_cast<uint8_t *>(aData) + firstLength, mBuffer, aLength - firstLength);
+}
+
+uint32_t BinaryLogBuffer::LoadAcquire(const uint32_t &aIndex)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(&aIndex, __ATOMIC_ACQUIRE);
+#else
+    return *static_cast<const volatile uint32_t *>(&aIndex);
+#endif
+}
+
+void BinaryLogBuffer::StoreRelease(uint32_t &aIndex, uint32_t aValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(&aIndex, aValue, __ATOMIC_RELEASE);
+#else
+    *static_cast<volatile uint32_t *>(&aIndex) = aValue;
+#endif
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
@@ -0,0 +1,203 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary (deferred formatting) log buffer.
+ */
+
+#ifndef BINARY_LOG_HPP_
+#define BINARY_LOG_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#include <openthread/platform/logging.h>
+
+#include "common/non_copyable.hpp"
+#include "common/string.hpp"
+
+namespace ot {
+
+/**
+ * This class implements a ring buffer of log lines recorded in binary form (format string pointer and raw arguments)
+ * and formatted later.
+ *
+ * Recording and reading are lock-free as long as there is a single producer (the OpenThread logging functions) and a
+ * single consumer (the platform draining the buffer), which may run on different threads.
+ *
+ */
+class BinaryLogBuffer : private NonCopyable
+{
+public:
+    static constexpr uint16_t kMaxEntrySize = OPENTHREAD_CONFIG_LOG_MAX_SIZE; ///< Max size of a log line's arguments.
+
+    /**
+     * This structure represents a log line read from the buffer.
+     *
+     */
+    struct Entry
+    {
+        otLogLevel  mLevel;               ///< The log level.
+        otLogRegion mRegion;              ///< The log region.
+        uint64_t    mUptime;              ///< The uptime (in msec) when the log line was recorded.
+        const char *mFormat;              ///< The format string.
+        uint8_t     mNumArgs;             ///< The number of recorded arguments.
+        uint16_t    mArgsLength;          ///< The length (number of bytes) of `mArgs`.
+        uint8_t     mArgs[kMaxEntrySize]; ///< The raw arguments.
+    };
+
+    /**
+     * This constructor initializes the buffer as empty.
+     *
+     */
+    constexpr BinaryLogBuffer(void)
+        : mHead(0)
+        , mTail(0)
+        , mDropCount(0)
+        , mBuffer()
+    {
+    }
+
+    /**
+     * This method records a log line.
+     *
+     * Only the format string pointer and the arguments are recorded (the string arguments are copied), so @p aFormat
+     * MUST remain valid until the log line is read. If there is no room for the log line, it is dropped.
+     *
+     * This method MUST only be called from a single (producer) thread.
+     *
+     * @param[in] aLevel    The log level.
+     * @param[in] aRegion   The log region.
+     * @param[in] aUptime   The current uptime (in msec).
+     * @param[in] aFormat   The format string.
+     * @param[in] aArgs     The arguments.
+     *
+     */
+    void Record(otLogLevel aLevel, otLogRegion aRegion, uint64_t aUptime, const char *aFormat, va_list aArgs);
+
+    /**
+     * This method reads (and removes) the oldest log line from the buffer.
+     *
+     * This method MUST only be called from a single (consumer) thread.
+     *
+     * @param[out] aEntry   A reference to an `Entry` to output the log line.
+     *
+     * @retval TRUE   Successfully read a log line into @p aEntry.
+     * @retval FALSE  The buffer is empty.
+     *
+     */
+    bool Read(Entry &aEntry);
+
+    /**
+     * This static method formats a log line read from the buffer.
+     *
+     * @param[in]    aEntry    The log line.
+     * @param[inout] aWriter   The string writer to append the formatted log line to.
+     *
+     */
+    static void Format(const Entry &aEntry, StringWriter &aWriter);
+
+    /**
+     * This method returns the number of log lines dropped because the buffer was full.
+     *
+     * @returns The number of dropped log lines.
+     *
+     */
+    uint32_t GetDropCount(void) const { return mDropCount; }
+
+private:
+    static constexpr uint16_t kBufferSize    = OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE;
+    static constexpr uint8_t  kMaxSpecLength = 23; // Max length of a conversion specification (e.g., "%-08.3lld").
+
+    enum ArgType : uint8_t
+    {
+        kArgNone,        // No argument ("%%").
+        kArgInt,         // `int` (also `char` and `short` after promotion).
+        kArgLong,        // `long`.
+        kArgLongLong,    // `long long`.
+        kArgSize,        // `size_t`.
+        kArgIntMax,      // `intmax_t`.
+        kArgPtrDiff,     // `ptrdiff_t`.
+        kArgDouble,      // `double` (also `float` after promotion).
+        kArgLongDouble,  // `long double`.
+        kArgPointer,     // `void *`.
+        kArgString,      // `const char *`, copied into the record.
+        kArgOutputCount, // `int *` ("%n"), recorded but ignored when formatting.
+    };
+
+    struct Spec
+    {
+        const char *mStart;    // Points to the '%' starting the conversion specification.
+        uint8_t     mLength;   // Length of the conversion specification.
+        uint8_t     mNumStars; // Number of '*' (width and precision) `int` arguments preceding the argument.
+        ArgType     mType;
+    };
+
+    struct Header
+    {
+        uint16_t    mLength; // Length of the record including the header.
+        uint8_t     mLevel;
+        uint8_t     mRegion;
+        uint8_t     mNumArgs;
+        uint64_t    mUptime;
+        const char *mFormat;
+    };
+
+    static const char *FindSpec(const char *aFormat, Spec &aSpec);
+    static uint16_t    EncodeArgs(const char *aFormat, va_list aArgs, uint8_t *aBuffer, uint8_t &aNumArgs);
+    static bool        EncodeString(uint8_t *aBuffer, uint16_t &aLength, const char *aString);
+
+    template <typename Type> static bool EncodeArg(uint8_t *aBuffer, uint16_t &aLength, Type aValue);
+    template <typename Type> static bool DecodeArg(const Entry &aEntry, uint16_t &aOffset, Type &aValue);
+    template <typename Type>
+    static void AppendArg(StringWriter &aWriter, const char *aSpec, const int *aStars, uint8_t aNumStars, Type aValue);
+
+    static constexpr uint16_t kMaxRecordSize = sizeof(Header) + kMaxEntrySize;
+
+    void CopyIn(uint32_t aPosition, const void *aData, uint16_t aLength);
+    void CopyOut(uint32_t aPosition, void *aData, uint16_t aLength) const;
+
+    static uint32_t LoadAcquire(const uint32_t &aIndex);
+    static void     StoreRelease(uint32_t &aIndex, uint32_t aValue);
+
+    uint32_t mHead; // Write position, only updated by the producer.
+    uint32_t mTail; // Read position, only updated by the consumer.
+    uint32_t mDropCount;
+    uint8_t  mBuffer[kBufferSize];
+};
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#endif // BINARY_LOG_HPP_
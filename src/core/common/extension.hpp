@@ -97,6 +97,12 @@ public:
      */
     void SignalNcpInit(Ncp::NcpBase &aNcpInstance);
 
+    /**
+     * The events from OpenThread `Notifier` which are passed to `HandleNotifierEvents()` (all events).
+     *
+     */
+    static constexpr Events::Flags kNotifierEvents = ~static_cast<Events::Flags>(0);
+
     /**
      * This method notifies the extension object of events from  OpenThread `Notifier`.
      *
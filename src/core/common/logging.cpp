@@ -33,6 +33,7 @@
 
 #include "logging.hpp"
 
+#include "common/binary_log.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "common/string.hpp"
@@ -54,27 +55,45 @@
 #error "OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME is not supported under OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE"
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE && OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY
+#error "OPENTHREAD_CONFIG_LOG_BINARY_ENABLE is not supported under OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #if !OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY
 
-static void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
-{
-    ot::String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> logString;
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+static ot::BinaryLogBuffer sBinaryLogBuffer;
+#endif
 
+static uint64_t GetLogUptime(void)
+{
 #if OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME
-    ot::Uptime::UptimeToString(ot::Instance::Get().Get<ot::Uptime>().GetUptime(), logString);
-    logString.Append(" ");
+    return ot::Instance::Get().Get<ot::Uptime>().GetUptime();
+#else
+    return 0;
 #endif
+}
 
-#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
-    VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
+static void AppendLogPrefix(ot::StringWriter &aLogString,
+                            otLogLevel        aLogLevel,
+                            otLogRegion       aLogRegion,
+                            uint64_t          aUptime)
+{
+#if OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME
+    ot::Uptime::UptimeToString(aUptime, aLogString);
+    aLogString.Append(" ");
+#else
+    OT_UNUSED_VARIABLE(aUptime);
 #endif
 
 #if OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
-    logString.Append("%s", otLogLevelToPrefixString(aLogLevel));
+    aLogString.Append("%s", otLogLevelToPrefixString(aLogLevel));
+#else
+    OT_UNUSED_VARIABLE(aLogLevel);
 #endif
 
 #if OPENTHREAD_CONFIG_LOG_PREPEND_REGION
@@ -90,19 +109,37 @@ static void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aForma
 
         if (aLogRegion < OT_ARRAY_LENGTH(kRegionPrefixStrings))
         {
-            logString.Append("%s", kRegionPrefixStrings[aLogRegion]);
+            aLogString.Append("%s", kRegionPrefixStrings[aLogRegion]);
         }
         else
         {
-            logString.Append("%s", _OT_REGION_SUFFIX);
+            aLogString.Append("%s", _OT_REGION_SUFFIX);
         }
     }
 #else
-    logString.Append("%s", _OT_REGION_SUFFIX);
+    OT_UNUSED_VARIABLE(aLogRegion);
+    aLogString.Append("%s", _OT_REGION_SUFFIX);
+#endif
+}
+
+static void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
+{
+#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+    VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
 #endif
 
-    logString.AppendVarArgs(aFormat, aArgs);
-    otPlatLog(aLogLevel, aLogRegion, "%s" OPENTHREAD_CONFIG_LOG_SUFFIX, logString.AsCString());
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    // Formatting is deferred to `otLoggingProcessBinaryLogs()` or `otLoggingReadBinaryLog()`.
+    sBinaryLogBuffer.Record(aLogLevel, aLogRegion, GetLogUptime(), aFormat, aArgs);
+#else
+    {
+        ot::String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> logString;
+
+        AppendLogPrefix(logString, aLogLevel, aLogRegion, GetLogUptime());
+        logString.AppendVarArgs(aFormat, aArgs);
+        otPlatLog(aLogLevel, aLogRegion, "%s" OPENTHREAD_CONFIG_LOG_SUFFIX, logString.AsCString());
+    }
+#endif
 
 #if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
 exit:
@@ -110,6 +147,48 @@ exit:
 #endif
 }
 
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+static bool ReadBinaryLog(ot::StringWriter &aLogString, otLogLevel &aLogLevel, otLogRegion &aLogRegion)
+{
+    ot::BinaryLogBuffer::Entry entry;
+    bool                       didRead = sBinaryLogBuffer.Read(entry);
+
+    VerifyOrExit(didRead);
+
+    aLogLevel  = entry.mLevel;
+    aLogRegion = entry.mRegion;
+    AppendLogPrefix(aLogString, entry.mLevel, entry.mRegion, entry.mUptime);
+    ot::BinaryLogBuffer::Format(entry, aLogString);
+
+exit:
+    return didRead;
+}
+
+bool otLoggingReadBinaryLog(otLogLevel *aLogLevel, otLogRegion *aLogRegion, char *aLogLine, uint16_t aSize)
+{
+    ot::StringWriter logString(aLogLine, aSize);
+
+    return ReadBinaryLog(logString, *aLogLevel, *aLogRegion);
+}
+
+void otLoggingProcessBinaryLogs(void)
+{
+    ot::String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> logString;
+    otLogLevel                                 logLevel;
+    otLogRegion                                logRegion;
+
+    while (ReadBinaryLog(logString.Clear(), logLevel, logRegion))
+    {
+        otPlatLog(logLevel, logRegion, "%s" OPENTHREAD_CONFIG_LOG_SUFFIX, logString.AsCString());
+    }
+}
+
+uint32_t otLoggingGetBinaryLogDropCount(void)
+{
+    return sBinaryLogBuffer.GetDropCount();
+}
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
 #if OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_CRIT
 void _otLogCrit(otLogRegion aRegion, const char *aFormat, ...)
 {
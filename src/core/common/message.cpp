@@ -58,9 +58,8 @@ namespace ot {
 
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    , mNumFreeBuffers(kNumBuffers)
-#endif
+    , mNumUsedBuffers(0)
+    , mMaxUsedBuffers(0)
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
@@ -129,12 +128,11 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
         SuccessOrExit(ReclaimBuffers(aPriority));
     }
 
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    mNumFreeBuffers--;
-#endif
-
     buffer->SetNextBuffer(nullptr);
 
+    mNumUsedBuffers++;
+    mMaxUsedBuffers = OT_MAX(mMaxUsedBuffers, mNumUsedBuffers);
+
 exit:
     if (buffer == nullptr)
     {
@@ -155,8 +153,8 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
         otPlatMessagePoolFree(&GetInstance(), aBuffer);
 #else
         mBufferPool.Free(*aBuffer);
-        mNumFreeBuffers++;
 #endif
+        mNumUsedBuffers--;
         aBuffer = next;
     }
 }
@@ -175,7 +173,7 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     rval = otPlatMessagePoolNumFreeBuffers(&GetInstance());
 #else
-    rval = mNumFreeBuffers;
+    rval = static_cast<uint16_t>(kNumBuffers - mNumUsedBuffers);
 #endif
 
     return rval;
@@ -48,6 +48,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/pool.hpp"
+#include "common/time.hpp"
 #include "common/type_traits.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/child_mask.hpp"
@@ -63,13 +64,6 @@ struct otMessage
 
 namespace ot {
 
-namespace Crypto {
-
-class Sha256;
-class HmacSha256;
-
-} // namespace Crypto
-
 /**
  * @addtogroup core-message
  *
@@ -197,6 +191,9 @@ protected:
         LqiAverager mLqiAverager; // The averager maintaining the Link quality indicator (LQI) average.
 #endif
         ChildMask mChildMask; // ChildMask to indicate which sleepy children need to receive this.
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+        TimeMilli mSendQueueTime; // The time the message was queued for transmission.
+#endif
 
         uint8_t mType : 3;          // The message type.
         uint8_t mSubType : 4;       // The message sub type.
@@ -253,9 +250,6 @@ static_assert(sizeof(Buffer) >= kBufferSize, "Buffer size if not valid");
  */
 class Message : public otMessage, public Buffer
 {
-    friend class Checksum;
-    friend class Crypto::HmacSha256;
-    friend class Crypto::Sha256;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
@@ -740,6 +734,99 @@ public:
         return CompareBytes(aOffset, &aObject, sizeof(ObjectType));
     }
 
+    /**
+     * This structure represents a contiguous chunk of the message content.
+     *
+     * Chunks give direct access to the message buffers, e.g., to process or hand over the message content without
+     * first copying it into a flat buffer.
+     *
+     */
+    struct Chunk
+    {
+        /**
+         * This method returns a pointer to the start of the chunk data.
+         *
+         * @returns A pointer to the chunk data.
+         *
+         */
+        const uint8_t *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the chunk length.
+         *
+         * @returns The length of the chunk data in bytes. Zero indicates there are no more chunks.
+         *
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+        const uint8_t *mData;   ///< Pointer to start of chunk data buffer.
+        uint16_t       mLength; ///< Length of chunk data (in bytes).
+        const Buffer * mBuffer; ///< Buffer containing the chunk.
+    };
+
+    /**
+     * This structure represents a contiguous chunk of the message content which can be modified in place.
+     *
+     */
+    struct WritableChunk : public Chunk
+    {
+        /**
+         * This method returns a pointer to the start of the chunk data.
+         *
+         * @returns A pointer to the chunk data.
+         *
+         */
+        uint8_t *GetData(void) const { return AsNonConst(mData); }
+    };
+
+    /**
+     * This method gets the first chunk of a range of the message content.
+     *
+     * @param[in]    aOffset  Byte offset within the message of the start of the range.
+     * @param[inout] aLength  On entry, the length of the range. On exit, the remaining length after the chunk.
+     * @param[out]   aChunk   A reference to a `Chunk` to output the first chunk. Its length is zero if @p aOffset is
+     *                        beyond the end of the message.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the next chunk of a range of the message content.
+     *
+     * @param[inout] aLength  On entry, the remaining length of the range. On exit, the remaining length after the
+     *                        chunk.
+     * @param[inout] aChunk   On entry, the previous chunk. On exit, the next chunk (with zero length if there are no
+     *                        more chunks).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the first chunk of a range of the message content for in place modification.
+     *
+     * @param[in]    aOffset  Byte offset within the message of the start of the range.
+     * @param[inout] aLength  On entry, the length of the range. On exit, the remaining length after the chunk.
+     * @param[out]   aChunk   A reference to a `WritableChunk` to output the first chunk.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
+    {
+        AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
+    }
+
+    /**
+     * This method gets the next chunk of a range of the message content for in place modification.
+     *
+     * @param[inout] aLength  On entry, the remaining length of the range. On exit, the remaining length after the
+     *                        chunk.
+     * @param[inout] aChunk   On entry, the previous chunk. On exit, the next chunk.
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
+    {
+        AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
+    }
+
     /**
      * This method writes bytes to the message.
      *
@@ -1161,6 +1248,24 @@ public:
     uint8_t GetTimeSyncSeq(void) const { return GetMetadata().mTimeSyncSeq; }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    /**
+     * This method gets the time the message was queued for transmission in the mesh forwarder send queue.
+     *
+     * @returns The time the message was queued for transmission.
+     *
+     */
+    TimeMilli GetSendQueueTime(void) const { return GetMetadata().mSendQueueTime; }
+
+    /**
+     * This method sets the time the message was queued for transmission in the mesh forwarder send queue.
+     *
+     * @param[in]  aTime  The time the message was queued for transmission.
+     *
+     */
+    void SetSendQueueTime(TimeMilli aTime) { GetMetadata().mSendQueueTime = aTime; }
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
      * This method indicates whether the radio type is set.
@@ -1208,34 +1313,6 @@ protected:
     void     SetReserved(uint16_t aReservedHeader) { GetMetadata().mReserved = aReservedHeader; }
 
 private:
-    struct Chunk
-    {
-        const uint8_t *GetData(void) const { return mData; }
-        uint16_t       GetLength(void) const { return mLength; }
-
-        const uint8_t *mData;   // Pointer to start of chunk data buffer.
-        uint16_t       mLength; // Length of chunk data (in bytes).
-        const Buffer * mBuffer; // Buffer containing the chunk
-    };
-
-    struct WritableChunk : public Chunk
-    {
-        uint8_t *GetData(void) const { return AsNonConst(mData); }
-    };
-
-    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &chunk) const;
-    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
-
-    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
-    {
-        AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
-    }
-
-    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
-    {
-        AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
-    }
-
     MessagePool *GetMessagePool(void) const { return GetMetadata().mMessagePool; }
     void         SetMessagePool(MessagePool *aMessagePool) { GetMetadata().mMessagePool = aMessagePool; }
 
@@ -1501,13 +1578,29 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method returns the maximum number of buffers in use at the same time since initialization or reset.
+     *
+     * @returns The maximum number of buffers in use at the same time.
+     *
+     */
+    uint16_t GetMaxUsedBufferCount(void) const { return mMaxUsedBuffers; }
+
+    /**
+     * This method resets the tracked maximum number of buffers in use to the number of buffers currently in use.
+     *
+     */
+    void ResetMaxUsedBufferCount(void) { mMaxUsedBuffers = mNumUsedBuffers; }
+
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+    uint16_t mNumUsedBuffers;
+    uint16_t mMaxUsedBuffers;
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    uint16_t                  mNumFreeBuffers;
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
 };
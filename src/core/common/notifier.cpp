@@ -33,6 +33,12 @@
 
 #include "notifier.hpp"
 
+#include <string.h>
+
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+#include <openthread/platform/time.h>
+#endif
+
 #include "border_router/routing_manager.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -50,6 +56,10 @@ Notifier::Notifier(Instance &aInstance)
         callback.mHandler = nullptr;
         callback.mContext = nullptr;
     }
+
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    ResetStats();
+#endif
 }
 
 Error Notifier::RegisterCallback(otStateChangedCallback aCallback, void *aContext)
@@ -120,6 +130,42 @@ void Notifier::EmitEvents(Tasklet &aTasklet)
     aTasklet.Get<Notifier>().EmitEvents();
 }
 
+template <typename ModuleType> void Notifier::Dispatch(Events aEvents, Handler aHandler)
+{
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    HandlerStats &stats = mHandlerStats[aHandler];
+    uint64_t      startTime;
+    uint32_t      duration;
+#else
+    OT_UNUSED_VARIABLE(aHandler);
+#endif
+
+    if (!aEvents.ContainsAny(ModuleType::kNotifierEvents))
+    {
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+        stats.mSkips++;
+#endif
+        ExitNow();
+    }
+
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    startTime = otPlatTimeGet();
+#endif
+
+    Get<ModuleType>().HandleNotifierEvents(aEvents);
+
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    duration = static_cast<uint32_t>(otPlatTimeGet() - startTime);
+
+    stats.mCalls++;
+    stats.mTotalTime += duration;
+    stats.mMaxTime = OT_MAX(stats.mMaxTime, duration);
+#endif
+
+exit:
+    return;
+}
+
 void Notifier::EmitEvents(void)
 {
     Events events;
@@ -134,66 +180,80 @@ void Notifier::EmitEvents(void)
 
     LogEvents(events);
 
-    // Emit events to core internal modules
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    for (uint8_t bit = 0; bit < kNumEventBits; bit++)
+    {
+        if (events.ContainsAny(static_cast<Events::Flags>(1) << bit))
+        {
+            mEventCounts[bit]++;
+        }
+    }
+#endif
+
+    // Emit events to core internal modules. Each module is invoked
+    // only if `events` includes any of its `kNotifierEvents`.
 
-    Get<Mle::Mle>().HandleNotifierEvents(events);
-    Get<EnergyScanServer>().HandleNotifierEvents(events);
+    Dispatch<Mle::Mle>(events, kHandlerMle);
+    Dispatch<EnergyScanServer>(events, kHandlerEnergyScanServer);
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    Dispatch<Lowpan::Lowpan>(events, kHandlerLowpan);
+#endif
 #if OPENTHREAD_FTD
-    Get<MeshCoP::JoinerRouter>().HandleNotifierEvents(events);
+    Dispatch<MeshCoP::JoinerRouter>(events, kHandlerJoinerRouter);
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-    Get<BackboneRouter::Manager>().HandleNotifierEvents(events);
+    Dispatch<BackboneRouter::Manager>(events, kHandlerBackboneRouterManager);
 #endif
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
-    Get<Utils::ChildSupervisor>().HandleNotifierEvents(events);
+    Dispatch<Utils::ChildSupervisor>(events, kHandlerChildSupervisor);
 #endif
 #if OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE
-    Get<MeshCoP::DatasetUpdater>().HandleNotifierEvents(events);
+    Dispatch<MeshCoP::DatasetUpdater>(events, kHandlerDatasetUpdater);
 #endif
 #endif // OPENTHREAD_FTD
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
-    Get<NetworkData::Notifier>().HandleNotifierEvents(events);
+    Dispatch<NetworkData::Notifier>(events, kHandlerNetworkDataNotifier);
 #endif
 #if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
-    Get<AnnounceSender>().HandleNotifierEvents(events);
+    Dispatch<AnnounceSender>(events, kHandlerAnnounceSender);
 #endif
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
-    Get<MeshCoP::BorderAgent>().HandleNotifierEvents(events);
+    Dispatch<MeshCoP::BorderAgent>(events, kHandlerBorderAgent);
 #endif
 #if OPENTHREAD_CONFIG_MLR_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE)
-    Get<MlrManager>().HandleNotifierEvents(events);
+    Dispatch<MlrManager>(events, kHandlerMlrManager);
 #endif
 #if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
-    Get<DuaManager>().HandleNotifierEvents(events);
+    Dispatch<DuaManager>(events, kHandlerDuaManager);
 #endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-    Get<TimeSync>().HandleNotifierEvents(events);
+    Dispatch<TimeSync>(events, kHandlerTimeSync);
 #endif
 #if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
-    Get<Utils::Slaac>().HandleNotifierEvents(events);
+    Dispatch<Utils::Slaac>(events, kHandlerSlaac);
 #endif
 #if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
-    Get<Utils::JamDetector>().HandleNotifierEvents(events);
+    Dispatch<Utils::JamDetector>(events, kHandlerJamDetector);
 #endif
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
-    Get<Utils::Otns>().HandleNotifierEvents(events);
+    Dispatch<Utils::Otns>(events, kHandlerOtns);
 #endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
-    Get<Utils::HistoryTracker>().HandleNotifierEvents(events);
+    Dispatch<Utils::HistoryTracker>(events, kHandlerHistoryTracker);
 #endif
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
-    Get<Extension::ExtensionBase>().HandleNotifierEvents(events);
+    Dispatch<Extension::ExtensionBase>(events, kHandlerExtension);
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-    Get<BorderRouter::RoutingManager>().HandleNotifierEvents(events);
+    Dispatch<BorderRouter::RoutingManager>(events, kHandlerRoutingManager);
 #endif
 #if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
-    Get<Srp::Client>().HandleNotifierEvents(events);
+    Dispatch<Srp::Client>(events, kHandlerSrpClient);
 #endif
 #if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE
     // The `NetworkData::Publisher` is notified last (e.g., after SRP
     // client) to allow other modules to request changes to what is
     // being published (if needed).
-    Get<NetworkData::Publisher>().HandleNotifierEvents(events);
+    Dispatch<NetworkData::Publisher>(events, kHandlerNetworkDataPublisher);
 #endif
 
     for (ExternalCallback &callback : mExternalCallbacks)
@@ -208,6 +268,77 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+
+Error Notifier::GetHandlerStats(uint8_t aIndex, otNotifierHandlerStats &aStats) const
+{
+    static const char *const kHandlerNames[] = {
+        "Mle",                // kHandlerMle
+        "EnergyScanServer",   // kHandlerEnergyScanServer
+        "Lowpan",             // kHandlerLowpan
+        "JoinerRouter",       // kHandlerJoinerRouter
+        "BbrManager",         // kHandlerBackboneRouterManager
+        "ChildSupervisor",    // kHandlerChildSupervisor
+        "DatasetUpdater",     // kHandlerDatasetUpdater
+        "NetDataNotifier",    // kHandlerNetworkDataNotifier
+        "AnnounceSender",     // kHandlerAnnounceSender
+        "BorderAgent",        // kHandlerBorderAgent
+        "MlrManager",         // kHandlerMlrManager
+        "DuaManager",         // kHandlerDuaManager
+        "TimeSync",           // kHandlerTimeSync
+        "Slaac",              // kHandlerSlaac
+        "JamDetector",        // kHandlerJamDetector
+        "Otns",               // kHandlerOtns
+        "HistoryTracker",     // kHandlerHistoryTracker
+        "Extension",          // kHandlerExtension
+        "RoutingManager",     // kHandlerRoutingManager
+        "SrpClient",          // kHandlerSrpClient
+        "NetDataPublisher",   // kHandlerNetworkDataPublisher
+    };
+
+    static_assert(OT_ARRAY_LENGTH(kHandlerNames) == kNumHandlers, "kHandlerNames is not valid");
+
+    Error               error = kErrorNone;
+    const HandlerStats *stats;
+
+    VerifyOrExit(aIndex < kNumHandlers, error = kErrorNotFound);
+
+    stats = &mHandlerStats[aIndex];
+
+    aStats.mName      = kHandlerNames[aIndex];
+    aStats.mCalls     = stats->mCalls;
+    aStats.mSkips     = stats->mSkips;
+    aStats.mTotalTime = stats->mTotalTime;
+    aStats.mMaxTime   = stats->mMaxTime;
+
+exit:
+    return error;
+}
+
+uint32_t Notifier::GetEventCount(Events::Flags aEvent) const
+{
+    uint32_t count = 0;
+
+    for (uint8_t bit = 0; bit < kNumEventBits; bit++)
+    {
+        if (aEvent == (static_cast<Events::Flags>(1) << bit))
+        {
+            count = mEventCounts[bit];
+            break;
+        }
+    }
+
+    return count;
+}
+
+void Notifier::ResetStats(void)
+{
+    memset(mHandlerStats, 0, sizeof(mHandlerStats));
+    memset(mEventCounts, 0, sizeof(mEventCounts));
+}
+
+#endif // OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+
 // LCOV_EXCL_START
 
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO) && (OPENTHREAD_CONFIG_LOG_CORE == 1)
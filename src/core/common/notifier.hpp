@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -187,7 +188,8 @@ private:
  * This class implements the OpenThread Notifier.
  *
  * For core internal modules, `Notifier` class emits events directly to them by invoking method `HandleNotifierEvents()`
- * on the module instance.
+ * on the module instance. Every such module declares the events it consumes as a `kNotifierEvents` constant (bit-field
+ * `Events::Flags`), and its handler is only invoked when the emitted events include at least one of them.
  *
  * A `otStateChangedCallback` callback can be explicitly registered with the `Notifier`. This is mainly intended for use
  * by external users (i.e.provided as an OpenThread public API). Max number of such callbacks that can be registered at
@@ -296,6 +298,36 @@ public:
         return error;
     }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    /**
+     * This method gets the statistics of a core module handling the emitted events.
+     *
+     * @param[in]  aIndex   The module index.
+     * @param[out] aStats   A reference to output the statistics.
+     *
+     * @retval kErrorNone      Successfully retrieved the statistics.
+     * @retval kErrorNotFound  @p aIndex is beyond the last module.
+     *
+     */
+    Error GetHandlerStats(uint8_t aIndex, otNotifierHandlerStats &aStats) const;
+
+    /**
+     * This method gets the number of emissions which included a given event.
+     *
+     * @param[in] aEvent   The event (a single `Event` bit).
+     *
+     * @returns The number of emissions which included @p aEvent.
+     *
+     */
+    uint32_t GetEventCount(Events::Flags aEvent) const;
+
+    /**
+     * This method resets the `Notifier` statistics.
+     *
+     */
+    void ResetStats(void);
+#endif
+
 private:
     static constexpr uint16_t kMaxExternalHandlers = OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS;
 
@@ -307,15 +339,55 @@ private:
 
     static constexpr uint16_t kFlagsStringBufferSize = kFlagsStringLineLimit + kMaxFlagNameLength;
 
+    static constexpr uint8_t kNumEventBits = sizeof(Events::Flags) * CHAR_BIT;
+
+    enum Handler : uint8_t
+    {
+        kHandlerMle,
+        kHandlerEnergyScanServer,
+        kHandlerLowpan,
+        kHandlerJoinerRouter,
+        kHandlerBackboneRouterManager,
+        kHandlerChildSupervisor,
+        kHandlerDatasetUpdater,
+        kHandlerNetworkDataNotifier,
+        kHandlerAnnounceSender,
+        kHandlerBorderAgent,
+        kHandlerMlrManager,
+        kHandlerDuaManager,
+        kHandlerTimeSync,
+        kHandlerSlaac,
+        kHandlerJamDetector,
+        kHandlerOtns,
+        kHandlerHistoryTracker,
+        kHandlerExtension,
+        kHandlerRoutingManager,
+        kHandlerSrpClient,
+        kHandlerNetworkDataPublisher,
+        kNumHandlers,
+    };
+
     struct ExternalCallback
     {
         otStateChangedCallback mHandler;
         void *                 mContext;
     };
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    struct HandlerStats
+    {
+        uint32_t mCalls;
+        uint32_t mSkips;
+        uint64_t mTotalTime;
+        uint32_t mMaxTime;
+    };
+#endif
+
     static void EmitEvents(Tasklet &aTasklet);
     void        EmitEvents(void);
 
+    template <typename ModuleType> void Dispatch(Events aEvents, Handler aHandler);
+
     void        LogEvents(Events aEvents) const;
     const char *EventToString(Event aEvent) const;
 
@@ -323,6 +395,10 @@ private:
     Events           mSignaledEvents;
     Tasklet          mTask;
     ExternalCallback mExternalCallbacks[kMaxExternalHandlers];
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    HandlerStats mHandlerStats[kNumHandlers];
+    uint32_t     mEventCounts[kNumEventBits];
+#endif
 };
 
 /**
@@ -112,6 +112,199 @@ void TimerMilli::RemoveAll(Instance &aInstance)
     aInstance.Get<Scheduler>().RemoveAll();
 }
 
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+    HeapInsert(aTimer, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    bool wasHead;
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    wasHead = (mHeapRoot == &aTimer);
+
+    HeapRemove(aTimer, Time(aAlarmApi.AlarmGetNow()));
+    aTimer.SetNext(&aTimer);
+
+    if (wasHead)
+    {
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Time   now(aAlarmApi.AlarmGetNow());
+    Timer *timer;
+
+    while ((timer = mHeapRoot) != nullptr)
+    {
+        HeapRemove(*timer, now);
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+void Timer::Scheduler::HeapInsert(Timer &aTimer, Time aNow)
+{
+    aTimer.mNext     = nullptr;
+    aTimer.mPrev     = nullptr;
+    aTimer.mChild    = nullptr;
+    aTimer.mSequence = mNextSequence++;
+
+    mHeapRoot = Meld(mHeapRoot, &aTimer, aNow);
+}
+
+void Timer::Scheduler::HeapRemove(Timer &aTimer, Time aNow)
+{
+    Timer *subHeap = MergePairs(aTimer.mChild, aNow);
+
+    if (mHeapRoot == &aTimer)
+    {
+        mHeapRoot = subHeap;
+    }
+    else
+    {
+        // Detach `aTimer` from its sibling list. `mPrev` is either
+        // the parent (if `aTimer` is the first child) or the
+        // previous sibling.
+
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mNext;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = aTimer.mNext;
+        }
+
+        if (aTimer.mNext != nullptr)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+
+        mHeapRoot = Meld(mHeapRoot, subHeap, aNow);
+    }
+
+    aTimer.mChild = nullptr;
+    aTimer.mPrev  = nullptr;
+}
+
+bool Timer::Scheduler::IsHeapOrderedBefore(const Timer &aFirst, const Timer &aSecond, Time aNow)
+{
+    // Indicates whether `aFirst` should fire before `aSecond`. Timers
+    // with the same fire time are ordered by their sequence number
+    // (the difference is used so that the wrap of the 32-bit counter
+    // is handled).
+
+    bool retval;
+
+    if (aFirst.GetFireTime() == aSecond.GetFireTime())
+    {
+        retval = (static_cast<int32_t>(aFirst.mSequence - aSecond.mSequence) < 0);
+    }
+    else
+    {
+        retval = aFirst.DoesFireBefore(aSecond, aNow);
+    }
+
+    return retval;
+}
+
+Timer *Timer::Scheduler::Meld(Timer *aFirst, Timer *aSecond, Time aNow)
+{
+    // Melds two heaps (each given by its root) and returns the new
+    // root.
+
+    Timer *root  = aFirst;
+    Timer *child = aSecond;
+
+    VerifyOrExit(root != nullptr, root = aSecond);
+    VerifyOrExit(child != nullptr);
+
+    if (IsHeapOrderedBefore(*child, *root, aNow))
+    {
+        root  = aSecond;
+        child = aFirst;
+    }
+
+    child->mPrev = root;
+    child->mNext = root->mChild;
+
+    if (root->mChild != nullptr)
+    {
+        root->mChild->mPrev = child;
+    }
+
+    root->mChild = child;
+    root->mNext  = nullptr;
+    root->mPrev  = nullptr;
+
+exit:
+    return root;
+}
+
+Timer *Timer::Scheduler::MergePairs(Timer *aFirstSibling, Time aNow)
+{
+    // Standard two-pass pairing: first meld the siblings in pairs
+    // from left to right (pushing each result on a stack linked
+    // through `mNext`), then meld the pairs from right to left.
+
+    Timer *stack = nullptr;
+    Timer *root  = nullptr;
+
+    while (aFirstSibling != nullptr)
+    {
+        Timer *first  = aFirstSibling;
+        Timer *second = first->mNext;
+        Timer *pair;
+
+        aFirstSibling = (second != nullptr) ? second->mNext : nullptr;
+
+        first->mNext = nullptr;
+        first->mPrev = nullptr;
+
+        if (second != nullptr)
+        {
+            second->mNext = nullptr;
+            second->mPrev = nullptr;
+        }
+
+        pair        = Meld(first, second, aNow);
+        pair->mNext = stack;
+        stack       = pair;
+    }
+
+    while (stack != nullptr)
+    {
+        Timer *next = stack->mNext;
+
+        stack->mNext = nullptr;
+        root         = Meld(root, stack, aNow);
+        stack        = next;
+    }
+
+    return root;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -160,15 +353,30 @@ exit:
     return;
 }
 
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    while ((timer = mTimerList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#endif // OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
 void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *timer = GetHead();
+
+    if (timer == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer *  timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -180,7 +388,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -200,18 +408,6 @@ exit:
     return;
 }
 
-void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
-{
-    Timer *timer;
-
-    while ((timer = mTimerList.Pop()) != nullptr)
-    {
-        timer->SetNext(timer);
-    }
-
-    SetAlarm(aAlarmApi);
-}
-
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     Instance *instance = static_cast<Instance *>(aInstance);
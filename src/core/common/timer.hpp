@@ -96,6 +96,11 @@ public:
         , mHandler(aHandler)
         , mFireTime()
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+        , mChild(nullptr)
+        , mPrev(nullptr)
+        , mSequence(0)
+#endif
     {
     }
 
@@ -131,6 +136,10 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+            , mHeapRoot(nullptr)
+            , mNextSequence(0)
+#endif
         {
         }
 
@@ -140,7 +149,31 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+        // The running timers are kept in a pairing heap ordered by
+        // fire time. Each timer uses `mChild` to point to its first
+        // child, `mNext` to point to its next sibling, and `mPrev` to
+        // point to its previous sibling (or its parent if it is the
+        // first child). Timers with the same fire time are ordered by
+        // `mSequence` (assigned when a timer is added) so that they
+        // fire in the order they were started, same as the sorted
+        // list.
+
+        Timer *GetHead(void) { return mHeapRoot; }
+        void   HeapInsert(Timer &aTimer, Time aNow);
+        void   HeapRemove(Timer &aTimer, Time aNow);
+
+        static bool   IsHeapOrderedBefore(const Timer &aFirst, const Timer &aSecond, Time aNow);
+        static Timer *Meld(Timer *aFirst, Timer *aSecond, Time aNow);
+        static Timer *MergePairs(Timer *aFirstSibling, Time aNow);
+
+        Timer *  mHeapRoot;
+        uint32_t mNextSequence;
+#else
+        Timer *GetHead(void) { return mTimerList.GetHead(); }
+
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     bool DoesFireBefore(const Timer &aSecondTimer, Time aNow) const;
@@ -149,6 +182,11 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer * mNext;
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+    Timer *  mChild;
+    Timer *  mPrev;
+    uint32_t mSequence;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -100,6 +100,21 @@
 #define OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS 75
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+ *
+ * Define to 1 to enable an index in the Multicast Listeners Table for finding a Multicast Listener by its address.
+ *
+ * The index is an open-addressing hash table which makes adding (or renewing) and removing a Multicast Listener
+ * constant-time instead of scanning the whole table. It uses about `6` bytes of RAM per Multicast Listener and is
+ * intended for Backbone Routers configured with a large `OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS` (up to 32767 when
+ * the index is enabled), e.g., to serve thousands of Multicast Listeners in large buildings.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NDPROXY_TABLE_ENTRY_NUM
  *
@@ -47,6 +47,34 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+ *
+ * Define to 1 to keep the metadata of pending CoAP requests and cached responses in RAM, indexed by Message ID and
+ * Token, instead of appending it to the tail of each stored message.
+ *
+ * Matching a received response to its request (or a duplicate request to its cached response) then becomes a hash
+ * lookup rather than a scan of all stored messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES
+ *
+ * Number of pending requests (awaiting acknowledgment or response) per CoAP agent that are tracked by the index.
+ *
+ * Only applicable when OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE is set. This does not limit the number of pending
+ * requests: when all entries are in use, the metadata of further requests is appended to the stored message and
+ * responses are matched by scanning all pending requests until these requests complete.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES
+#define OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
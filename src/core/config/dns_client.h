@@ -150,4 +150,45 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_RECURSION_DESIRED_FLAG 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * Responses to address resolution, browse and service instance resolution queries (including negative responses) are
+ * kept until their records' TTL expires and can be read synchronously using the `Lookup{Address/Browse/Service}()`
+ * methods (`otDnsClientLookup{}()` APIs) without sending a new query.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+ *
+ * Specifies the maximum number of responses kept in the DNS client cache.
+ *
+ * Every cached response is kept in a message (using buffers from the shared message pool) until it expires or is
+ * evicted, so this should be sized along with `OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the maximum time (in seconds) a negative response (name does not exist or has no matching record) is kept
+ * in the DNS client cache.
+ *
+ * A negative response is kept for the smallest TTL of the records it contains (e.g., the SOA record in its authority
+ * section), capped by this value. This value is used when the response contains no record.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 60
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
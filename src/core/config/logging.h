@@ -425,4 +425,33 @@
 #define OPENTHREAD_CONFIG_LOG_MAX_SIZE 150
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+ *
+ * Define to 1 to defer the formatting of log lines.
+ *
+ * Instead of formatting a log line when it is emitted, OpenThread then only records the format string pointer and the
+ * raw arguments (copying string arguments) into a lock-free single producer/single consumer ring buffer. The log lines
+ * are formatted and passed to `otPlatLog()` by `otLoggingProcessBinaryLogs()`, or read formatted with
+ * `otLoggingReadBinaryLog()`, which the platform calls outside of time-critical code (e.g., from its main loop or from
+ * a separate thread). Log lines emitted while the buffer is full are dropped.
+ *
+ * The format strings passed to the OpenThread logging functions must then have static storage duration.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+#define OPENTHREAD_CONFIG_LOG_BINARY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+ *
+ * The size (number of bytes) of the ring buffer holding deferred log lines when `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE`
+ * is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE 4096
+#endif
+
 #endif // CONFIG_LOGGING_H_
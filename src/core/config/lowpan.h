@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes compile-time configurations for 6LoWPAN.
+ *
+ */
+
+#ifndef CONFIG_LOWPAN_H_
+#define CONFIG_LOWPAN_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+ *
+ * Define to 1 to enable the 6LoWPAN compression flow cache.
+ *
+ * The flow cache remembers the compressed LOWPAN_IPHC context identifiers and addresses for the most recently
+ * compressed (source, destination) address pairs, so that repeated sends on the same flow skip the context lookups in
+ * Network Data and the address compression. The cache is flushed when Network Data or the Mesh Local Prefix changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENTRIES
+ *
+ * The number of entries in the 6LoWPAN compression flow cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENTRIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+ *
+ * Define to 1 to enable the 6LoWPAN reassembly table.
+ *
+ * The reassembly table indexes the datagrams under reassembly by (source, datagram tag, datagram size) through a hash
+ * table and tracks the received octets of each datagram in a bitmap. This allows "next fragments" to be matched
+ * without scanning the reassembly queue and to be accepted out of order, with duplicate and overlapping fragments
+ * being dropped. It also enables the 6LoWPAN reassembly counters (`otThreadGetReassemblyCounters()`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENTRIES
+ *
+ * The maximum number of datagrams concurrently under reassembly when the reassembly table is enabled.
+ *
+ * When the table is full, the oldest datagram under reassembly is dropped to make room for a new one.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENTRIES
+#define OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENTRIES 8
+#endif
+
+#endif // CONFIG_LOWPAN_H_
@@ -439,4 +439,19 @@
 #define OPENTHREAD_CONFIG_MAC_SCAN_DURATION 300
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+ *
+ * Define to 1 to keep a host-side mirror of the radio source match table.
+ *
+ * With the mirror, clearing the entry of a child whose indirect queue drained is deferred to a tasklet, so an entry
+ * cleared and added again in between (e.g., a new message queued right after the previous one was sent) does not
+ * reach the radio at all. The table capacity learned on the first overflow also avoids adding entries that cannot fit,
+ * and pending entries are added in order of most queued messages first. This mainly saves round trips to an RCP.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+#define OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE 0
+#endif
+
 #endif // CONFIG_MAC_H_
@@ -58,6 +58,20 @@
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define to 1 to enable an index in the child table for finding a child by its RLOC16 or extended address.
+ *
+ * The index is a pair of open-addressing hash tables (one keyed by RLOC16 and one by extended address) which makes
+ * the child lookups constant-time instead of scanning the whole child table. It uses about `8` bytes of RAM per child
+ * and is intended for devices configured with a large `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT
  *
@@ -232,6 +232,19 @@
 #define OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+ *
+ * Define to 1 to collect `Notifier` statistics: the number of emissions including each event, and for every core
+ * module the number of times its handler was invoked or skipped (event mask did not match) and the time spent in it.
+ *
+ * Handler time is measured using `otPlatTimeGet()`, which the platform must then provide.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+#define OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD
  *
@@ -269,6 +282,20 @@
 #define OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+ *
+ * Define to 1 to have the timer schedulers keep running timers in a pairing heap instead of a sorted linked list.
+ *
+ * The pairing heap makes starting a timer O(1) and stopping/firing a timer O(log n) amortized, at the cost of two
+ * extra pointers and a sequence number per `Timer` object. Timers with the same fire time still fire in the order they
+ * were started. It is intended for devices with a large number of concurrently running timers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
  *
@@ -313,6 +340,20 @@
 #define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+ *
+ * Define to 1 to have the internal heap keep its free blocks in segregated size classes (Two-Level Segregated Fit)
+ * instead of a single size-sorted list.
+ *
+ * Allocating and freeing then take constant time regardless of the number of free blocks, at the cost of about 380
+ * bytes of bookkeeping. It is intended for devices with many small, long-lived heap allocations (e.g., an SRP server).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
  *
@@ -377,6 +418,44 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+ *
+ * Define to 1 to keep an in-RAM index (key, offset, length) of the valid records in the flash settings area.
+ *
+ * The index is built while scanning the settings area in `Flash::Init()`. Reading, adding or deleting a value then
+ * needs no scan of the record headers in flash, and compaction copies the live records in contiguous runs.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES
+ *
+ * The maximum number of records in the flash settings index.
+ *
+ * When the settings area holds more valid records, the flash driver falls back to scanning the record headers until
+ * the next compaction.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+ *
+ * Define to 1 to skip the flash write when `Flash::Set()` is called with the value already stored for the key.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -422,6 +501,54 @@
 #define OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES 8
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+ *
+ * Define to 1 to enable fair queueing of direct transmissions in the mesh forwarder send queue.
+ *
+ * Direct transmissions of the same priority are hashed by destination into buckets which are served using Deficit
+ * Round Robin, instead of strictly in FIFO order. A per-destination queue limit is enforced when a message is sent
+ * and message eviction prefers the destination with the most queued messages. Queueing delay histograms are kept
+ * per priority level (`otThreadGetSendQueueStats()`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_BUCKETS
+ *
+ * The number of destination buckets used by fair queueing (MUST be a power of two).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_BUCKETS
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_BUCKETS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_QUANTUM
+ *
+ * The Deficit Round Robin quantum (in octets) granted to a destination bucket on each round.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_QUANTUM
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_QUANTUM 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_DESTINATION_LIMIT
+ *
+ * The maximum number of direct transmissions queued for a single destination bucket.
+ *
+ * When a new message exceeds the limit, the oldest queued message of the same bucket with equal or lower priority is
+ * evicted. Higher priority messages are never evicted by the limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_DESTINATION_LIMIT
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_DESTINATION_LIMIT 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_RADIO_PROPRIETARY_SUPPORT
  *
@@ -119,4 +119,29 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_MAX_ADDRESSES_NUM 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+ *
+ * Define to 1 to index the SRP server registry by host name, service name and service instance name.
+ *
+ * When enabled, host lookups, name conflict checks and DNS-SD PTR/SRV/TXT/AAAA queries resolved from the SRP
+ * registry use hash buckets instead of scanning all hosts and their services.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS
+ *
+ * The number of hash buckets in each of the SRP server name indexes.
+ *
+ * Only applicable when OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS 64
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
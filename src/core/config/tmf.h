@@ -40,6 +40,9 @@
  *
  * The number of EID-to-RLOC cache entries.
  *
+ * Cache lookups are hashed and eviction is O(1), so this can be raised into the hundreds on routers serving many
+ * end devices (e.g., a Border Router).
+ *
  */
 #ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 10
@@ -162,6 +165,43 @@
 #define OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_MAX_ALOCS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+ *
+ * Define to 1 to keep a parsed index of the Prefix TLVs in the Leader Network Data (prefixes, 6LoWPAN contexts,
+ * on-mesh flags and route entries).
+ *
+ * The index is rebuilt lazily on the first lookup after a Network Data change and is used by the context, on-mesh
+ * and route lookups performed for every forwarded or compressed frame, instead of parsing the TLVs each time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_PREFIXES
+ *
+ * The maximum number of Prefix TLVs held by the Network Data lookup index.
+ *
+ * When the Network Data contains more Prefix TLVs (or route entries) than the index can hold, lookups fall back to
+ * parsing the TLVs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_PREFIXES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_ROUTES
+ *
+ * The maximum number of Has Route and default route Border Router entries held by the Network Data lookup index.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_ROUTES
+#define OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_ROUTES 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_MTD_ENABLE
  *
@@ -38,10 +38,39 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
+#include "common/message.hpp"
 
 namespace ot {
 namespace Crypto {
 
+static void XorBytes(uint8_t *aOutput, const uint8_t *aInput1, const uint8_t *aInput2, uint16_t aLength)
+{
+    // Full blocks are XORed a word at a time, partial ones byte by byte.
+
+    if (aLength == AesEcb::kBlockSize)
+    {
+        uint64_t words1[AesEcb::kBlockSize / sizeof(uint64_t)];
+        uint64_t words2[AesEcb::kBlockSize / sizeof(uint64_t)];
+
+        memcpy(words1, aInput1, sizeof(words1));
+        memcpy(words2, aInput2, sizeof(words2));
+
+        for (uint8_t i = 0; i < OT_ARRAY_LENGTH(words1); i++)
+        {
+            words1[i] ^= words2[i];
+        }
+
+        memcpy(aOutput, words1, sizeof(words1));
+    }
+    else
+    {
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            aOutput[i] = aInput1[i] ^ aInput2[i];
+        }
+    }
+}
+
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     Key cryptoKey;
@@ -121,7 +150,7 @@ void AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeyedEcb->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -160,21 +189,10 @@ void AesCcm::Init(uint32_t    aHeaderLength,
 
 void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
 {
-    const uint8_t *headerBytes = reinterpret_cast<const uint8_t *>(aHeader);
-
     OT_ASSERT(mHeaderCur + aHeaderLength <= mHeaderLength);
 
     // process header
-    for (unsigned i = 0; i < aHeaderLength; i++)
-    {
-        if (mBlockLength == sizeof(mBlock))
-        {
-            mEcb.Encrypt(mBlock, mBlock);
-            mBlockLength = 0;
-        }
-
-        mBlock[mBlockLength++] ^= headerBytes[i];
-    }
+    UpdateBlock(reinterpret_cast<const uint8_t *>(aHeader), aHeaderLength);
 
     mHeaderCur += aHeaderLength;
 
@@ -183,7 +201,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyedEcb->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -194,13 +212,21 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
-    uint8_t  byte;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    mPlainTextCur += aLength;
+
+    // The payload is processed up to a block (key stream pad) at a
+    // time. The CBC-MAC is always computed over the plaintext, so on
+    // encrypt it is updated before the (possibly in place) encryption
+    // and on decrypt after it.
+
+    while (aLength > 0)
     {
-        if (mCtrLength == 16)
+        uint16_t length;
+
+        if (mCtrLength == sizeof(mCtrPad))
         {
             for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
             {
@@ -210,37 +236,34 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeyedEcb->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
+        length = static_cast<uint16_t>(OT_MIN(aLength, static_cast<uint32_t>(sizeof(mCtrPad) - mCtrLength)));
+
         if (aMode == kEncrypt)
         {
-            byte               = plaintextBytes[i];
-            ciphertextBytes[i] = byte ^ mCtrPad[mCtrLength++];
+            UpdateBlock(plaintextBytes, length);
+            XorBytes(ciphertextBytes, plaintextBytes, &mCtrPad[mCtrLength], length);
         }
         else
         {
-            byte              = ciphertextBytes[i] ^ mCtrPad[mCtrLength++];
-            plaintextBytes[i] = byte;
+            XorBytes(plaintextBytes, ciphertextBytes, &mCtrPad[mCtrLength], length);
+            UpdateBlock(plaintextBytes, length);
         }
 
-        if (mBlockLength == sizeof(mBlock))
-        {
-            mEcb.Encrypt(mBlock, mBlock);
-            mBlockLength = 0;
-        }
-
-        mBlock[mBlockLength++] ^= byte;
+        mCtrLength += length;
+        plaintextBytes += length;
+        ciphertextBytes += length;
+        aLength -= length;
     }
 
-    mPlainTextCur += aLength;
-
     if (mPlainTextCur >= mPlainTextLength)
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyedEcb->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -248,13 +271,53 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     }
 }
 
+void AesCcm::UpdateBlock(const uint8_t *aData, uint32_t aLength)
+{
+    // Adds data to the CBC-MAC. The block is encrypted once full and
+    // more data follows (the last block is encrypted by the caller).
+
+    while (aLength > 0)
+    {
+        uint16_t length;
+
+        if (mBlockLength == sizeof(mBlock))
+        {
+            mKeyedEcb->Encrypt(mBlock, mBlock);
+            mBlockLength = 0;
+        }
+
+        length = static_cast<uint16_t>(OT_MIN(aLength, static_cast<uint32_t>(sizeof(mBlock) - mBlockLength)));
+
+        XorBytes(&mBlock[mBlockLength], &mBlock[mBlockLength], aData, length);
+
+        mBlockLength += length;
+        aData += length;
+        aLength -= length;
+    }
+}
+
+#if !OPENTHREAD_RADIO
+void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode)
+{
+    Message::WritableChunk chunk;
+
+    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.GetLength() > 0)
+    {
+        Payload(chunk.GetData(), chunk.GetData(), chunk.GetLength(), aMode);
+        aMessage.GetNextChunk(aLength, chunk);
+    }
+}
+#endif
+
 void AesCcm::Finalize(void *aTag)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aTag);
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    mKeyedEcb->Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
@@ -45,6 +45,9 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+class Message;
+
 namespace Crypto {
 
 /**
@@ -75,13 +78,36 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void)
+        : mKeyedEcb(&mEcb)
+    {
+    }
+
     /**
      * This method sets the key.
      *
      * @param[in]  aKey    Crypto Key used in AES operation
      *
      */
-    void SetKey(const Key &aKey) { mEcb.SetKey(aKey); }
+    void SetKey(const Key &aKey)
+    {
+        mEcb.SetKey(aKey);
+        mKeyedEcb = &mEcb;
+    }
+
+    /**
+     * This method sets the key using an `AesEcb` which already holds the expanded key (e.g., a cached key schedule).
+     *
+     * This avoids expanding the key again. @p aKeyedEcb MUST stay valid and keyed while this `AesCcm` is in use.
+     *
+     * @param[in]  aKeyedEcb  An `AesEcb` with the key set.
+     *
+     */
+    void SetKey(AesEcb &aKeyedEcb) { mKeyedEcb = &aKeyedEcb; }
 
     /**
      * This method sets the key.
@@ -136,6 +162,21 @@ public:
      */
     void Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode aMode);
 
+#if !OPENTHREAD_RADIO
+    /**
+     * This method processes the payload in place within a message.
+     *
+     * The message buffers are processed directly, without copying the payload to a separate buffer.
+     *
+     * @param[inout]  aMessage  A reference to the message.
+     * @param[in]     aOffset   Offset in @p aMessage to the start of the payload.
+     * @param[in]     aLength   Payload length in bytes.
+     * @param[in]     aMode     Mode to indicate whether to encrypt (`kEncrypt`) or decrypt (`kDecrypt`).
+     *
+     */
+    void Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode);
+#endif
+
     /**
      * This method returns the tag length in bytes.
      *
@@ -167,7 +208,10 @@ public:
                               uint8_t *              aNonce);
 
 private:
+    void UpdateBlock(const uint8_t *aData, uint32_t aLength);
+
     AesEcb   mEcb;
+    AesEcb * mKeyedEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
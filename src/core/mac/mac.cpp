@@ -1709,7 +1709,17 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         OT_UNREACHABLE_CODE(break);
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+    if (macKey == &mLinks.GetSubMac().GetCurrentMacKey())
+    {
+        // Reuse the key schedule expanded by `SubMac` for the current MAC key.
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, mLinks.GetSubMac().GetCurrentMacKeyEcb()));
+    }
+    else
+#endif
+    {
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    }
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
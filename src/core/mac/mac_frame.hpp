@@ -44,6 +44,12 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+namespace Crypto {
+class AesCcm;
+class AesEcb;
+} // namespace Crypto
+
 namespace Mac {
 
 using ot::Encoding::LittleEndian::HostSwap16;
@@ -1168,6 +1174,19 @@ public:
      */
     Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
 
+    /**
+     * This method performs AES CCM on the frame which is received, using a cached key schedule of the MAC key.
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aKeyedEcb    An `AesEcb` keyed with the MAC key to decrypt the received frame.
+     *
+     * @retval kErrorNone      Process of received frame AES CCM succeeded.
+     * @retval kErrorSecurity  Received frame MIC check failed.
+     *
+     */
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb &aKeyedEcb);
+
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
      * This method gets the offset to network time.
@@ -1188,6 +1207,9 @@ public:
      */
     uint8_t ReadTimeSyncSeq(void) const { return GetTimeIe()->GetSequence(); }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+
+private:
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
 };
 
 /**
@@ -1314,6 +1336,16 @@ public:
      */
     void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
 
+    /**
+     * This method performs AES CCM on the frame which is going to be sent, using a cached key schedule of the MAC key.
+     *
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aKeyedEcb    An `AesEcb` keyed with the frame's MAC key (`GetAesKey()`).
+     *
+     */
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb &aKeyedEcb);
+
     /**
      * This method indicates whether or not the frame has security processed.
      *
@@ -1428,6 +1460,9 @@ public:
      */
     void SetTxDelayBaseTime(uint32_t aTxDelayBaseTime) { mInfo.mTxInfo.mTxDelayBaseTime = aTxDelayBaseTime; }
 #endif
+
+private:
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
 };
 
 OT_TOOL_PACKED_BEGIN
@@ -356,12 +356,20 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
-    mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, mCurrKeyEcb);
 
 exit:
     return;
 }
 
+void SubMac::UpdateCurrentMacKeyEcb(void)
+{
+    Crypto::Key key;
+
+    mCurrKey.ConvertToCryptoKey(key);
+    mCurrKeyEcb.SetKey(key);
+}
+
 void SubMac::StartCsmaBackoff(void)
 {
     uint32_t backoff;
@@ -845,6 +853,7 @@ void SubMac::SetMacKey(uint8_t            aKeyIdMode,
         mPrevKey = aPrevKey;
         mCurrKey = aCurrKey;
         mNextKey = aNextKey;
+        UpdateCurrentMacKeyEcb();
         break;
 
     default:
@@ -43,6 +43,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "mac/mac_frame.hpp"
 #include "radio/radio.hpp"
 
@@ -508,6 +509,17 @@ public:
      */
     const KeyMaterial &GetCurrentMacKey(void) const { return mCurrKey; }
 
+    /**
+     * This method returns a reference to an AES-ECB context keyed with the current MAC key.
+     *
+     * The key schedule is expanded once when the MAC keys are set, so that it can be reused to secure every frame
+     * using the current MAC key.
+     *
+     * @returns A reference to the AES-ECB context keyed with the current MAC key.
+     *
+     */
+    Crypto::AesEcb &GetCurrentMacKeyEcb(void) { return mCurrKeyEcb; }
+
     /**
      * This method returns a reference to the previous MAC key.
      *
@@ -612,6 +624,7 @@ private:
 
     void ProcessTransmitSecurity(void);
     void UpdateFrameCounter(uint32_t aFrameCounter);
+    void UpdateCurrentMacKeyEcb(void);
     void StartCsmaBackoff(void);
     void BeginTransmit(void);
     void SampleRssi(void);
@@ -647,6 +660,7 @@ private:
     KeyMaterial        mPrevKey;
     KeyMaterial        mCurrKey;
     KeyMaterial        mNextKey;
+    Crypto::AesEcb     mCurrKeyEcb;
     uint32_t           mFrameCounter;
     uint8_t            mKeyId;
 #if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
@@ -135,6 +135,8 @@ private:
         uint8_t  mToken[Coap::Message::kMaxTokenLength]; // The CoAP Token of the original request.
     };
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventCommissionerStateChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     Coap::Message::Code CoapCodeFromError(Error aError);
@@ -125,6 +125,8 @@ private:
     // Retry interval (in ms) when preparing and/or sending Pending Dataset fails.
     static constexpr uint32_t kRetryInterval = 1000;
 
+    static constexpr Events::Flags kNotifierEvents = kEventActiveDatasetChanged | kEventPendingDatasetChanged;
+
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
     void        PreparePendingDataset(void);
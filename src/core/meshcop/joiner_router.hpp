@@ -96,6 +96,8 @@ private:
         Kek              mKek;         // KEK used by MAC layer to encode this message.
     };
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
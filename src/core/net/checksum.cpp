@@ -33,7 +33,10 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
 #include "net/tcp6.hpp"
@@ -69,10 +72,69 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The data is summed a word at a time into a wide accumulator
+    // (RFC 1071). The one's complement sum is independent of byte
+    // order, so words are read in host order and the folded result is
+    // swapped back to big-endian. Since the sum of 32-bit words is
+    // congruent (modulo 0xffff) to the sum of their 16-bit halves,
+    // 32-bit words are used. A `uint16_t` length bounds the number
+    // of words so the 64-bit accumulator cannot overflow.
+
+    uint64_t sum = 0;
+    uint32_t word;
+    uint32_t value;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    for (; aLength >= 4 * sizeof(uint32_t); aLength -= 4 * sizeof(uint32_t), aBuffer += 4 * sizeof(uint32_t))
+    {
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        memcpy(&word, aBuffer + sizeof(uint32_t), sizeof(word));
+        sum += word;
+        memcpy(&word, aBuffer + 2 * sizeof(uint32_t), sizeof(word));
+        sum += word;
+        memcpy(&word, aBuffer + 3 * sizeof(uint32_t), sizeof(word));
+        sum += word;
+    }
+
+    for (; aLength >= sizeof(uint32_t); aLength -= sizeof(uint32_t), aBuffer += sizeof(uint32_t))
+    {
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+    }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        uint16_t halfWord;
+
+        memcpy(&halfWord, aBuffer, sizeof(halfWord));
+        sum += halfWord;
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    while (sum > 0xffff)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    value  = mValue + Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum));
+    mValue = static_cast<uint16_t>((value & 0xffff) + (value >> 16));
+
+    if (aLength > 0)
     {
-        AddUint8(aBuffer[i]);
+        AddUint8(*aBuffer);
     }
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
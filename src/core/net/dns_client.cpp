@@ -35,6 +35,7 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/logging.hpp"
+#include "common/numeric_limits.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_data_types.hpp"
 #include "thread/thread_netif.hpp"
@@ -573,6 +574,10 @@ Client::Client(Instance &aInstance)
     static_assert(kBrowseQuery == 1, "kBrowseQuery value is not correct");
     static_assert(kServiceQuery == 2, "kServiceQuery value is not correct");
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ResetCacheCounters();
+#endif
 }
 
 Error Client::Start(void)
@@ -595,6 +600,10 @@ void Client::Stop(void)
         FinalizeQuery(*query, kErrorAbort);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ClearCache();
+#endif
+
     IgnoreError(mSocket.Close());
 }
 
@@ -647,6 +656,17 @@ Error Client::ResolveAddress(const char *       aHostName,
     return StartQuery(info, aConfig, nullptr, aHostName, aContext);
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+Error Client::LookupAddress(const char *aHostName, AddressCallback aCallback, void *aContext)
+{
+    Callback callback;
+
+    callback.mAddressCallback = aCallback;
+
+    return Lookup(kIp6AddressQuery, nullptr, aHostName, callback, aContext);
+}
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
 Error Client::Browse(const char *aServiceName, BrowseCallback aCallback, void *aContext, const QueryConfig *aConfig)
@@ -681,6 +701,37 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+Error Client::LookupBrowse(const char *aServiceName, BrowseCallback aCallback, void *aContext)
+{
+    Callback callback;
+
+    callback.mBrowseCallback = aCallback;
+
+    return Lookup(kBrowseQuery, nullptr, aServiceName, callback, aContext);
+}
+
+Error Client::LookupService(const char *    aInstanceLabel,
+                            const char *    aServiceName,
+                            ServiceCallback aCallback,
+                            void *          aContext)
+{
+    Error    error;
+    Callback callback;
+
+    VerifyOrExit(aInstanceLabel != nullptr, error = kErrorInvalidArgs);
+
+    callback.mServiceCallback = aCallback;
+
+    error = Lookup(kServiceQuery, aInstanceLabel, aServiceName, callback, aContext);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
 Error Client::StartQuery(QueryInfo &        aInfo,
@@ -859,37 +910,45 @@ void Client::FinalizeQuery(Response &aResponse, QueryType aType, Error aError)
     void *   context;
 
     GetCallback(*aResponse.mQuery, callback, context);
+    InvokeCallback(aResponse, aType, aError, callback, context);
 
+    FreeQuery(*aResponse.mQuery);
+}
+
+void Client::InvokeCallback(Response &      aResponse,
+                            QueryType       aType,
+                            Error           aError,
+                            const Callback &aCallback,
+                            void *          aContext)
+{
     switch (aType)
     {
     case kIp6AddressQuery:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
     case kIp4AddressQuery:
 #endif
-        if (callback.mAddressCallback != nullptr)
+        if (aCallback.mAddressCallback != nullptr)
         {
-            callback.mAddressCallback(aError, &aResponse, context);
+            aCallback.mAddressCallback(aError, &aResponse, aContext);
         }
         break;
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
     case kBrowseQuery:
-        if (callback.mBrowseCallback != nullptr)
+        if (aCallback.mBrowseCallback != nullptr)
         {
-            callback.mBrowseCallback(aError, &aResponse, context);
+            aCallback.mBrowseCallback(aError, &aResponse, aContext);
         }
         break;
 
     case kServiceQuery:
-        if (callback.mServiceCallback != nullptr)
+        if (aCallback.mServiceCallback != nullptr)
         {
-            callback.mServiceCallback(aError, &aResponse, context);
+            aCallback.mServiceCallback(aError, &aResponse, aContext);
         }
         break;
 #endif
     }
-
-    FreeQuery(*aResponse.mQuery);
 }
 
 void Client::GetCallback(const Query &aQuery, Callback &aCallback, void *&aContext)
@@ -942,6 +1001,11 @@ void Client::ProcessResponse(const Message &aMessage)
     // finalizing the query and invoking the user's callback.
 
     SuccessOrExit(ParseResponse(response, type, responseError));
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    UpdateCache(response, responseError);
+#endif
+
     FinalizeQuery(response, type, responseError);
 
 exit:
@@ -1095,6 +1159,270 @@ void Client::HandleTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void Client::ClearCache(void)
+{
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        if (entry.IsInUse())
+        {
+            FreeCacheEntry(entry);
+        }
+    }
+}
+
+Error Client::Lookup(QueryType aType, const char *aLabel, const char *aName, const Callback &aCallback, void *aContext)
+{
+    Error       error = kErrorNone;
+    CacheEntry *entry;
+    uint32_t    elapsed;
+
+    VerifyOrExit(aName != nullptr, error = kErrorInvalidArgs);
+
+    entry = FindCacheEntry(aType, aLabel, Name(aName));
+
+    if (entry == nullptr)
+    {
+        mCacheCounters.mMisses++;
+        ExitNow(error = kErrorNotFound);
+    }
+
+    mCacheCounters.mHits++;
+
+    if (entry->mIsNegative)
+    {
+        mCacheCounters.mNegativeHits++;
+    }
+
+    // Age the record TTLs in the cached response so that the
+    // callback reports the remaining TTLs (in whole seconds).
+
+    elapsed = (TimerMilli::GetNow() - entry->mAgeTime) / Time::SecToMsec(1);
+
+    if (elapsed > 0)
+    {
+        IgnoreReturnValue(AgeRecords(*entry->mResponse.mQuery, entry->mResponse.mAnswerOffset, elapsed));
+        entry->mAgeTime += Time::SecToMsec(elapsed);
+    }
+
+    InvokeCallback(entry->mResponse, aType, entry->mResponseError, aCallback, aContext);
+
+exit:
+    return error;
+}
+
+Client::CacheEntry *Client::FindCacheEntry(QueryType aType, const char *aLabel, const Name &aName)
+{
+    // This method searches for a cached response matching the query
+    // type and name (`aName` prefixed by `aLabel` when not `nullptr`).
+    // Expired entries are freed while searching.
+
+    TimeMilli   now   = TimerMilli::GetNow();
+    CacheEntry *match = nullptr;
+    QueryInfo   info;
+    uint16_t    offset;
+
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        if (now >= entry.mExpireTime)
+        {
+            FreeCacheEntry(entry);
+            continue;
+        }
+
+        if (match != nullptr)
+        {
+            continue;
+        }
+
+        info.ReadFrom(*entry.mResponse.mQuery);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+        // An IPv6 address query may have been resolved by an IPv4
+        // address query (NAT64).
+        if (info.mQueryType == kIp4AddressQuery)
+        {
+            info.mQueryType = kIp6AddressQuery;
+        }
+#endif
+
+        offset = kNameOffsetInQuery;
+
+        if ((info.mQueryType != aType) ||
+            ((aLabel != nullptr) && (Name::CompareLabel(*entry.mResponse.mQuery, offset, aLabel) != kErrorNone)) ||
+            (Name::CompareName(*entry.mResponse.mQuery, offset, aName) != kErrorNone))
+        {
+            continue;
+        }
+
+        match = &entry;
+    }
+
+    return match;
+}
+
+Client::CacheEntry &Client::AllocateCacheEntry(void)
+{
+    // This method returns an unused entry, otherwise it evicts the
+    // entry closest to its expiration.
+
+    CacheEntry *entry = &mCacheEntries[0];
+
+    for (CacheEntry &candidate : mCacheEntries)
+    {
+        if (!candidate.IsInUse())
+        {
+            ExitNow(entry = &candidate);
+        }
+
+        if (candidate.mExpireTime < entry->mExpireTime)
+        {
+            entry = &candidate;
+        }
+    }
+
+    FreeCacheEntry(*entry);
+    mCacheCounters.mEvictions++;
+
+exit:
+    return *entry;
+}
+
+void Client::FreeCacheEntry(CacheEntry &aEntry)
+{
+    aEntry.mResponse.mQuery->Free();
+    aEntry.mResponse.Clear();
+}
+
+void Client::UpdateCache(const Response &aResponse, Error aResponseError)
+{
+    // This method saves a copy of the query along with the received
+    // response in the cache, replacing any earlier response to the
+    // same query. Successful and negative (name does not exist or no
+    // answer) responses are cached for the smallest TTL of their
+    // records. Other errors from server are not cached.
+
+    const Message &response       = *aResponse.mMessage;
+    Message *      message        = nullptr;
+    CacheEntry *   entry          = nullptr;
+    uint16_t       responseOffset = 0;
+    bool           isNegative;
+    uint32_t       ttl;
+    QueryInfo      info;
+
+    VerifyOrExit((aResponseError == kErrorNone) || (aResponseError == kErrorNotFound));
+
+    info.ReadFrom(*aResponse.mQuery);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    if (info.mQueryType == kIp4AddressQuery)
+    {
+        info.mQueryType = kIp6AddressQuery;
+    }
+#endif
+
+    entry = FindCacheEntry(info.mQueryType, nullptr, Name(*aResponse.mQuery, kNameOffsetInQuery));
+
+    if (entry != nullptr)
+    {
+        FreeCacheEntry(*entry);
+    }
+
+    message = aResponse.mQuery->Clone();
+    VerifyOrExit(message != nullptr);
+
+    responseOffset = message->GetLength();
+    SuccessOrExit(message->AppendBytesFromMessage(response, response.GetOffset(),
+                                                  response.GetLength() - response.GetOffset()));
+    message->SetOffset(responseOffset);
+
+    isNegative = (aResponseError == kErrorNotFound) || (aResponse.mAnswerRecordCount == 0);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    isNegative = isNegative && !aResponse.mIp6QueryResponseRequiresNat64;
+#endif
+
+    ttl = AgeRecords(*message, aResponse.mAnswerOffset - response.GetOffset() + responseOffset, /* aElapsed */ 0);
+
+    if (isNegative)
+    {
+        ttl = OT_MIN(ttl, kCacheNegativeTtl);
+    }
+
+    ttl = OT_MIN(ttl, kCacheMaxTtl);
+    VerifyOrExit(ttl > 0);
+
+    entry = &AllocateCacheEntry();
+
+    entry->mResponse                   = aResponse;
+    entry->mResponse.mQuery            = message;
+    entry->mResponse.mMessage          = message;
+    entry->mResponse.mAnswerOffset     = aResponse.mAnswerOffset - response.GetOffset() + responseOffset;
+    entry->mResponse.mAdditionalOffset = aResponse.mAdditionalOffset - response.GetOffset() + responseOffset;
+    entry->mResponseError              = aResponseError;
+    entry->mIsNegative                 = isNegative;
+    entry->mAgeTime                    = TimerMilli::GetNow();
+    entry->mExpireTime                 = entry->mAgeTime + Time::SecToMsec(ttl);
+
+    message = nullptr;
+
+exit:
+    FreeMessage(message);
+}
+
+uint32_t Client::AgeRecords(Message &aMessage, uint16_t aOffset, uint32_t aElapsed)
+{
+    // This method reduces the TTL of all records in the answer,
+    // authority and additional data sections of a cached response
+    // (`aOffset` pointing to the answer section) by `aElapsed`
+    // seconds. The OPT record is skipped since its TTL field has a
+    // different meaning. It returns the smallest TTL, or zero if the
+    // records cannot be parsed.
+
+    uint32_t       minTtl = NumericLimits<uint32_t>::kMax;
+    uint32_t       numRecords;
+    uint32_t       ttl;
+    Header         header;
+    ResourceRecord record;
+
+    VerifyOrExit(aMessage.Read(aMessage.GetOffset(), header) == kErrorNone, minTtl = 0);
+
+    numRecords = static_cast<uint32_t>(header.GetAnswerCount()) + header.GetAuthorityRecordCount() +
+                 header.GetAdditionalRecordCount();
+
+    for (; numRecords > 0; numRecords--)
+    {
+        VerifyOrExit(Name::ParseName(aMessage, aOffset) == kErrorNone, minTtl = 0);
+        VerifyOrExit(aMessage.Read(aOffset, record) == kErrorNone, minTtl = 0);
+
+        if (record.GetType() != ResourceRecord::kTypeOpt)
+        {
+            ttl = (record.GetTtl() > aElapsed) ? (record.GetTtl() - aElapsed) : 0;
+
+            if (aElapsed != 0)
+            {
+                record.SetTtl(ttl);
+                aMessage.Write(aOffset, record);
+            }
+
+            minTtl = OT_MIN(minTtl, ttl);
+        }
+
+        aOffset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return minTtl;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
@@ -33,6 +33,8 @@
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
 
+#include <string.h>
+
 #include <openthread/dns_client.h>
 
 #include "common/clearable.hpp"
@@ -608,6 +610,25 @@ public:
                          void *             aContext,
                          const QueryConfig *aConfig = nullptr);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * This method looks up a cached response to an address resolution query for a given host name.
+     *
+     * On a cache hit, @p aCallback is invoked with the cached response before this method returns, the same way it is
+     * invoked for a response received from the server. The TTLs reported from the cached response are reduced by the
+     * time spent in the cache. No query is sent on a cache miss.
+     *
+     * @param[in]  aHostName        The host name to look up (MUST NOT be `nullptr`).
+     * @param[in]  aCallback        A callback function pointer to report the cached response.
+     * @param[in]  aContext         A pointer to arbitrary context information passed to @p aCallback.
+     *
+     * @retval kErrorNone       A cached response was found and reported through @p aCallback.
+     * @retval kErrorNotFound   There is no unexpired cached response for @p aHostName.
+     *
+     */
+    Error LookupAddress(const char *aHostName, AddressCallback aCallback, void *aContext);
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
     /**
@@ -656,8 +677,66 @@ public:
                          void *               aContext,
                          const QueryConfig *  aConfig = nullptr);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * This method looks up a cached response to a browse (service instance enumeration) query for a given service name.
+     *
+     * On a cache hit, @p aCallback is invoked with the cached response before this method returns. No query is sent on
+     * a cache miss.
+     *
+     * @param[in]  aServiceName     The service name to look up (MUST NOT be `nullptr`).
+     * @param[in]  aCallback        The callback to report the cached response.
+     * @param[in]  aContext         A pointer to arbitrary context information.
+     *
+     * @retval kErrorNone       A cached response was found and reported through @p aCallback.
+     * @retval kErrorNotFound   There is no unexpired cached response for @p aServiceName.
+     *
+     */
+    Error LookupBrowse(const char *aServiceName, BrowseCallback aCallback, void *aContext);
+
+    /**
+     * This method looks up a cached response to a service instance resolution query for a given service instance.
+     *
+     * On a cache hit, @p aCallback is invoked with the cached response before this method returns. No query is sent on
+     * a cache miss.
+     *
+     * @param[in]  aInstanceLabel     The service instance label.
+     * @param[in]  aServiceName       The service name (together with @p aInstanceLabel form full instance name).
+     * @param[in]  aCallback          The callback to report the cached response.
+     * @param[in]  aContext           A pointer to arbitrary context information.
+     *
+     * @retval kErrorNone         A cached response was found and reported through @p aCallback.
+     * @retval kErrorNotFound     There is no unexpired cached response for the service instance.
+     * @retval kErrorInvalidArgs  @p aInstanceLabel is `nullptr`.
+     *
+     */
+    Error LookupService(const char *aInstanceLabel, const char *aServiceName, ServiceCallback aCallback, void *aContext);
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * This method gets the DNS client cache counters.
+     *
+     * @returns A reference to the cache counters.
+     *
+     */
+    const otDnsCacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * This method resets the DNS client cache counters.
+     *
+     */
+    void ResetCacheCounters(void) { memset(&mCacheCounters, 0, sizeof(mCacheCounters)); }
+
+    /**
+     * This method removes all responses from the DNS client cache.
+     *
+     */
+    void ClearCache(void);
+#endif
+
 private:
     enum QueryType : uint8_t
     {
@@ -698,6 +777,28 @@ private:
 
     static constexpr uint16_t kNameOffsetInQuery = sizeof(QueryInfo);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    static constexpr uint16_t kCacheEntries     = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES;
+    static constexpr uint32_t kCacheNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL; // in sec
+    static constexpr uint32_t kCacheMaxTtl      = TimerMilli::kMaxDelay / 1000;                    // in sec
+
+    struct CacheEntry // A cached response.
+    {
+        // `mResponse.mQuery` and `mResponse.mMessage` both point to
+        // the same message, a copy of the query (`QueryInfo` and the
+        // name) followed by the response (starting at the message
+        // offset). The entry is unused when `mQuery` is `nullptr`.
+
+        bool IsInUse(void) const { return mResponse.mQuery != nullptr; }
+
+        Response  mResponse;
+        Error     mResponseError;
+        bool      mIsNegative;
+        TimeMilli mExpireTime;
+        TimeMilli mAgeTime; // The time up to which the record TTLs in the message are aged.
+    };
+#endif
+
     Error       StartQuery(QueryInfo &        aInfo,
                            const QueryConfig *aConfig,
                            const char *       aLabel,
@@ -709,6 +810,11 @@ private:
     void        SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer);
     void        FinalizeQuery(Query &aQuery, Error aError);
     void        FinalizeQuery(Response &Response, QueryType aType, Error aError);
+    static void InvokeCallback(Response &      aResponse,
+                               QueryType       aType,
+                               Error           aError,
+                               const Callback &aCallback,
+                               void *          aContext);
     static void GetCallback(const Query &aQuery, Callback &aCallback, void *&aContext);
     Error       AppendNameFromQuery(const Query &aQuery, Message &aMessage);
     Query *     FindQueryById(uint16_t aMessageId);
@@ -723,6 +829,18 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     void UpdateDefaultConfigAddress(void);
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Error           Lookup(QueryType       aType,
+                           const char *    aLabel,
+                           const char *    aName,
+                           const Callback &aCallback,
+                           void *          aContext);
+    CacheEntry *    FindCacheEntry(QueryType aType, const char *aLabel, const Name &aName);
+    CacheEntry &    AllocateCacheEntry(void);
+    void            FreeCacheEntry(CacheEntry &aEntry);
+    void            UpdateCache(const Response &aResponse, Error aResponseError);
+    static uint32_t AgeRecords(Message &aMessage, uint16_t aOffset, uint32_t aElapsed);
+#endif
 
     static const uint8_t   kQuestionCount[];
     static const uint16_t *kQuestionRecordTypes[];
@@ -743,6 +861,10 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     bool mUserDidSetDefaultAddress;
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    CacheEntry         mCacheEntries[kCacheEntries];
+    otDnsCacheCounters mCacheCounters;
+#endif
 };
 
 } // namespace Dns
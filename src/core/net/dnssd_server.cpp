@@ -687,11 +687,60 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                                               NameCompressInfo &aCompressInfo,
                                               bool              aAdditional)
 {
-    Error                    error    = kErrorNone;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    Error            error    = kErrorNone;
+    uint16_t         qtype    = aQuestion.GetType();
+    Header::Response response = Header::kResponseNameError;
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    // The SRP server name index yields only the services (or host)
+    // matching `aName`. Services of the same host are returned
+    // adjacently, so the additional AAAA records of a host are
+    // appended once after its last matching service.
+
+    if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+    {
+        const Srp::Server::Service *next;
+        bool                        needAdditionalAaaaRecord = false;
+
+        for (const Srp::Server::Service *service = FindNextSrpService(aName, qtype, nullptr); service != nullptr;
+             service                             = next)
+        {
+            const Srp::Server::Host &host = service->GetHost();
+
+            next = FindNextSrpService(aName, qtype, service);
+
+            SuccessOrExit(error = ResolveSrpService(aName, qtype, *service, aResponseHeader, aResponseMessage,
+                                                    aCompressInfo, aAdditional, needAdditionalAaaaRecord, response));
+
+            if ((next != nullptr) && (&next->GetHost() == &host))
+            {
+                continue;
+            }
+
+            if (aAdditional && needAdditionalAaaaRecord &&
+                !HasQuestion(aResponseHeader, aResponseMessage, host.GetFullName(), ResourceRecord::kTypeAaaa))
+            {
+                SuccessOrExit(error = AppendSrpHostAddresses(host, aResponseHeader, aResponseMessage, aCompressInfo,
+                                                             aAdditional));
+                response = Header::kResponseSuccess;
+            }
+
+            needAdditionalAaaaRecord = false;
+        }
+    }
+    else if (!aAdditional && qtype == ResourceRecord::kTypeAaaa)
+    {
+        const Srp::Server::Host *host = Get<Srp::Server>().FindHost(aName);
+
+        if ((host != nullptr) && !host->IsDeleted())
+        {
+            SuccessOrExit(
+                error = AppendSrpHostAddresses(*host, aResponseHeader, aResponseMessage, aCompressInfo, aAdditional));
+            response = Header::kResponseSuccess;
+        }
+    }
+#else
+    const Srp::Server::Host *host = nullptr;
 
     while ((host = GetNextSrpHost(host)) != nullptr)
     {
@@ -705,47 +754,9 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
 
             while ((service = GetNextSrpService(*host, service)) != nullptr)
             {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetInstanceName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = service->MatchesInstanceName(aName);
-                bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
-                bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
-                bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
-
-                if (!aAdditional && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-
-                if ((!aAdditional && srvQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-
-                if ((!aAdditional && txtQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
-                {
-                    SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
+                SuccessOrExit(error = ResolveSrpService(aName, qtype, *service, aResponseHeader, aResponseMessage,
+                                                        aCompressInfo, aAdditional, needAdditionalAaaaRecord,
+                                                        response));
             }
         }
 
@@ -754,24 +765,94 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
             (aAdditional && needAdditionalAaaaRecord &&
              !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa)))
         {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
-
-            for (uint8_t i = 0; i < addrNum; i++)
-            {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
-                IncResourceRecordCount(aResponseHeader, aAdditional);
-            }
-
+            SuccessOrExit(
+                error = AppendSrpHostAddresses(*host, aResponseHeader, aResponseMessage, aCompressInfo, aAdditional));
             response = Header::kResponseSuccess;
         }
     }
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
 
 exit:
     return error == kErrorNone ? response : Header::kResponseServerFailure;
 }
 
+Error Server::ResolveSrpService(const char *                aName,
+                                uint16_t                    aQueryType,
+                                const Srp::Server::Service &aService,
+                                Header &                    aResponseHeader,
+                                Message &                   aResponseMessage,
+                                NameCompressInfo &          aCompressInfo,
+                                bool                        aAdditional,
+                                bool &                      aNeedAdditionalAaaaRecord,
+                                Header::Response &          aResponse)
+{
+    Error       error               = kErrorNone;
+    uint32_t    instanceTtl         = TimeMilli::MsecToSec(aService.GetExpireTime() - TimerMilli::GetNow());
+    const char *instanceName        = aService.GetInstanceName();
+    bool        serviceNameMatched  = aService.MatchesServiceName(aName);
+    bool        instanceNameMatched = aService.MatchesInstanceName(aName);
+    bool        ptrQueryMatched     = aQueryType == ResourceRecord::kTypePtr && serviceNameMatched;
+    bool        srvQueryMatched     = aQueryType == ResourceRecord::kTypeSrv && instanceNameMatched;
+    bool        txtQueryMatched     = aQueryType == ResourceRecord::kTypeTxt && instanceNameMatched;
+
+    if (ptrQueryMatched || srvQueryMatched)
+    {
+        aNeedAdditionalAaaaRecord = true;
+    }
+
+    if (!aAdditional && ptrQueryMatched)
+    {
+        SuccessOrExit(error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
+        aResponse = Header::kResponseSuccess;
+    }
+
+    if ((!aAdditional && srvQueryMatched) ||
+        (aAdditional && ptrQueryMatched &&
+         !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
+    {
+        SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, aService.GetHost().GetFullName(),
+                                              instanceTtl, aService.GetPriority(), aService.GetWeight(),
+                                              aService.GetPort(), aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
+        aResponse = Header::kResponseSuccess;
+    }
+
+    if ((!aAdditional && txtQueryMatched) ||
+        (aAdditional && ptrQueryMatched &&
+         !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
+    {
+        SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, aService.GetTxtData(),
+                                              aService.GetTxtDataLength(), instanceTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
+        aResponse = Header::kResponseSuccess;
+    }
+
+exit:
+    return error;
+}
+
+Error Server::AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                     Header &                 aResponseHeader,
+                                     Message &                aResponseMessage,
+                                     NameCompressInfo &       aCompressInfo,
+                                     bool                     aAdditional)
+{
+    Error               error = kErrorNone;
+    uint8_t             addrNum;
+    const Ip6::Address *addrs   = aHost.GetAddresses(addrNum);
+    uint32_t            hostTtl = TimeMilli::MsecToSec(aHost.GetExpireTime() - TimerMilli::GetNow());
+
+    for (uint8_t i = 0; i < addrNum; i++)
+    {
+        SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, aHost.GetFullName(), addrs[i], hostTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
+    }
+
+exit:
+    return error;
+}
+
 const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
 {
     const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
@@ -789,6 +870,23 @@ const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &
 {
     return aHost.FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService);
 }
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+const Srp::Server::Service *Server::FindNextSrpService(const char *                aName,
+                                                       uint16_t                    aQueryType,
+                                                       const Srp::Server::Service *aService) const
+{
+    const Srp::Server &srpServer = Get<Srp::Server>();
+
+    do
+    {
+        aService = (aQueryType == ResourceRecord::kTypePtr) ? srpServer.FindNextServiceWithServiceName(aService, aName)
+                                                             : srpServer.FindNextServiceWithInstanceName(aService, aName);
+    } while ((aService != nullptr) && (aService->IsDeleted() || aService->GetHost().IsDeleted()));
+
+    return aService;
+}
+#endif
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
 Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
@@ -361,9 +361,28 @@ private:
                                                             Message &         aResponseMessage,
                                                             NameCompressInfo &aCompressInfo,
                                                             bool              aAdditional);
+    Error                              ResolveSrpService(const char *                aName,
+                                                         uint16_t                    aQueryType,
+                                                         const Srp::Server::Service &aService,
+                                                         Header &                    aResponseHeader,
+                                                         Message &                   aResponseMessage,
+                                                         NameCompressInfo &          aCompressInfo,
+                                                         bool                        aAdditional,
+                                                         bool &                      aNeedAdditionalAaaaRecord,
+                                                         Header::Response &          aResponse);
+    Error                              AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                                              Header &                 aResponseHeader,
+                                                              Message &                aResponseMessage,
+                                                              NameCompressInfo &       aCompressInfo,
+                                                              bool                     aAdditional);
     const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
     static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
                                                          const Srp::Server::Service *aService);
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    const Srp::Server::Service *FindNextSrpService(const char *                aName,
+                                                   uint16_t                    aQueryType,
+                                                   const Srp::Server::Service *aService) const;
+#endif
 #endif
 
     Error             ResolveByQueryCallbacks(Header &                aResponseHeader,
@@ -799,6 +799,9 @@ private:
         Crypto::Ecdsa::P256::KeyPair mKeyPair;          // The ECDSA key pair.
     };
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged;
+
     Error        Start(const Ip6::SockAddr &aServerSockAddr, Requester aRequester);
     void         Stop(Requester aRequester, StopMode aMode);
     void         Resume(void);
@@ -94,6 +94,12 @@ Server::Server(Instance &aInstance)
     , mHasRegisteredAnyService(false)
 {
     IgnoreError(SetDomain(kDefaultDomain));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    memset(mHostBuckets, 0, sizeof(mHostBuckets));
+    memset(mServiceNameBuckets, 0, sizeof(mServiceNameBuckets));
+    memset(mInstanceNameBuckets, 0, sizeof(mInstanceNameBuckets));
+#endif
 }
 
 void Server::SetServiceHandler(otSrpServerServiceUpdateHandler aServiceHandler, void *aServiceHandlerContext)
@@ -258,8 +264,12 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
 // The caller MUST make sure that there is no existing host with the same hostname.
 void Server::AddHost(Host &aHost)
 {
-    OT_ASSERT(mHosts.FindMatching(aHost.GetFullName()) == nullptr);
+    OT_ASSERT(FindHost(aHost.GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(aHost));
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    IndexHost(aHost);
+#endif
 }
 
 void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandler)
@@ -276,6 +286,9 @@ void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandle
     else
     {
         aHost->mKeyLease = 0;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        UnindexHost(*aHost);
+#endif
         IgnoreError(mHosts.Remove(*aHost));
         otLogInfoSrp("[server] fully remove host '%s'", aHost->GetFullName());
     }
@@ -299,10 +312,31 @@ exit:
     return;
 }
 
+Server::Host *Server::FindHost(const char *aFullName)
+{
+    return AsNonConst(AsConst(this)->FindHost(aFullName));
+}
+
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    const Host *host = mHostBuckets[HashName(aFullName)];
+
+    while ((host != nullptr) && !host->Matches(aFullName))
+    {
+        host = host->mNextByName;
+    }
+
+    return host;
+#else
+    return mHosts.FindMatching(aFullName);
+#endif
+}
+
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && *aHost.GetKey() != *existingHost->GetKey())
     {
@@ -315,6 +349,14 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         // the same instance name and if found, verify that it has the
         // same key.
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        const Service *service = nullptr;
+
+        while ((service = FindNextServiceWithInstanceName(service, desc.GetInstanceName())) != nullptr)
+        {
+            VerifyOrExit(*aHost.GetKey() == *service->GetHost().GetKey(), hasConflicts = true);
+        }
+#else
         for (const Host &host : mHosts)
         {
             if (host.FindServiceDescription(desc.GetInstanceName()) != nullptr)
@@ -322,6 +364,7 @@ bool Server::HasNameConflictsWith(Host &aHost) const
                 VerifyOrExit(*aHost.GetKey() == *host.GetKey(), hasConflicts = true);
             }
         }
+#endif
     }
 
 exit:
@@ -386,7 +429,7 @@ void Server::CommitSrpUpdate(Error                    aError,
         desc.mKeyLease = grantedKeyLease;
     }
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -1110,7 +1153,7 @@ void Server::HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host &aHost, cons
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1426,6 +1469,163 @@ const char *Server::AddressModeToString(AddressMode aMode)
     return kAddressModeStrings[aMode];
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+
+uint16_t Server::HashName(const char *aName)
+{
+    // FNV-1a over the name with ASCII letters folded to lowercase, as
+    // DNS names compare case-insensitively. A trailing root label dot
+    // is skipped so a name hashes the same with or without it.
+
+    uint32_t hash = 2166136261u;
+
+    for (; *aName != '\0'; aName++)
+    {
+        char ch = *aName;
+
+        if ((ch == Dns::Name::kLabelSeperatorChar) && (aName[1] == '\0'))
+        {
+            break;
+        }
+
+        if ((ch >= 'A') && (ch <= 'Z'))
+        {
+            ch = static_cast<char>(ch - 'A' + 'a');
+        }
+
+        hash = (hash ^ static_cast<uint8_t>(ch)) * 16777619u;
+    }
+
+    return static_cast<uint16_t>(hash % kNumNameIndexBuckets);
+}
+
+void Server::LinkService(Service *&aHead, Service &aService, Service *Service::*aNext)
+{
+    // Services of the same host are kept adjacent within a bucket so
+    // that a lookup can handle all matching services of a host as a
+    // group (e.g., to append the host's AAAA records once).
+
+    Service *prev = aHead;
+
+    while ((prev != nullptr) && (&prev->GetHost() != &aService.GetHost()))
+    {
+        prev = prev->*aNext;
+    }
+
+    if (prev == nullptr)
+    {
+        aService.*aNext = aHead;
+        aHead           = &aService;
+    }
+    else
+    {
+        aService.*aNext = prev->*aNext;
+        prev->*aNext    = &aService;
+    }
+}
+
+void Server::UnlinkService(Service *&aHead, Service &aService, Service *Service::*aNext)
+{
+    for (Service **link = &aHead; *link != nullptr; link = &((*link)->*aNext))
+    {
+        if (*link == &aService)
+        {
+            *link = aService.*aNext;
+            break;
+        }
+    }
+}
+
+void Server::IndexHost(Host &aHost)
+{
+    Host *&head = mHostBuckets[HashName(aHost.GetFullName())];
+
+    aHost.mNextByName = head;
+    head              = &aHost;
+
+    for (Service &service : aHost.mServices)
+    {
+        IndexService(service);
+    }
+}
+
+void Server::UnindexHost(Host &aHost)
+{
+    for (Service &service : aHost.mServices)
+    {
+        UnindexService(service);
+    }
+
+    for (Host **link = &mHostBuckets[HashName(aHost.GetFullName())]; *link != nullptr; link = &(*link)->mNextByName)
+    {
+        if (*link == &aHost)
+        {
+            *link = aHost.mNextByName;
+            break;
+        }
+    }
+}
+
+bool Server::IsHostIndexed(const Host &aHost) const
+{
+    const Host *host = nullptr;
+
+    VerifyOrExit(!aHost.mFullName.IsNull());
+
+    host = mHostBuckets[HashName(aHost.GetFullName())];
+
+    while ((host != nullptr) && (host != &aHost))
+    {
+        host = host->mNextByName;
+    }
+
+exit:
+    return (host != nullptr);
+}
+
+void Server::IndexService(Service &aService)
+{
+    LinkService(mServiceNameBuckets[HashName(aService.GetServiceName())], aService, &Service::mNextByServiceName);
+    LinkService(mInstanceNameBuckets[HashName(aService.GetInstanceName())], aService, &Service::mNextByInstanceName);
+}
+
+void Server::UnindexService(Service &aService)
+{
+    UnlinkService(mServiceNameBuckets[HashName(aService.GetServiceName())], aService, &Service::mNextByServiceName);
+    UnlinkService(mInstanceNameBuckets[HashName(aService.GetInstanceName())], aService,
+                  &Service::mNextByInstanceName);
+}
+
+const Server::Service *Server::FindNextServiceWithServiceName(const Service *aPrevService,
+                                                              const char *   aServiceName) const
+{
+    const Service *service =
+        (aPrevService == nullptr) ? mServiceNameBuckets[HashName(aServiceName)] : aPrevService->mNextByServiceName;
+
+    while ((service != nullptr) && !service->MatchesServiceName(aServiceName))
+    {
+        service = service->mNextByServiceName;
+    }
+
+    return service;
+}
+
+const Server::Service *Server::FindNextServiceWithInstanceName(const Service *aPrevService,
+                                                               const char *   aInstanceName) const
+{
+    const Service *service =
+        (aPrevService == nullptr) ? mInstanceNameBuckets[HashName(aInstanceName)] : aPrevService->mNextByInstanceName;
+
+    while ((service != nullptr) && !service->MatchesInstanceName(aInstanceName))
+    {
+        service = service->mNextByInstanceName;
+    }
+
+    return service;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::Service
 
@@ -1461,6 +1661,10 @@ Server::Service::Service(Description &aDescription, bool aIsSubType)
     , mIsDeleted(false)
     , mIsSubType(aIsSubType)
     , mIsCommitted(false)
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    , mNextByServiceName(nullptr)
+    , mNextByInstanceName(nullptr)
+#endif
 {
 }
 
@@ -1700,6 +1904,9 @@ Server::Host::Host(Instance &aInstance)
     , mLease(0)
     , mKeyLease(0)
     , mTimeLastUpdate(TimerMilli::GetNow())
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    , mNextByName(nullptr)
+#endif
 {
     mKey.Clear();
 }
@@ -1792,6 +1999,13 @@ Server::Service *Server::Host::AddNewService(const char *aServiceName, const cha
 
     mServices.Push(*service);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    if (Get<Server>().IsHostIndexed(*this))
+    {
+        Get<Server>().IndexService(*service);
+    }
+#endif
+
 exit:
     return service;
 }
@@ -1819,6 +2033,12 @@ void Server::Host::RemoveService(Service *aService, bool aRetainName, bool aNoti
 
     if (!aRetainName)
     {
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        if (server.IsHostIndexed(*this))
+        {
+            server.UnindexService(*aService);
+        }
+#endif
         IgnoreError(mServices.Remove(*aService));
         aService->Free();
         FreeUnusedServiceDescriptions();
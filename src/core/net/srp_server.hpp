@@ -363,6 +363,10 @@ public:
         bool         mIsDeleted : 1;
         bool         mIsSubType : 1;
         bool         mIsCommitted : 1;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        Service *mNextByServiceName;  // Next service in the same service name index bucket.
+        Service *mNextByInstanceName; // Next service in the same instance name index bucket.
+#endif
     };
 
     /**
@@ -518,6 +522,9 @@ public:
         TimeMilli                        mTimeLastUpdate;
         LinkedList<Service>              mServices;
         LinkedList<Service::Description> mServiceDescriptions;
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+        Host *mNextByName; // Next host in the same host name index bucket.
+#endif
     };
 
     /**
@@ -839,6 +846,8 @@ private:
     void        HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host &aHost, const Ip6::MessageInfo &aMessageInfo);
     void        AddHost(Host &aHost);
     void        RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandler);
+    Host *      FindHost(const char *aFullName);
+    const Host *FindHost(const char *aFullName) const;
     bool        HasNameConflictsWith(Host &aHost) const;
     void        SendResponse(const Dns::UpdateHeader &   aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
@@ -858,6 +867,22 @@ private:
     const UpdateMetadata *FindOutstandingUpdate(const Ip6::MessageInfo &aMessageInfo, uint16_t aDnsMessageId);
     static const char *   AddressModeToString(AddressMode aMode);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    static constexpr uint16_t kNumNameIndexBuckets = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_BUCKETS;
+
+    static uint16_t HashName(const char *aName);
+    static void     LinkService(Service *&aHead, Service &aService, Service *Service::*aNext);
+    static void     UnlinkService(Service *&aHead, Service &aService, Service *Service::*aNext);
+
+    void           IndexHost(Host &aHost);
+    void           UnindexHost(Host &aHost);
+    bool           IsHostIndexed(const Host &aHost) const;
+    void           IndexService(Service &aService);
+    void           UnindexService(Service &aService);
+    const Service *FindNextServiceWithServiceName(const Service *aPrevService, const char *aServiceName) const;
+    const Service *FindNextServiceWithInstanceName(const Service *aPrevService, const char *aInstanceName) const;
+#endif
+
     Ip6::Udp::Socket                mSocket;
     otSrpServerServiceUpdateHandler mServiceUpdateHandler;
     void *                          mServiceUpdateHandlerContext;
@@ -878,6 +903,12 @@ private:
     AddressMode     mAddressMode;
     uint8_t         mAnycastSequenceNumber;
     bool            mHasRegisteredAnyService : 1;
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE
+    Host *   mHostBuckets[kNumNameIndexBuckets];
+    Service *mServiceNameBuckets[kNumNameIndexBuckets];
+    Service *mInstanceNameBuckets[kNumNameIndexBuckets];
+#endif
 };
 
 } // namespace Srp
@@ -77,6 +77,7 @@
 #include "config/link_quality.h"
 #include "config/link_raw.h"
 #include "config/logging.h"
+#include "config/lowpan.h"
 #include "config/mac.h"
 #include "config/mle.h"
 #include "config/netdata_publisher.h"
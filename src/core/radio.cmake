@@ -46,6 +46,7 @@ target_sources(openthread-radio PRIVATE
     api/logging_api.cpp
     api/random_noncrypto_api.cpp
     api/tasklet_api.cpp
+    common/binary_log.cpp
     common/error.cpp
     common/instance.cpp
     common/logging.cpp
@@ -57,8 +57,12 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mAddressQuery(UriPath::kAddressQuery, &AddressResolver::HandleAddressQuery, this)
     , mAddressNotification(UriPath::kAddressNotify, &AddressResolver::HandleAddressNotification, this)
     , mCacheEntryPool(aInstance)
+    , mNumNonEvictableSnooped(0)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 {
+    memset(mHashBuckets, 0xff, sizeof(mHashBuckets));
+    ResetCounters();
+
     Get<Tmf::Agent>().AddResource(mAddressError);
     Get<Tmf::Agent>().AddResource(mAddressQuery);
     Get<Tmf::Agent>().AddResource(mAddressNotification);
@@ -74,8 +78,10 @@ void AddressResolver::Clear(void)
     {
         CacheEntry *entry;
 
-        while ((entry = list->Pop()) != nullptr)
+        while ((entry = list->GetHead()) != nullptr)
         {
+            UnlinkCacheEntry(*entry);
+
             if (list == &mQueryList)
             {
                 Get<MeshForwarder>().HandleResolved(entry->GetTarget(), kErrorDrop);
@@ -176,53 +182,74 @@ void AddressResolver::Remove(uint16_t aRloc16)
     Remove(aRloc16, /* aMatchRouterId */ false);
 }
 
-AddressResolver::CacheEntry *AddressResolver::GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList)
-{
-    return (aPrev == nullptr) ? aList.GetHead() : aPrev->GetNext();
-}
-
 void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
 {
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList};
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev = nullptr;
-        CacheEntry *entry;
+        CacheEntry *next;
 
-        while ((entry = GetEntryAfter(prev, *list)) != nullptr)
+        for (CacheEntry *entry = list->GetHead(); entry != nullptr; entry = next)
         {
+            next = entry->GetNext();
+
             if ((aMatchRouterId && Mle::Mle::RouterIdMatch(entry->GetRloc16(), aRloc16)) ||
                 (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
             {
-                RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
+                RemoveCacheEntry(*entry, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
                 mCacheEntryPool.Free(*entry);
-
-                // If the entry is removed from list, we keep the same
-                // `prev` pointer.
-            }
-            else
-            {
-                prev = entry;
             }
         }
     }
 }
 
-AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid,
-                                                             CacheEntryList *&   aList,
-                                                             CacheEntry *&       aPrevEntry)
+uint16_t AddressResolver::HashEid(const Ip6::Address &aEid)
 {
-    CacheEntry *    entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    uint32_t hash = 0;
 
-    for (CacheEntryList *list : lists)
+    for (uint32_t word : aEid.mFields.m32)
+    {
+        hash = (hash ^ word) * 2654435761u;
+    }
+
+    return static_cast<uint16_t>((hash >> 16) % kNumHashBuckets);
+}
+
+void AddressResolver::AddToHash(CacheEntry &aEntry)
+{
+    uint16_t &head = mHashBuckets[HashEid(aEntry.GetTarget())];
+
+    aEntry.mNextHashIndex = head;
+    head                  = mCacheEntryPool.GetIndexOf(aEntry);
+}
+
+void AddressResolver::RemoveFromHash(CacheEntry &aEntry)
+{
+    uint16_t  index = mCacheEntryPool.GetIndexOf(aEntry);
+    uint16_t *link  = &mHashBuckets[HashEid(aEntry.GetTarget())];
+
+    while (*link != index)
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        OT_ASSERT(*link != CacheEntry::kNoNextIndex);
+        link = &mCacheEntryPool.GetEntryAt(*link).mNextHashIndex;
     }
 
+    *link = aEntry.mNextHashIndex;
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint16_t index = mHashBuckets[HashEid(aEid)]; index != CacheEntry::kNoNextIndex; index = entry->mNextHashIndex)
+    {
+        entry = &mCacheEntryPool.GetEntryAt(index);
+        VerifyOrExit(!entry->Matches(aEid));
+    }
+
+    entry = nullptr;
+
 exit:
     return entry;
 }
@@ -234,14 +261,12 @@ void AddressResolver::Remove(const Ip6::Address &aEid)
 
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
 {
-    CacheEntry *    entry;
-    CacheEntry *    prev;
-    CacheEntryList *list;
+    CacheEntry *entry;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid);
     VerifyOrExit(entry != nullptr);
 
-    RemoveCacheEntry(*entry, *list, prev, aReason);
+    RemoveCacheEntry(*entry, aReason);
     mCacheEntryPool.Free(*entry);
 
 exit:
@@ -250,9 +275,8 @@ exit:
 
 AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
 {
-    CacheEntry *    newEntry  = nullptr;
-    CacheEntry *    prevEntry = nullptr;
-    CacheEntryList *lists[]   = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
+    CacheEntry *    newEntry = nullptr;
+    CacheEntryList *lists[]  = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
 
     // The following order is used when trying to allocate a new cache
     // entry: First the cache pool is checked, followed by the list
@@ -264,31 +288,31 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
     // reclaimed first (the list's tail). We also make sure the entry
     // can be evicted (e.g., first time query entries can not be
     // evicted till timeout).
+    //
+    // Lists are kept in most recently used order, so walking back
+    // from the tail finds the least recently used evictable entry.
+    // All cached entries are evictable and at most
+    // `kMaxNonEvictableSnoopedEntries` snooped entries are not, so
+    // this is O(1) in the common case.
 
     newEntry = mCacheEntryPool.Allocate();
     VerifyOrExit(newEntry == nullptr);
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev;
-        CacheEntry *entry;
-        uint16_t    numNonEvictable = 0;
-
-        for (prev = nullptr; (entry = GetEntryAfter(prev, *list)) != nullptr; prev = entry)
+        for (CacheEntry *entry = list->GetTail(); entry != nullptr; entry = entry->GetPrev())
         {
-            if ((list != &mCachedList) && !entry->CanEvict())
+            if ((list == &mCachedList) || entry->CanEvict())
             {
-                numNonEvictable++;
-                continue;
+                newEntry = entry;
+                break;
             }
-
-            newEntry  = entry;
-            prevEntry = prev;
         }
 
         if (newEntry != nullptr)
         {
-            RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            RemoveCacheEntry(*newEntry, kReasonEvictingForNewEntry);
+            mCounters.mEvictions++;
             ExitNow();
         }
 
@@ -306,7 +330,7 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
             // snooped entries that are in timeout mode and cannot be
             // evicted by `kMaxNonEvictableSnoopedEntries`.
 
-            VerifyOrExit(numNonEvictable < kMaxNonEvictableSnoopedEntries);
+            VerifyOrExit(mNumNonEvictableSnooped < kMaxNonEvictableSnoopedEntries);
         }
     }
 
@@ -314,19 +338,60 @@ exit:
     return newEntry;
 }
 
-void AddressResolver::RemoveCacheEntry(CacheEntry &    aEntry,
-                                       CacheEntryList &aList,
-                                       CacheEntry *    aPrevEntry,
-                                       Reason          aReason)
+void AddressResolver::AddCacheEntry(CacheEntry &aEntry, CacheEntryList &aList)
+{
+    // Adds a new entry (not yet in any list) at the head of `aList`.
+
+    aList.Push(aEntry);
+    AddToHash(aEntry);
+
+    if ((&aList == &mSnoopedList) && !aEntry.CanEvict())
+    {
+        mNumNonEvictableSnooped++;
+    }
+}
+
+void AddressResolver::MoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList)
 {
-    aList.PopAfter(aPrevEntry);
+    // Moves an entry from its current list to the head of `aList`.
+    // An entry is only ever moved out of (never into) the snooped
+    // list, so this must be called before `aEntry.mInfo` is changed
+    // to reflect its new state.
+
+    OT_ASSERT(&aList != &mSnoopedList);
 
-    if (&aList == &mQueryList)
+    if ((aEntry.GetList() == &mSnoopedList) && !aEntry.CanEvict())
+    {
+        mNumNonEvictableSnooped--;
+    }
+
+    aEntry.GetList()->Remove(aEntry);
+    aList.Push(aEntry);
+}
+
+void AddressResolver::UnlinkCacheEntry(CacheEntry &aEntry)
+{
+    if ((aEntry.GetList() == &mSnoopedList) && !aEntry.CanEvict())
+    {
+        mNumNonEvictableSnooped--;
+    }
+
+    aEntry.GetList()->Remove(aEntry);
+    RemoveFromHash(aEntry);
+}
+
+void AddressResolver::RemoveCacheEntry(CacheEntry &aEntry, Reason aReason)
+{
+    CacheEntryList *list = aEntry.GetList();
+
+    UnlinkCacheEntry(aEntry);
+
+    if (list == &mQueryList)
     {
         Get<MeshForwarder>().HandleResolved(aEntry.GetTarget(), kErrorDrop);
     }
 
-    LogCacheEntryChange(kEntryRemoved, aReason, aEntry, &aList);
+    LogCacheEntryChange(kEntryRemoved, aReason, aEntry, list);
 }
 
 Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
@@ -335,30 +400,26 @@ Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddr
     // Returns `kErrorNone` if entry is found and successfully updated,
     // `kErrorNotFound` if no matching entry.
 
-    Error           error = kErrorNone;
-    CacheEntryList *list;
-    CacheEntry *    entry;
-    CacheEntry *    prev;
+    Error       error = kErrorNone;
+    CacheEntry *entry;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid);
     VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
-    if ((list == &mCachedList) || (list == &mSnoopedList))
+    if ((entry->GetList() == &mCachedList) || (entry->GetList() == &mSnoopedList))
     {
         VerifyOrExit(entry->GetRloc16() != aRloc16);
         entry->SetRloc16(aRloc16);
     }
     else
     {
-        // Entry is in `mQueryList` or `mQueryRetryList`. Remove it
-        // from its current list, update it, and then add it to the
-        // `mCachedList`.
+        // Entry is in `mQueryList` or `mQueryRetryList`. Move it to
+        // the `mCachedList` and update it.
 
-        list->PopAfter(prev);
+        MoveCacheEntry(*entry, mCachedList);
 
         entry->SetRloc16(aRloc16);
         entry->MarkLastTransactionTimeAsInvalid();
-        mCachedList.Push(*entry);
 
         Get<MeshForwarder>().HandleResolved(aEid, kErrorNone);
     }
@@ -373,7 +434,6 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
                                               Mac::ShortAddress   aRloc16,
                                               Mac::ShortAddress   aDest)
 {
-    uint16_t          numNonEvictable = 0;
     CacheEntry *      entry;
     Mac::ShortAddress macAddress;
 
@@ -395,18 +455,10 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
     entry = NewCacheEntry(/* aSnoopedEntry */ true);
     VerifyOrExit(entry != nullptr);
 
-    for (CacheEntry &snooped : mSnoopedList)
-    {
-        if (!snooped.CanEvict())
-        {
-            numNonEvictable++;
-        }
-    }
-
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
 
-    if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
+    if (mNumNonEvictableSnooped < kMaxNonEvictableSnoopedEntries)
     {
         entry->SetCanEvict(false);
         entry->SetTimeout(kSnoopBlockEvictionTimeout);
@@ -419,7 +471,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
         entry->SetTimeout(0);
     }
 
-    mSnoopedList.Push(*entry);
+    AddCacheEntry(*entry, mSnoopedList);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -429,32 +481,25 @@ exit:
 
 void AddressResolver::RestartAddressQueries(void)
 {
-    CacheEntry *tail;
+    CacheEntry *entry;
 
     // We move all entries from `mQueryRetryList` at the tail of
     // `mQueryList` and then (re)send Address Query for all entries in
     // the updated `mQueryList`.
 
-    tail = mQueryList.GetTail();
-
-    if (tail == nullptr)
+    while ((entry = mQueryRetryList.GetHead()) != nullptr)
     {
-        mQueryList.SetHead(mQueryRetryList.GetHead());
+        mQueryRetryList.Remove(*entry);
+        mQueryList.PushTail(*entry);
     }
-    else
-    {
-        tail->SetNext(mQueryRetryList.GetHead());
-    }
-
-    mQueryRetryList.Clear();
 
-    for (CacheEntry &entry : mQueryList)
+    for (entry = mQueryList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
-        IgnoreError(SendAddressQuery(entry.GetTarget()));
+        IgnoreError(SendAddressQuery(entry->GetTarget()));
 
-        entry.SetTimeout(kAddressQueryTimeout);
-        entry.SetRetryDelay(kAddressQueryInitialRetryDelay);
-        entry.SetCanEvict(false);
+        entry->SetTimeout(kAddressQueryTimeout);
+        entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
+        entry->SetCanEvict(false);
     }
 }
 
@@ -462,10 +507,29 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 {
     Error           error = kErrorNone;
     CacheEntry *    entry;
-    CacheEntry *    prev = nullptr;
     CacheEntryList *list;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid);
+    list  = (entry != nullptr) ? entry->GetList() : nullptr;
+
+    if ((list == &mCachedList) || (list == &mSnoopedList))
+    {
+        // Move the entry from its current list to the head of cached
+        // list.
+
+        MoveCacheEntry(*entry, mCachedList);
+
+        if (list == &mSnoopedList)
+        {
+            entry->MarkLastTransactionTimeAsInvalid();
+        }
+
+        aRloc16 = entry->GetRloc16();
+        mCounters.mHits++;
+        ExitNow();
+    }
+
+    mCounters.mMisses++;
 
     if (entry == nullptr)
     {
@@ -482,24 +546,6 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         entry->SetRloc16(Mac::kShortAddrInvalid);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
-        list = nullptr;
-    }
-
-    if ((list == &mCachedList) || (list == &mSnoopedList))
-    {
-        // Remove the entry from its current list and push it at the
-        // head of cached list.
-
-        list->PopAfter(prev);
-
-        if (list == &mSnoopedList)
-        {
-            entry->MarkLastTransactionTimeAsInvalid();
-        }
-
-        mCachedList.Push(*entry);
-        aRloc16 = entry->GetRloc16();
-        ExitNow();
     }
 
     // Note that if `aAllowAddressQuery` is `false` then the `entry` is definitely already in a list, i.e., we cannot
@@ -519,7 +565,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         // expired.
 
         VerifyOrExit(entry->IsTimeoutZero(), error = kErrorDrop);
-        mQueryRetryList.PopAfter(prev);
+        UnlinkCacheEntry(*entry);
     }
 
     entry->SetTimeout(kAddressQueryTimeout);
@@ -532,7 +578,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
-    mQueryList.Push(*entry);
+    AddCacheEntry(*entry, mQueryList);
     error = kErrorAddressQuery;
 
 exit:
@@ -593,9 +639,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     Ip6::InterfaceIdentifier meshLocalIid;
     uint16_t                 rloc16;
     uint32_t                 lastTransactionTime;
-    CacheEntryList *         list;
     CacheEntry *             entry;
-    CacheEntry *             prev;
 
     VerifyOrExit(aMessage.IsConfirmablePostRequest());
 
@@ -617,10 +661,10 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     otLogInfoArp("Received address notification from 0x%04x for %s to 0x%04x",
                  aMessageInfo.GetPeerAddr().GetIid().GetLocator(), target.ToString().AsCString(), rloc16);
 
-    entry = FindCacheEntry(target, list, prev);
+    entry = FindCacheEntry(target);
     VerifyOrExit(entry != nullptr);
 
-    if (list == &mCachedList)
+    if (entry->GetList() == &mCachedList)
     {
         if (entry->IsLastTransactionTimeValid())
         {
@@ -635,13 +679,12 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
         }
     }
 
+    MoveCacheEntry(*entry, mCachedList);
+
     entry->SetRloc16(rloc16);
     entry->SetMeshLocalIid(meshLocalIid);
     entry->SetLastTransactionTime(lastTransactionTime);
 
-    list->PopAfter(prev);
-    mCachedList.Push(*entry);
-
     LogCacheEntryChange(kEntryUpdated, kReasonReceivedNotification, *entry);
 
     if (Get<Tmf::Agent>().SendEmptyAck(aMessage, aMessageInfo) == kErrorNone)
@@ -871,78 +914,70 @@ exit:
 
 void AddressResolver::HandleTimeTick(void)
 {
-    bool continueRxingTicks = false;
+    bool        continueRxingTicks = false;
+    CacheEntry *entry;
+    CacheEntry *next;
 
-    for (CacheEntry &entry : mSnoopedList)
+    for (entry = mSnoopedList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
-        if (entry.IsTimeoutZero())
+        if (entry->IsTimeoutZero())
         {
             continue;
         }
 
         continueRxingTicks = true;
-        entry.DecrementTimeout();
+        entry->DecrementTimeout();
 
-        if (entry.IsTimeoutZero())
+        if (entry->IsTimeoutZero())
         {
-            entry.SetCanEvict(true);
+            entry->SetCanEvict(true);
+            mNumNonEvictableSnooped--;
         }
     }
 
-    for (CacheEntry &entry : mQueryRetryList)
+    for (entry = mQueryRetryList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
-        if (entry.IsTimeoutZero())
+        if (entry->IsTimeoutZero())
         {
             continue;
         }
 
         continueRxingTicks = true;
-        entry.DecrementTimeout();
+        entry->DecrementTimeout();
     }
 
+    for (entry = mQueryList.GetHead(); entry != nullptr; entry = next)
     {
-        CacheEntry *prev = nullptr;
-        CacheEntry *entry;
-
-        while ((entry = GetEntryAfter(prev, mQueryList)) != nullptr)
-        {
-            OT_ASSERT(!entry->IsTimeoutZero());
+        next = entry->GetNext();
 
-            continueRxingTicks = true;
-            entry->DecrementTimeout();
+        OT_ASSERT(!entry->IsTimeoutZero());
 
-            if (entry->IsTimeoutZero())
-            {
-                uint16_t retryDelay = entry->GetRetryDelay();
+        continueRxingTicks = true;
+        entry->DecrementTimeout();
 
-                entry->SetTimeout(retryDelay);
+        if (entry->IsTimeoutZero())
+        {
+            uint16_t retryDelay = entry->GetRetryDelay();
 
-                retryDelay <<= 1;
+            entry->SetTimeout(retryDelay);
 
-                if (retryDelay > kAddressQueryMaxRetryDelay)
-                {
-                    retryDelay = kAddressQueryMaxRetryDelay;
-                }
+            retryDelay <<= 1;
 
-                entry->SetRetryDelay(retryDelay);
-                entry->SetCanEvict(true);
+            if (retryDelay > kAddressQueryMaxRetryDelay)
+            {
+                retryDelay = kAddressQueryMaxRetryDelay;
+            }
 
-                // Move the entry from `mQueryList` to `mQueryRetryList`
-                mQueryList.PopAfter(prev);
-                mQueryRetryList.Push(*entry);
+            entry->SetRetryDelay(retryDelay);
+            entry->SetCanEvict(true);
 
-                otLogInfoArp("Timed out waiting for address notification for %s, retry: %d",
-                             entry->GetTarget().ToString().AsCString(), entry->GetTimeout());
+            // Move the entry from `mQueryList` to `mQueryRetryList`
+            MoveCacheEntry(*entry, mQueryRetryList);
 
-                Get<MeshForwarder>().HandleResolved(entry->GetTarget(), kErrorDrop);
+            otLogInfoArp("Timed out waiting for address notification for %s, retry: %d",
+                         entry->GetTarget().ToString().AsCString(), entry->GetTimeout());
 
-                // When the entry is removed from `mQueryList`
-                // we keep the `prev` pointer same as before.
-            }
-            else
-            {
-                prev = entry;
-            }
+            Get<MeshForwarder>().HandleResolved(entry->GetTarget(), kErrorDrop);
         }
     }
 
@@ -1068,7 +1103,10 @@ void AddressResolver::LogCacheEntryChange(EntryChange, Reason, const CacheEntry
 void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
-    mNextIndex = kNoNextIndex;
+    mNextIndex     = kNoNextIndex;
+    mPrevIndex     = kNoNextIndex;
+    mNextHashIndex = kNoNextIndex;
+    mList          = nullptr;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1090,6 +1128,87 @@ exit:
     return;
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+void AddressResolver::CacheEntry::SetPrev(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mPrevIndex = kNoNextIndex);
+    mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryList
+
+void AddressResolver::CacheEntryList::Push(CacheEntry &aEntry)
+{
+    aEntry.SetPrev(nullptr);
+    aEntry.SetNext(mHead);
+
+    if (mHead != nullptr)
+    {
+        mHead->SetPrev(&aEntry);
+    }
+    else
+    {
+        mTail = &aEntry;
+    }
+
+    mHead        = &aEntry;
+    aEntry.mList = this;
+}
+
+void AddressResolver::CacheEntryList::PushTail(CacheEntry &aEntry)
+{
+    aEntry.SetNext(nullptr);
+    aEntry.SetPrev(mTail);
+
+    if (mTail != nullptr)
+    {
+        mTail->SetNext(&aEntry);
+    }
+    else
+    {
+        mHead = &aEntry;
+    }
+
+    mTail        = &aEntry;
+    aEntry.mList = this;
+}
+
+void AddressResolver::CacheEntryList::Remove(CacheEntry &aEntry)
+{
+    CacheEntry *prev = aEntry.GetPrev();
+    CacheEntry *next = aEntry.GetNext();
+
+    OT_ASSERT(aEntry.mList == this);
+
+    if (prev != nullptr)
+    {
+        prev->SetNext(next);
+    }
+    else
+    {
+        mHead = next;
+    }
+
+    if (next != nullptr)
+    {
+        next->SetPrev(prev);
+    }
+    else
+    {
+        mTail = prev;
+    }
+
+    aEntry.mList = nullptr;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -39,9 +39,9 @@
 #if OPENTHREAD_FTD
 
 #include "coap/coap.hpp"
-#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
@@ -107,6 +107,20 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * This method gets the EID-to-RLOC cache counters.
+     *
+     * @returns A reference to the cache counters.
+     *
+     */
+    const otAddressCacheCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the EID-to-RLOC cache counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -209,8 +223,15 @@ private:
     static constexpr uint8_t kIteratorListIndex  = 0;
     static constexpr uint8_t kIteratorEntryIndex = 1;
 
+    static constexpr uint16_t kNumHashBuckets = kCacheEntries;
+
+    class CacheEntryList;
+
     class CacheEntry : public InstanceLocatorInit
     {
+        friend class AddressResolver;
+        friend class CacheEntryList;
+
     public:
         void Init(Instance &aInstance);
 
@@ -218,6 +239,9 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+        CacheEntry *GetPrev(void);
+        void        SetPrev(CacheEntry *aEntry);
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
 
@@ -245,13 +269,18 @@ private:
 
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
+        CacheEntryList *GetList(void) const { return mList; }
+
     private:
         static constexpr uint16_t kNoNextIndex          = 0xffff;     // `mNextIndex` value when at end of list.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
 
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
-        uint16_t          mNextIndex;
+        uint16_t          mNextIndex;     // Next entry in the pool free list or in the `CacheEntryList`.
+        uint16_t          mPrevIndex;     // Previous entry in the `CacheEntryList`.
+        uint16_t          mNextHashIndex; // Next entry in the same hash bucket.
+        CacheEntryList *  mList;          // The list containing the entry, `nullptr` if not in any list.
 
         union
         {
@@ -272,7 +301,32 @@ private:
     };
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
-    typedef LinkedList<CacheEntry>          CacheEntryList;
+
+    // A doubly linked list of cache entries ordered from the most
+    // recently used (head) to the least recently used (tail). Both
+    // removal of an arbitrary entry and access to the tail are O(1).
+    class CacheEntryList
+    {
+    public:
+        CacheEntryList(void)
+            : mHead(nullptr)
+            , mTail(nullptr)
+        {
+        }
+
+        CacheEntry *GetHead(void) { return mHead; }
+        const CacheEntry *GetHead(void) const { return mHead; }
+        CacheEntry *      GetTail(void) { return mTail; }
+        bool              IsEmpty(void) const { return mHead == nullptr; }
+
+        void Push(CacheEntry &aEntry);
+        void PushTail(CacheEntry &aEntry);
+        void Remove(CacheEntry &aEntry);
+
+    private:
+        CacheEntry *mHead;
+        CacheEntry *mTail;
+    };
 
     enum EntryChange : uint8_t
     {
@@ -297,11 +351,18 @@ private:
 
     void        Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
     void        Remove(const Ip6::Address &aEid, Reason aReason);
-    CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
+    CacheEntry *FindCacheEntry(const Ip6::Address &aEid);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
-    void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
+    void        AddCacheEntry(CacheEntry &aEntry, CacheEntryList &aList);
+    void        MoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList);
+    void        UnlinkCacheEntry(CacheEntry &aEntry);
+    void        RemoveCacheEntry(CacheEntry &aEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
 
+    static uint16_t HashEid(const Ip6::Address &aEid);
+    void            AddToHash(CacheEntry &aEntry);
+    void            RemoveFromHash(CacheEntry &aEntry);
+
     Error SendAddressQuery(const Ip6::Address &aEid);
 
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
@@ -332,8 +393,6 @@ private:
 
     const char *ListToString(const CacheEntryList *aList) const;
 
-    static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
-
     Coap::Resource mAddressError;
     Coap::Resource mAddressQuery;
     Coap::Resource mAddressNotification;
@@ -343,6 +402,10 @@ private:
     CacheEntryList mSnoopedList;
     CacheEntryList mQueryList;
     CacheEntryList mQueryRetryList;
+    uint16_t       mHashBuckets[kNumHashBuckets];
+    uint16_t       mNumNonEvictableSnooped;
+
+    otAddressCacheCounters mCounters;
 
     Ip6::Icmp::Handler mIcmpHandler;
 };
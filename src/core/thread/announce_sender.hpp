@@ -250,6 +250,9 @@ private:
     // (possibly) on different channels.
     static constexpr uint16_t kMaxJitter = OPENTHREAD_CONFIG_ANNOUNCE_SENDER_JITTER_INTERVAL;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventActiveDatasetChanged | kEventThreadChannelChanged;
+
     void        Stop(void);
     static void HandleTimer(Timer &aTimer);
     static void HandleTrickleTimer(TrickleTimer &aTimer);
@@ -77,6 +77,10 @@ ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    memset(mIndex, 0xff, sizeof(mIndex));
+#endif
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
@@ -118,6 +122,18 @@ const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (aMatcher.GetShortAddress() != Mac::kShortAddrInvalid)
+    {
+        ExitNow(child = FindChildInIndex(kRloc16Index, GetHomeSlot(aMatcher.GetShortAddress()), aMatcher));
+    }
+
+    if (aMatcher.GetExtAddress() != nullptr)
+    {
+        ExitNow(child = FindChildInIndex(kExtAddressIndex, GetHomeSlot(*aMatcher.GetExtAddress()), aMatcher));
+    }
+#endif
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->Matches(aMatcher))
@@ -331,6 +347,162 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
     return hasChild;
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+bool ChildTable::IsInTable(const Neighbor &aNeighbor) const
+{
+    const Neighbor *neighbor = &aNeighbor;
+
+    return (neighbor >= &mChildren[0]) && (neighbor < OT_ARRAY_END(mChildren));
+}
+
+uint16_t ChildTable::GetHomeSlot(uint16_t aRloc16)
+{
+    // Children of the same parent have consecutive RLOC16 values, so
+    // the value is scrambled (Fibonacci hashing) to avoid forming one
+    // long cluster of occupied slots.
+
+    return static_cast<uint16_t>(((aRloc16 * 2654435769u) >> 16) % kIndexSize);
+}
+
+uint16_t ChildTable::GetHomeSlot(const Mac::ExtAddress &aExtAddress)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        hash = (hash * 31) + byte;
+    }
+
+    return static_cast<uint16_t>(hash % kIndexSize);
+}
+
+uint16_t ChildTable::GetHomeSlot(IndexType aType, const Child &aChild) const
+{
+    return (aType == kRloc16Index) ? GetHomeSlot(aChild.GetRloc16()) : GetHomeSlot(aChild.GetExtAddress());
+}
+
+void ChildTable::AddToIndex(const Neighbor &aNeighbor)
+{
+    uint16_t childIndex;
+
+    VerifyOrExit(IsInTable(aNeighbor));
+
+    childIndex = GetChildIndex(static_cast<const Child &>(aNeighbor));
+    AddToIndex(kRloc16Index, childIndex);
+    AddToIndex(kExtAddressIndex, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::RemoveFromIndex(const Neighbor &aNeighbor)
+{
+    uint16_t childIndex;
+
+    VerifyOrExit(IsInTable(aNeighbor));
+
+    childIndex = GetChildIndex(static_cast<const Child &>(aNeighbor));
+    RemoveFromIndex(kRloc16Index, childIndex);
+    RemoveFromIndex(kExtAddressIndex, childIndex);
+
+exit:
+    return;
+}
+
+void ChildTable::AddToIndex(IndexType aType, uint16_t aChildIndex)
+{
+    uint16_t *index = mIndex[aType];
+    uint16_t  slot  = GetHomeSlot(aType, mChildren[aChildIndex]);
+
+    // There are at most `kMaxChildren` entries in an index of size
+    // `kIndexSize`, so an empty slot is always found.
+
+    while (index[slot] != kEmptySlot)
+    {
+        OT_ASSERT(index[slot] != aChildIndex);
+        slot = GetNextSlot(slot);
+    }
+
+    index[slot] = aChildIndex;
+}
+
+void ChildTable::RemoveFromIndex(IndexType aType, uint16_t aChildIndex)
+{
+    uint16_t *index = mIndex[aType];
+    uint16_t  slot  = GetHomeSlot(aType, mChildren[aChildIndex]);
+    uint16_t  next;
+
+    while (index[slot] != aChildIndex)
+    {
+        // The child is not in the index (e.g., a cleared child whose
+        // address was never set).
+        VerifyOrExit(index[slot] != kEmptySlot);
+        slot = GetNextSlot(slot);
+    }
+
+    // Backward-shift deletion: move any subsequent entry in the same
+    // probe sequence into the freed slot so that lookups never need
+    // tombstones.
+
+    for (next = GetNextSlot(slot); index[next] != kEmptySlot; next = GetNextSlot(next))
+    {
+        uint16_t home = GetHomeSlot(aType, mChildren[index[next]]);
+        bool     canMove;
+
+        // An entry at `next` can move to `slot` only if its home slot
+        // is not cyclically within `(slot, next]`.
+
+        if (slot <= next)
+        {
+            canMove = (home <= slot) || (home > next);
+        }
+        else
+        {
+            canMove = (home <= slot) && (home > next);
+        }
+
+        if (canMove)
+        {
+            index[slot] = index[next];
+            slot        = next;
+        }
+    }
+
+    index[slot] = kEmptySlot;
+
+exit:
+    return;
+}
+
+const Child *ChildTable::FindChildInIndex(IndexType                    aType,
+                                          uint16_t                     aHomeSlot,
+                                          const Child::AddressMatcher &aMatcher) const
+{
+    // Multiple children may share an address (e.g., a child in invalid
+    // state still holding an RLOC16 that was re-assigned to another
+    // child), so the whole probe sequence is checked and the matching
+    // child with the smallest table index is returned. This mirrors the
+    // result of scanning the table in order.
+
+    const uint16_t *index = mIndex[aType];
+    const Child *   found = nullptr;
+
+    for (uint16_t slot = aHomeSlot; index[slot] != kEmptySlot; slot = GetNextSlot(slot))
+    {
+        const Child &child = mChildren[index[slot]];
+
+        if ((index[slot] < mMaxChildrenAllowed) && child.Matches(aMatcher) && ((found == nullptr) || (&child < found)))
+        {
+            found = &child;
+        }
+    }
+
+    return found;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
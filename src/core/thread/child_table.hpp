@@ -53,6 +53,10 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    friend class Child;
+    friend class Neighbor;
+#endif
     class IteratorBuilder;
 
 public:
@@ -328,8 +332,42 @@ private:
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // The index uses linear probing and keeps the load factor at or
+    // below one half. Each slot stores the index of a child in
+    // `mChildren[]` (or `kEmptySlot`). A child's entries are always
+    // keyed by its current RLOC16 and extended address: `Neighbor`
+    // removes them before changing either address and adds them back
+    // afterwards.
+
+    static constexpr uint16_t kIndexSize = 2 * kMaxChildren + 1;
+    static constexpr uint16_t kEmptySlot = 0xffff;
+
+    enum IndexType : uint8_t
+    {
+        kRloc16Index,
+        kExtAddressIndex,
+        kNumIndexes,
+    };
+
+    bool         IsInTable(const Neighbor &aNeighbor) const;
+    void         AddToIndex(const Neighbor &aNeighbor);
+    void         RemoveFromIndex(const Neighbor &aNeighbor);
+    void         AddToIndex(IndexType aType, uint16_t aChildIndex);
+    void         RemoveFromIndex(IndexType aType, uint16_t aChildIndex);
+    uint16_t     GetHomeSlot(IndexType aType, const Child &aChild) const;
+    const Child *FindChildInIndex(IndexType aType, uint16_t aHomeSlot, const Child::AddressMatcher &aMatcher) const;
+
+    static uint16_t GetHomeSlot(uint16_t aRloc16);
+    static uint16_t GetHomeSlot(const Mac::ExtAddress &aExtAddress);
+    static uint16_t GetNextSlot(uint16_t aSlot) { return (aSlot + 1 < kIndexSize) ? aSlot + 1 : 0; }
+#endif
+
     uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    uint16_t mIndex[kNumIndexes][kIndexSize];
+#endif
+    Child mChildren[kMaxChildren];
 };
 
 } // namespace ot
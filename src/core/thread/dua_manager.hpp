@@ -191,6 +191,8 @@ private:
     void SendAddressNotification(Ip6::Address &aAddress, ThreadStatusTlv::DuaStatus aStatus, const Child &aChild);
 #endif
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventIp6AddressAdded;
+
     void HandleNotifierEvents(Events aEvents);
 
     void HandleTimeTick(void);
@@ -75,6 +75,8 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     void SendReport(void);
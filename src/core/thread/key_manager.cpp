@@ -182,6 +182,8 @@ KeyManager::KeyManager(Instance &aInstance)
 {
     IgnoreError(otPlatCryptoInit());
 
+    ResetCounters();
+
 #if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
     {
         NetworkKey networkKey;
@@ -310,6 +312,8 @@ void KeyManager::ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys)
     hmac.Update(kThreadString);
 
     hmac.Finish(aHashKeys.mHash);
+
+    mCounters.mKeyDerivations++;
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -330,16 +334,36 @@ void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey)
 
     hkdf.Extract(salt, sizeof(salt), cryptoKey);
     hkdf.Expand(kTrelInfoString, sizeof(kTrelInfoString), aKey.m8, Mac::Key::kSize);
+
+    mCounters.mTrelKeyDerivations++;
 }
 #endif
 
 void KeyManager::UpdateKeyMaterial(void)
 {
-    HashKeys hashKeys;
+    // The keys for the previous and next key sequences are derived
+    // along with the current ones, so that frames and messages from
+    // neighbors on an adjacent key sequence (e.g., during a key
+    // rotation) do not trigger a key derivation each.
 
-    ComputeKeys(mKeySequence, hashKeys);
+    HashKeys prevHashKeys;
+    HashKeys curHashKeys;
+    HashKeys nextHashKeys;
 
-    mMleKey.SetFrom(hashKeys.GetMleKey());
+    ComputeKeys(mKeySequence - 1, prevHashKeys);
+    ComputeKeys(mKeySequence, curHashKeys);
+    ComputeKeys(mKeySequence + 1, nextHashKeys);
+
+    mMleKey.SetFrom(curHashKeys.GetMleKey());
+    mPrevMleKey.SetFrom(prevHashKeys.GetMleKey());
+    mNextMleKey.SetFrom(nextHashKeys.GetMleKey());
+
+    {
+        Crypto::Key cryptoKey;
+
+        mMleKey.ConvertToCryptoKey(cryptoKey);
+        mMleKeyEcb.SetKey(cryptoKey);
+    }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     {
@@ -347,13 +371,9 @@ void KeyManager::UpdateKeyMaterial(void)
         Mac::KeyMaterial prevKey;
         Mac::KeyMaterial nextKey;
 
-        curKey.SetFrom(hashKeys.GetMacKey());
-
-        ComputeKeys(mKeySequence - 1, hashKeys);
-        prevKey.SetFrom(hashKeys.GetMacKey());
-
-        ComputeKeys(mKeySequence + 1, hashKeys);
-        nextKey.SetFrom(hashKeys.GetMacKey());
+        curKey.SetFrom(curHashKeys.GetMacKey());
+        prevKey.SetFrom(prevHashKeys.GetMacKey());
+        nextKey.SetFrom(nextHashKeys.GetMacKey());
 
         Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
     }
@@ -365,6 +385,12 @@ void KeyManager::UpdateKeyMaterial(void)
 
         ComputeTrelKey(mKeySequence, key);
         mTrelKey.SetFrom(key);
+
+        ComputeTrelKey(mKeySequence - 1, key);
+        mPrevTrelKey.SetFrom(key);
+
+        ComputeTrelKey(mKeySequence + 1, key);
+        mNextTrelKey.SetFrom(key);
     }
 #endif
 }
@@ -399,23 +425,61 @@ exit:
 
 const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const Mle::KeyMaterial *key;
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        key = &mPrevMleKey;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        key = &mNextMleKey;
+    }
+    else
+    {
+        HashKeys hashKeys;
+
+        ComputeKeys(aKeySequence, hashKeys);
+        mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+        mCounters.mTemporaryKeyCacheMisses++;
+
+        ExitNow(key = &mTemporaryMleKey);
+    }
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+    mCounters.mTemporaryKeyCacheHits++;
 
-    return mTemporaryMleKey;
+exit:
+    return *key;
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
-    Mac::Key key;
+    const Mac::KeyMaterial *key;
 
-    ComputeTrelKey(aKeySequence, key);
-    mTemporaryTrelKey.SetFrom(key);
+    if (aKeySequence == mKeySequence - 1)
+    {
+        key = &mPrevTrelKey;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        key = &mNextTrelKey;
+    }
+    else
+    {
+        Mac::Key trelKey;
+
+        ComputeTrelKey(aKeySequence, trelKey);
+        mTemporaryTrelKey.SetFrom(trelKey);
+        mCounters.mTemporaryKeyCacheMisses++;
 
-    return mTemporaryTrelKey;
+        ExitNow(key = &mTemporaryTrelKey);
+    }
+
+    mCounters.mTemporaryKeyCacheHits++;
+
+exit:
+    return *key;
 }
 #endif
 
@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include <openthread/dataset.h>
+#include <openthread/thread.h>
 
 #include <openthread/platform/crypto.h>
 #include "common/clearable.hpp"
@@ -48,6 +49,7 @@
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/mle_types.hpp"
@@ -213,6 +215,14 @@ public:
     static constexpr uint32_t kNetworkKeyPsaItsOffset = OPENTHREAD_CONFIG_PSA_ITS_NVM_OFFSET + 1;
     static constexpr uint32_t kPskcPsaItsOffset       = OPENTHREAD_CONFIG_PSA_ITS_NVM_OFFSET + 2;
 
+    /**
+     * This class represents the key derivation counters.
+     *
+     */
+    class Counters : public otKeyManagerCounters, public Clearable<Counters>
+    {
+    };
+
     /**
      * This constructor initializes the object.
      *
@@ -340,6 +350,9 @@ public:
     /**
      * This method returns a temporary MAC key for TREL radio link computed from the given key sequence.
      *
+     * The keys for the previous and next key sequence are derived once when the key material is updated, other key
+     * sequences are derived on each call.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary TREL MAC key.
@@ -356,9 +369,23 @@ public:
      */
     const Mle::KeyMaterial &GetCurrentMleKey(void) const { return mMleKey; }
 
+    /**
+     * This method returns an AES-ECB context keyed with the current MLE key.
+     *
+     * The key schedule is expanded once whenever the key material is updated and reused for every MLE message secured
+     * with the current MLE key.
+     *
+     * @returns A reference to the AES-ECB context keyed with the current MLE key.
+     *
+     */
+    Crypto::AesEcb &GetCurrentMleKeyEcb(void) { return mMleKeyEcb; }
+
     /**
      * This method returns a temporary MLE key Material computed from the given key sequence.
      *
+     * The keys for the previous and next key sequence are derived once when the key material is updated, other key
+     * sequences are derived on each call.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary MLE key.
@@ -548,6 +575,20 @@ public:
      */
     void MacFrameCounterUpdated(uint32_t aMacFrameCounter);
 
+    /**
+     * This method returns the key derivation counters.
+     *
+     * @returns A reference to the key derivation counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the key derivation counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     static constexpr uint32_t kDefaultKeySwitchGuardTime = 624;
     static constexpr uint32_t kOneHourIntervalInMsec     = 3600u * 1000u;
@@ -600,13 +641,20 @@ private:
 
     uint32_t         mKeySequence;
     Mle::KeyMaterial mMleKey;
+    Crypto::AesEcb   mMleKeyEcb;
+    Mle::KeyMaterial mPrevMleKey;
+    Mle::KeyMaterial mNextMleKey;
     Mle::KeyMaterial mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     Mac::KeyMaterial mTrelKey;
+    Mac::KeyMaterial mPrevTrelKey;
+    Mac::KeyMaterial mNextTrelKey;
     Mac::KeyMaterial mTemporaryTrelKey;
 #endif
 
+    Counters mCounters;
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
@@ -53,6 +53,9 @@ namespace Lowpan {
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
 {
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    ClearFlowCache();
+#endif
 }
 
 void Lowpan::CopyContext(const Context &aContext, Ip6::Address &aAddress)
@@ -255,31 +258,22 @@ Error Lowpan::Compress(Message &           aMessage,
     return error;
 }
 
-Error Lowpan::Compress(Message &           aMessage,
-                       const Mac::Address &aMacSource,
-                       const Mac::Address &aMacDest,
-                       BufferWriter &      aBuf,
-                       uint8_t &           aHeaderDepth)
+void Lowpan::CompressAddresses(const Ip6::Header &  aIp6Header,
+                               const Mac::Address & aMacSource,
+                               const Mac::Address & aMacDest,
+                               CompressedAddresses &aAddresses)
 {
-    Error                error       = kErrorNone;
     NetworkData::Leader &networkData = Get<NetworkData::Leader>();
-    uint16_t             startOffset = aMessage.GetOffset();
-    BufferWriter         buf         = aBuf;
-    uint16_t             hcCtl       = kHcDispatch;
-    Ip6::Header          ip6Header;
-    uint8_t *            ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
+    BufferWriter         buf(aAddresses.mBytes, sizeof(aAddresses.mBytes));
+    uint16_t             hcCtl = 0;
     Context              srcContext, dstContext;
     bool                 srcContextValid, dstContextValid;
-    uint8_t              nextHeader;
-    uint8_t              ecn;
-    uint8_t              dscp;
-    uint8_t              headerDepth    = 0;
-    uint8_t              headerMaxDepth = aHeaderDepth;
 
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
+    // `mBytes` can hold both addresses in-line, so none of the writes
+    // to `buf` below can fail.
 
     srcContextValid =
-        (networkData.GetContext(ip6Header.GetSource(), srcContext) == kErrorNone && srcContext.mCompressFlag);
+        (networkData.GetContext(aIp6Header.GetSource(), srcContext) == kErrorNone && srcContext.mCompressFlag);
 
     if (!srcContextValid)
     {
@@ -287,21 +281,191 @@ Error Lowpan::Compress(Message &           aMessage,
     }
 
     dstContextValid =
-        (networkData.GetContext(ip6Header.GetDestination(), dstContext) == kErrorNone && dstContext.mCompressFlag);
+        (networkData.GetContext(aIp6Header.GetDestination(), dstContext) == kErrorNone && dstContext.mCompressFlag);
 
     if (!dstContextValid)
     {
         IgnoreError(networkData.GetContext(0, dstContext));
     }
 
+    // Context Identifier
+    aAddresses.mContextIds = 0;
+
+    if (srcContext.mContextId != 0 || dstContext.mContextId != 0)
+    {
+        hcCtl |= kHcContextId;
+        aAddresses.mContextIds = ((srcContext.mContextId << 4) | dstContext.mContextId) & 0xff;
+    }
+
+    // Source Address
+    if (aIp6Header.GetSource().IsUnspecified())
+    {
+        hcCtl |= kHcSrcAddrContext;
+    }
+    else if (aIp6Header.GetSource().IsLinkLocal())
+    {
+        IgnoreError(CompressSourceIid(aMacSource, aIp6Header.GetSource(), srcContext, hcCtl, buf));
+    }
+    else if (srcContextValid)
+    {
+        hcCtl |= kHcSrcAddrContext;
+        IgnoreError(CompressSourceIid(aMacSource, aIp6Header.GetSource(), srcContext, hcCtl, buf));
+    }
+    else
+    {
+        IgnoreError(buf.Write(aIp6Header.GetSource().mFields.m8, sizeof(aIp6Header.GetSource())));
+    }
+
+    // Destination Address
+    if (aIp6Header.GetDestination().IsMulticast())
+    {
+        IgnoreError(CompressMulticast(aIp6Header.GetDestination(), hcCtl, buf));
+    }
+    else if (aIp6Header.GetDestination().IsLinkLocal())
+    {
+        IgnoreError(CompressDestinationIid(aMacDest, aIp6Header.GetDestination(), dstContext, hcCtl, buf));
+    }
+    else if (dstContextValid)
+    {
+        hcCtl |= kHcDstAddrContext;
+        IgnoreError(CompressDestinationIid(aMacDest, aIp6Header.GetDestination(), dstContext, hcCtl, buf));
+    }
+    else
+    {
+        IgnoreError(buf.Write(&aIp6Header.GetDestination(), sizeof(aIp6Header.GetDestination())));
+    }
+
+    aAddresses.mHcCtl  = hcCtl;
+    aAddresses.mLength = static_cast<uint8_t>(buf.GetWritePointer() - aAddresses.mBytes);
+}
+
+void Lowpan::GetCompressedAddresses(const Ip6::Header &  aIp6Header,
+                                    const Mac::Address & aMacSource,
+                                    const Mac::Address & aMacDest,
+                                    CompressedAddresses &aAddresses)
+{
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    uint8_t         netDataVersion = Get<NetworkData::Leader>().GetVersion();
+    FlowCacheEntry *entry          = nullptr;
+
+    for (FlowCacheEntry &cacheEntry : mFlowCache)
+    {
+        if (cacheEntry.mValid && cacheEntry.Matches(aIp6Header, aMacSource, aMacDest))
+        {
+            entry = &cacheEntry;
+            break;
+        }
+    }
+
+    if (entry != nullptr && entry->mNetDataVersion == netDataVersion)
+    {
+        aAddresses = entry->mAddresses;
+        ExitNow();
+    }
+#endif
+
+    CompressAddresses(aIp6Header, aMacSource, aMacDest, aAddresses);
+
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    if (entry == nullptr)
+    {
+        entry               = &mFlowCache[mFlowCacheNextIndex];
+        mFlowCacheNextIndex = (mFlowCacheNextIndex + 1) % kNumFlowCacheEntries;
+    }
+
+    entry->mSource         = aIp6Header.GetSource();
+    entry->mDestination    = aIp6Header.GetDestination();
+    entry->mMacSource      = aMacSource;
+    entry->mMacDest        = aMacDest;
+    entry->mAddresses      = aAddresses;
+    entry->mNetDataVersion = netDataVersion;
+    entry->mValid          = true;
+
+exit:
+#endif
+    return;
+}
+
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+void Lowpan::ClearFlowCache(void)
+{
+    for (FlowCacheEntry &entry : mFlowCache)
+    {
+        entry.mValid = false;
+    }
+
+    mFlowCacheNextIndex = 0;
+}
+
+void Lowpan::HandleNotifierEvents(Events aEvents)
+{
+    // Contexts come from the Network Data and the Mesh Local Prefix.
+
+    if (aEvents.ContainsAny(kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged))
+    {
+        ClearFlowCache();
+    }
+}
+
+bool Lowpan::FlowCacheEntry::Matches(const Ip6::Header & aIp6Header,
+                                     const Mac::Address &aMacSource,
+                                     const Mac::Address &aMacDest) const
+{
+    return (mSource == aIp6Header.GetSource()) && (mDestination == aIp6Header.GetDestination()) &&
+           MacAddressesMatch(mMacSource, aMacSource) && MacAddressesMatch(mMacDest, aMacDest);
+}
+
+bool Lowpan::FlowCacheEntry::MacAddressesMatch(const Mac::Address &aFirst, const Mac::Address &aSecond)
+{
+    bool matches = (aFirst.GetType() == aSecond.GetType());
+
+    if (matches)
+    {
+        if (aFirst.IsShort())
+        {
+            matches = (aFirst.GetShort() == aSecond.GetShort());
+        }
+        else if (aFirst.IsExtended())
+        {
+            matches = (aFirst.GetExtended() == aSecond.GetExtended());
+        }
+    }
+
+    return matches;
+}
+#endif // OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+
+Error Lowpan::Compress(Message &           aMessage,
+                       const Mac::Address &aMacSource,
+                       const Mac::Address &aMacDest,
+                       BufferWriter &      aBuf,
+                       uint8_t &           aHeaderDepth)
+{
+    Error               error       = kErrorNone;
+    uint16_t            startOffset = aMessage.GetOffset();
+    BufferWriter        buf         = aBuf;
+    uint16_t            hcCtl       = kHcDispatch;
+    Ip6::Header         ip6Header;
+    uint8_t *           ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
+    CompressedAddresses addresses;
+    uint8_t             nextHeader;
+    uint8_t             ecn;
+    uint8_t             dscp;
+    uint8_t             headerDepth    = 0;
+    uint8_t             headerMaxDepth = aHeaderDepth;
+
+    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
+
+    GetCompressedAddresses(ip6Header, aMacSource, aMacDest, addresses);
+    hcCtl |= addresses.mHcCtl;
+
     // Lowpan HC Control Bits
     SuccessOrExit(error = buf.Advance(sizeof(hcCtl)));
 
     // Context Identifier
-    if (srcContext.mContextId != 0 || dstContext.mContextId != 0)
+    if (hcCtl & kHcContextId)
     {
-        hcCtl |= kHcContextId;
-        SuccessOrExit(error = buf.Write(((srcContext.mContextId << 4) | dstContext.mContextId) & 0xff));
+        SuccessOrExit(error = buf.Write(addresses.mContextIds));
     }
 
     dscp = ((ip6HeaderBytes[0] << 2) & 0x3c) | (ip6HeaderBytes[1] >> 6);
@@ -377,43 +541,8 @@ Error Lowpan::Compress(Message &           aMessage,
         break;
     }
 
-    // Source Address
-    if (ip6Header.GetSource().IsUnspecified())
-    {
-        hcCtl |= kHcSrcAddrContext;
-    }
-    else if (ip6Header.GetSource().IsLinkLocal())
-    {
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
-    }
-    else if (srcContextValid)
-    {
-        hcCtl |= kHcSrcAddrContext;
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
-    }
-    else
-    {
-        SuccessOrExit(error = buf.Write(ip6Header.GetSource().mFields.m8, sizeof(ip6Header.GetSource())));
-    }
-
-    // Destination Address
-    if (ip6Header.GetDestination().IsMulticast())
-    {
-        SuccessOrExit(error = CompressMulticast(ip6Header.GetDestination(), hcCtl, buf));
-    }
-    else if (ip6Header.GetDestination().IsLinkLocal())
-    {
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
-    }
-    else if (dstContextValid)
-    {
-        hcCtl |= kHcDstAddrContext;
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
-    }
-    else
-    {
-        SuccessOrExit(error = buf.Write(&ip6Header.GetDestination(), sizeof(ip6Header.GetDestination())));
-    }
+    // Source and Destination Addresses
+    SuccessOrExit(error = buf.Write(addresses.mBytes, addresses.mLength));
 
     headerDepth++;
 
@@ -40,6 +40,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
 #include "mac/mac_types.hpp"
 #include "net/ip6.hpp"
 #include "net/ip6_address.hpp"
@@ -221,6 +222,10 @@ private:
  */
 class Lowpan : public InstanceLocator, private NonCopyable
 {
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    friend class ot::Notifier;
+#endif
+
 public:
     /**
      * This constructor initializes the object.
@@ -308,6 +313,14 @@ public:
      */
     int DecompressUdpHeader(Ip6::Udp::Header &aUdpHeader, const uint8_t *aBuf, uint16_t aBufLength);
 
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    /**
+     * This method clears the compression flow cache.
+     *
+     */
+    void ClearFlowCache(void);
+#endif
+
 private:
     static constexpr uint16_t kHcDispatch     = 3 << 13;
     static constexpr uint16_t kHcDispatchMask = 7 << 13;
@@ -356,12 +369,53 @@ private:
     static constexpr uint8_t kUdpChecksum = 1 << 2;
     static constexpr uint8_t kUdpPortMask = 3 << 0;
 
+    // The compressed source and destination addresses of a LOWPAN_IPHC
+    // header: the context and address mode bits of the IPHC control
+    // field, the Context Identifier Extension and the in-line address
+    // bytes (source followed by destination).
+    struct CompressedAddresses
+    {
+        uint16_t mHcCtl;
+        uint8_t  mContextIds;
+        uint8_t  mLength;
+        uint8_t  mBytes[2 * sizeof(Ip6::Address)];
+    };
+
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    static constexpr uint8_t kNumFlowCacheEntries = OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENTRIES;
+
+    static_assert(kNumFlowCacheEntries > 0, "LOWPAN_FLOW_CACHE_ENTRIES must be non-zero");
+
+    struct FlowCacheEntry
+    {
+        bool Matches(const Ip6::Header &aIp6Header, const Mac::Address &aMacSource, const Mac::Address &aMacDest) const;
+        static bool MacAddressesMatch(const Mac::Address &aFirst, const Mac::Address &aSecond);
+
+        Ip6::Address        mSource;
+        Ip6::Address        mDestination;
+        Mac::Address        mMacSource;
+        Mac::Address        mMacDest;
+        CompressedAddresses mAddresses;
+        uint8_t             mNetDataVersion;
+        bool                mValid;
+    };
+#endif
+
     Error Compress(Message &           aMessage,
                    const Mac::Address &aMacSource,
                    const Mac::Address &aMacDest,
                    BufferWriter &      aBuf,
                    uint8_t &           aHeaderDepth);
 
+    void GetCompressedAddresses(const Ip6::Header &  aIp6Header,
+                                const Mac::Address & aMacSource,
+                                const Mac::Address & aMacDest,
+                                CompressedAddresses &aAddresses);
+    void CompressAddresses(const Ip6::Header &  aIp6Header,
+                           const Mac::Address & aMacSource,
+                           const Mac::Address & aMacDest,
+                           CompressedAddresses &aAddresses);
+
     Error CompressExtensionHeader(Message &aMessage, BufferWriter &aBuf, uint8_t &aNextHeader);
     Error CompressSourceIid(const Mac::Address &aMacAddr,
                             const Ip6::Address &aIpAddr,
@@ -382,6 +436,15 @@ private:
 
     static void  CopyContext(const Context &aContext, Ip6::Address &aAddress);
     static Error ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged;
+
+    void HandleNotifierEvents(Events aEvents);
+
+    FlowCacheEntry mFlowCache[kNumFlowCacheEntries];
+    uint8_t        mFlowCacheNextIndex;
+#endif
 };
 
 /**
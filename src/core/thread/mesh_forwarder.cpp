@@ -99,6 +99,14 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
 
     ResetCounters();
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    ResetReassemblyCounters();
+#endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    ResetSendQueueStats();
+#endif
+
 #if OPENTHREAD_FTD
     mFragmentPriorityList.Clear();
 #endif
@@ -128,6 +136,10 @@ void MeshForwarder::Stop(void)
     mSendQueue.DequeueAndFreeAll();
     mReassemblyList.DequeueAndFreeAll();
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    mReassemblyTable.Clear();
+#endif
+
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     mFragmentPriorityList.Clear();
@@ -253,7 +265,11 @@ Message *MeshForwarder::GetDirectTransmission(void)
     Message *curMessage, *nextMessage;
     Error    error = kErrorNone;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    for (curMessage = mFairScheduler.SelectDirectMessage(mSendQueue); curMessage; curMessage = nextMessage)
+#else
     for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+#endif
     {
         if (!curMessage->GetDirectTransmission())
         {
@@ -303,15 +319,19 @@ Message *MeshForwarder::GetDirectTransmission(void)
         case kErrorAddressQuery:
             mSendQueue.Dequeue(*curMessage);
             mResolvingQueue.Enqueue(*curMessage);
-            continue;
+            break;
 
 #endif
 
         default:
             LogMessage(kMessageDrop, *curMessage, nullptr, error);
             mSendQueue.DequeueAndFree(*curMessage);
-            continue;
+            break;
         }
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+        nextMessage = mFairScheduler.SelectDirectMessage(mSendQueue);
+#endif
     }
 
 exit:
@@ -492,6 +512,13 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     mSendBusy = true;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    if (mSendMessage->GetOffset() == 0)
+    {
+        RecordSendQueueDelay(*mSendMessage);
+    }
+#endif
+
     switch (mSendMessage->GetType())
     {
     case Message::kTypeIp6:
@@ -1197,6 +1224,9 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
     Lowpan::FragmentHeader fragmentHeader;
     uint16_t               fragmentHeaderLength;
     Message *              message = nullptr;
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    ReassemblyTable::Entry *entry = nullptr;
+#endif
 
     // Check the fragment header
     SuccessOrExit(error = fragmentHeader.ParseFrom(aFrame, aFrameLength, fragmentHeaderLength));
@@ -1242,6 +1272,14 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
     {
         uint16_t datagramSize = fragmentHeader.GetDatagramSize();
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+        if (mReassemblyTable.Find(aMacSource, fragmentHeader.GetDatagramTag(), datagramSize) != nullptr)
+        {
+            mReassemblyCounters.mDuplicateFragments++;
+            ExitNow(error = kErrorDuplicated);
+        }
+#endif
+
         error = FrameToMessage(aFrame, aFrameLength, datagramSize, aMacSource, aMacDest, message);
         SuccessOrExit(error);
 
@@ -1268,12 +1306,71 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
             ClearReassemblyList();
         }
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+        if (mReassemblyTable.IsFull())
+        {
+            EvictOldestReassemblyMessage();
+        }
+
+        entry = mReassemblyTable.Allocate(*message, aMacSource, fragmentHeader.GetDatagramTag(), datagramSize);
+        OT_ASSERT(entry != nullptr);
+
+        // The first fragment carries the (uncompressed) datagram from its start up to the current message offset.
+        IgnoreError(entry->MarkReceived(0, message->GetOffset()));
+        mReassemblyCounters.mFragments++;
+#endif
+
         mReassemblyList.Enqueue(*message);
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+        uint16_t datagramOffset = fragmentHeader.GetDatagramOffset();
+        bool     isInOrder;
+
+        entry = mReassemblyTable.Find(aMacSource, fragmentHeader.GetDatagramTag(), fragmentHeader.GetDatagramSize());
+
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if ((entry != nullptr) &&
+            (entry->GetMessage()->IsLinkSecurityEnabled() != aLinkInfo.IsLinkSecurityEnabled()))
+        {
+            entry = nullptr;
+        }
+
+        // For a sleepy-end-device, if we receive a new (secure) next fragment
+        // with a non-matching tag, it indicates that the parent has moved to a
+        // new message with a new tag. We can safely clear any remaining
+        // fragments stored in the reassembly list.
+
+        if (!GetRxOnWhenIdle() && (entry == nullptr) && aLinkInfo.IsLinkSecurityEnabled())
+        {
+            ClearReassemblyList();
+        }
+
+        VerifyOrExit(entry != nullptr, error = kErrorDrop);
+
+        isInOrder = entry->IsInOrder(datagramOffset);
+        error     = entry->MarkReceived(datagramOffset, aFrameLength);
+
+        if (error == kErrorDuplicated)
+        {
+            mReassemblyCounters.mDuplicateFragments++;
+        }
+
+        SuccessOrExit(error);
+
+        mReassemblyCounters.mFragments++;
+
+        if (!isInOrder)
+        {
+            mReassemblyCounters.mOutOfOrderFragments++;
+        }
+
+        message = entry->GetMessage();
+        message->WriteBytes(datagramOffset, aFrame, aFrameLength);
+#else
         for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
         {
             // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
@@ -1302,6 +1399,7 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
 
         message->WriteBytes(message->GetOffset(), aFrame, aFrameLength);
         message->MoveOffset(aFrameLength);
+#endif // OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
         message->AddRss(aLinkInfo.GetRss());
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
         message->AddLqi(aLinkInfo.GetLqi());
@@ -1313,8 +1411,17 @@ exit:
 
     if (error == kErrorNone)
     {
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+        if (entry->IsComplete())
+        {
+            UpdateReassemblyLatency(*entry);
+            mReassemblyTable.Remove(*message);
+            message->SetOffset(message->GetLength());
+            mReassemblyCounters.mDatagrams++;
+#else
         if (message->GetOffset() >= message->GetLength())
         {
+#endif
             mReassemblyList.Dequeue(*message);
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacSource));
         }
@@ -1340,6 +1447,10 @@ void MeshForwarder::ClearReassemblyList(void)
     }
 
     mReassemblyList.DequeueAndFreeAll();
+
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    mReassemblyTable.Clear();
+#endif
 }
 
 void MeshForwarder::HandleTimeTick(void)
@@ -1379,6 +1490,11 @@ bool MeshForwarder::UpdateReassemblyList(void)
                 mIpCounters.mRxFailure++;
             }
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+            mReassemblyTable.Remove(*message);
+            mReassemblyCounters.mTimeouts++;
+#endif
+
             mReassemblyList.DequeueAndFree(*message);
         }
     }
@@ -1386,6 +1502,434 @@ bool MeshForwarder::UpdateReassemblyList(void)
     return mReassemblyList.GetHead() != nullptr;
 }
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+
+void MeshForwarder::EvictOldestReassemblyMessage(void)
+{
+    Message *message = mReassemblyTable.GetOldestMessage();
+
+    OT_ASSERT(message != nullptr);
+
+    LogMessage(kMessageReassemblyDrop, *message, nullptr, kErrorNoBufs);
+
+    if (message->GetType() == Message::kTypeIp6)
+    {
+        mIpCounters.mRxFailure++;
+    }
+
+    mReassemblyCounters.mEvictions++;
+
+    mReassemblyTable.Remove(*message);
+    mReassemblyList.DequeueAndFree(*message);
+}
+
+void MeshForwarder::UpdateReassemblyLatency(const ReassemblyTable::Entry &aEntry)
+{
+    uint32_t latency = TimerMilli::GetNow() - aEntry.GetStartTime();
+
+    mReassemblyCounters.mTotalLatency += latency;
+
+    if (latency > mReassemblyCounters.mMaxLatency)
+    {
+        mReassemblyCounters.mMaxLatency = latency;
+    }
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::Allocate(Message &           aMessage,
+                                                                                const Mac::Address &aSource,
+                                                                                uint16_t            aTag,
+                                                                                uint16_t            aSize)
+{
+    Entry * entry  = nullptr;
+    uint8_t bucket = Hash(aSource, aTag);
+
+    for (Entry &candidate : mEntries)
+    {
+        if (candidate.mMessage == nullptr)
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+
+    VerifyOrExit(entry != nullptr);
+
+    entry->mMessage        = &aMessage;
+    entry->mSource         = aSource;
+    entry->mStartTime      = TimerMilli::GetNow();
+    entry->mDatagramTag    = aTag;
+    entry->mDatagramSize   = aSize;
+    entry->mReceivedLength = 0;
+    entry->mNextOffset     = 0;
+    entry->mReceivedUnits.Clear();
+
+    entry->mNext     = mBuckets[bucket];
+    mBuckets[bucket] = static_cast<uint8_t>(entry - mEntries) + 1;
+
+exit:
+    return entry;
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::Find(const Mac::Address &aSource,
+                                                                            uint16_t            aTag,
+                                                                            uint16_t            aSize)
+{
+    Entry *entry = nullptr;
+
+    for (uint8_t index = mBuckets[Hash(aSource, aTag)]; index != 0; index = mEntries[index - 1].mNext)
+    {
+        if (mEntries[index - 1].Matches(aSource, aTag, aSize))
+        {
+            entry = &mEntries[index - 1];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+void MeshForwarder::ReassemblyTable::Remove(const Message &aMessage)
+{
+    for (Entry &entry : mEntries)
+    {
+        uint8_t *link;
+
+        if (entry.mMessage != &aMessage)
+        {
+            continue;
+        }
+
+        // Unlink the entry from its hash bucket chain.
+        for (link = &mBuckets[Hash(entry.mSource, entry.mDatagramTag)]; *link != 0; link = &mEntries[*link - 1].mNext)
+        {
+            if (&mEntries[*link - 1] == &entry)
+            {
+                *link = entry.mNext;
+                break;
+            }
+        }
+
+        entry.mMessage = nullptr;
+        entry.mNext    = 0;
+        break;
+    }
+}
+
+bool MeshForwarder::ReassemblyTable::IsFull(void) const
+{
+    bool isFull = true;
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.mMessage == nullptr)
+        {
+            ExitNow(isFull = false);
+        }
+    }
+
+exit:
+    return isFull;
+}
+
+Message *MeshForwarder::ReassemblyTable::GetOldestMessage(void) const
+{
+    const Entry *oldest = nullptr;
+
+    for (const Entry &entry : mEntries)
+    {
+        if ((entry.mMessage != nullptr) && ((oldest == nullptr) || (entry.mStartTime < oldest->mStartTime)))
+        {
+            oldest = &entry;
+        }
+    }
+
+    return (oldest != nullptr) ? oldest->mMessage : nullptr;
+}
+
+uint8_t MeshForwarder::ReassemblyTable::Hash(const Mac::Address &aSource, uint16_t aTag)
+{
+    uint16_t hash = aTag;
+
+    if (aSource.IsShort())
+    {
+        hash ^= aSource.GetShort();
+    }
+    else if (aSource.IsExtended())
+    {
+        const Mac::ExtAddress &extAddress = aSource.GetExtended();
+
+        for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i += sizeof(uint16_t))
+        {
+            hash ^= static_cast<uint16_t>((extAddress.m8[i] << 8) | extAddress.m8[i + 1]);
+        }
+    }
+
+    hash ^= (hash >> 8);
+
+    return static_cast<uint8_t>(hash & (kNumBuckets - 1));
+}
+
+Error MeshForwarder::ReassemblyTable::Entry::MarkReceived(uint16_t aOffset, uint16_t aLength)
+{
+    Error    error   = kErrorNone;
+    uint16_t endUnit = (aOffset + aLength + kUnitSize - 1) / kUnitSize;
+
+    VerifyOrExit((aLength > 0) && (aOffset + aLength <= mDatagramSize), error = kErrorDrop);
+
+    for (uint16_t unit = aOffset / kUnitSize; unit < endUnit; unit++)
+    {
+        VerifyOrExit(!mReceivedUnits.Get(unit), error = kErrorDuplicated);
+    }
+
+    for (uint16_t unit = aOffset / kUnitSize; unit < endUnit; unit++)
+    {
+        mReceivedUnits.Set(unit, true);
+    }
+
+    mReceivedLength += aLength;
+    mNextOffset = aOffset + aLength;
+
+exit:
+    return error;
+}
+
+bool MeshForwarder::ReassemblyTable::Entry::Matches(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize) const
+{
+    bool matches = (mMessage != nullptr) && (mDatagramTag == aTag) && (mDatagramSize == aSize) &&
+                   (mSource.GetType() == aSource.GetType());
+
+    if (matches)
+    {
+        if (aSource.IsShort())
+        {
+            matches = (mSource.GetShort() == aSource.GetShort());
+        }
+        else if (aSource.IsExtended())
+        {
+            matches = (mSource.GetExtended() == aSource.GetExtended());
+        }
+    }
+
+    return matches;
+}
+
+#endif // OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+
+void MeshForwarder::RecordSendQueueDelay(const Message &aMessage)
+{
+    uint32_t delay    = TimerMilli::GetNow() - aMessage.GetSendQueueTime();
+    uint8_t  priority = aMessage.GetPriority();
+    uint8_t  bin      = 0;
+
+    // Bin `n` counts delays in [2^(n-1), 2^n) ms, the last bin counts all longer delays.
+    for (uint32_t value = delay; (value != 0) && (bin < OT_SEND_QUEUE_DELAY_HISTOGRAM_BINS - 1); value >>= 1)
+    {
+        bin++;
+    }
+
+    mSendQueueStats.mDelayHistogram[priority][bin]++;
+
+    if (delay > mSendQueueStats.mMaxDelay[priority])
+    {
+        mSendQueueStats.mMaxDelay[priority] = delay;
+    }
+}
+
+Message *MeshForwarder::FairScheduler::SelectDirectMessage(const PriorityQueue &aQueue)
+{
+    Message *message = nullptr;
+
+    for (uint8_t priority = Message::kNumPriorities; (priority > 0) && (message == nullptr); priority--)
+    {
+        message = SelectDirectMessage(aQueue, static_cast<Message::Priority>(priority - 1));
+    }
+
+    return message;
+}
+
+Message *MeshForwarder::FairScheduler::SelectDirectMessage(const PriorityQueue &aQueue, Message::Priority aPriority)
+{
+    Message * heads[kNumBuckets];
+    Message * selected = nullptr;
+    uint16_t *deficits = mDeficits[aPriority];
+    uint8_t & bucket   = mCurrentBuckets[aPriority];
+    bool      isEmpty  = true;
+
+    memset(heads, 0, sizeof(heads));
+
+    for (Message *message = aQueue.GetHeadForPriority(aPriority); message != nullptr; message = message->GetNext())
+    {
+        if (message->GetPriority() != aPriority)
+        {
+            break;
+        }
+
+        if (!message->GetDirectTransmission())
+        {
+            continue;
+        }
+
+        // A message with a non-zero offset has its first fragments already sent, so it is continued before
+        // anything else (its length was already charged to its bucket).
+        if (message->GetOffset() != 0)
+        {
+            ExitNow(selected = message);
+        }
+
+        if (heads[GetBucket(*message)] == nullptr)
+        {
+            heads[GetBucket(*message)] = message;
+            isEmpty                    = false;
+        }
+    }
+
+    VerifyOrExit(!isEmpty);
+
+    // Deficit Round Robin: the current bucket keeps sending while its deficit covers the length of its head message.
+    // Otherwise the next backlogged bucket is granted a quantum. An idle bucket loses its deficit.
+
+    while (selected == nullptr)
+    {
+        if (heads[bucket] == nullptr)
+        {
+            deficits[bucket] = 0;
+        }
+        else if (deficits[bucket] >= heads[bucket]->GetLength())
+        {
+            deficits[bucket] -= heads[bucket]->GetLength();
+            selected = heads[bucket];
+            break;
+        }
+
+        bucket = (bucket + 1) & (kNumBuckets - 1);
+
+        if (heads[bucket] != nullptr)
+        {
+            deficits[bucket] += kQuantum;
+        }
+    }
+
+exit:
+    return selected;
+}
+
+Message *MeshForwarder::FairScheduler::SelectEvictionCandidate(const PriorityQueue &aQueue,
+                                                               Message::Priority    aPriority) const
+{
+    Message *oldest[kNumBuckets];
+    uint16_t counts[kNumBuckets];
+    Message *candidate = nullptr;
+    uint16_t maxCount  = 0;
+
+    memset(oldest, 0, sizeof(oldest));
+    memset(counts, 0, sizeof(counts));
+
+    for (Message *message = aQueue.GetHeadForPriority(aPriority); message != nullptr; message = message->GetNext())
+    {
+        uint8_t bucket;
+
+        if (message->GetPriority() != aPriority)
+        {
+            break;
+        }
+
+        if (message->GetDoNotEvict())
+        {
+            continue;
+        }
+
+        bucket = GetBucket(*message);
+
+        if (oldest[bucket] == nullptr)
+        {
+            oldest[bucket] = message;
+        }
+
+        counts[bucket]++;
+    }
+
+    // Evict the oldest message of the bucket with the most queued messages.
+
+    for (uint8_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        if (counts[bucket] > maxCount)
+        {
+            maxCount  = counts[bucket];
+            candidate = oldest[bucket];
+        }
+    }
+
+    return candidate;
+}
+
+uint16_t MeshForwarder::FairScheduler::CountDirectMessages(const PriorityQueue &aQueue, uint8_t aBucket) const
+{
+    uint16_t count = 0;
+
+    for (const Message *message = aQueue.GetHead(); message != nullptr; message = message->GetNext())
+    {
+        if (message->GetDirectTransmission() && (GetBucket(*message) == aBucket))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+uint8_t MeshForwarder::FairScheduler::GetBucket(const Message &aMessage)
+{
+    uint16_t key = GetDestinationKey(aMessage);
+
+    key ^= (key >> 8);
+    key ^= (key >> 4);
+
+    return static_cast<uint8_t>(key & (kNumBuckets - 1));
+}
+
+uint16_t MeshForwarder::FairScheduler::GetDestinationKey(const Message &aMessage)
+{
+    uint16_t key = 0;
+
+    switch (aMessage.GetType())
+    {
+    case Message::kTypeIp6:
+    {
+        Ip6::Address destination;
+
+        SuccessOrExit(aMessage.Read(Ip6::Header::kDestinationFieldOffset, destination));
+
+        for (uint8_t i = 0; i < sizeof(Ip6::Address); i += sizeof(uint16_t))
+        {
+            key ^= static_cast<uint16_t>((destination.mFields.m8[i] << 8) | destination.mFields.m8[i + 1]);
+        }
+
+        break;
+    }
+
+#if OPENTHREAD_FTD
+    case Message::kType6lowpan:
+    {
+        Lowpan::MeshHeader meshHeader;
+
+        SuccessOrExit(meshHeader.ParseFrom(aMessage));
+        key = meshHeader.GetDestination();
+        break;
+    }
+#endif
+
+    default:
+        break;
+    }
+
+exit:
+    return key;
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+
 Error MeshForwarder::FrameToMessage(const uint8_t *     aFrame,
                                     uint16_t            aFrameLength,
                                     uint16_t            aDatagramSize,
@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/bit_vector.hpp"
 #include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -299,6 +300,38 @@ public:
      */
     void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    /**
+     * This method returns a reference to the 6LoWPAN reassembly counters.
+     *
+     * @returns A reference to the 6LoWPAN reassembly counters.
+     *
+     */
+    const otReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * This method resets the 6LoWPAN reassembly counters.
+     *
+     */
+    void ResetReassemblyCounters(void) { memset(&mReassemblyCounters, 0, sizeof(mReassemblyCounters)); }
+#endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    /**
+     * This method returns a reference to the send queue statistics.
+     *
+     * @returns A reference to the send queue statistics.
+     *
+     */
+    const otSendQueueStats &GetSendQueueStats(void) const { return mSendQueueStats; }
+
+    /**
+     * This method resets the send queue statistics.
+     *
+     */
+    void ResetSendQueueStats(void) { memset(&mSendQueueStats, 0, sizeof(mSendQueueStats)); }
+#endif
+
 #if OPENTHREAD_FTD
     /**
      * This method returns a reference to the resolving queue.
@@ -385,6 +418,87 @@ private:
     };
 #endif // OPENTHREAD_FTD
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    class ReassemblyTable : public Clearable<ReassemblyTable>
+    {
+    public:
+        class Entry
+        {
+            friend class ReassemblyTable;
+
+        public:
+            Message * GetMessage(void) const { return mMessage; }
+            TimeMilli GetStartTime(void) const { return mStartTime; }
+            bool      IsComplete(void) const { return (mReceivedLength == mDatagramSize); }
+            bool      IsInOrder(uint16_t aOffset) const { return (aOffset == mNextOffset); }
+            Error     MarkReceived(uint16_t aOffset, uint16_t aLength);
+
+        private:
+            // Received octets are tracked in units of 8 octets (the granularity of the Datagram Offset).
+            static constexpr uint16_t kMaxDatagramSize = 2048; // Datagram Size is an 11-bit field.
+            static constexpr uint16_t kUnitSize        = 8;
+            static constexpr uint16_t kNumUnits        = kMaxDatagramSize / kUnitSize;
+
+            bool Matches(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize) const;
+
+            Message *            mMessage;
+            Mac::Address         mSource;
+            TimeMilli            mStartTime;
+            uint16_t             mDatagramTag;
+            uint16_t             mDatagramSize;
+            uint16_t             mReceivedLength;
+            uint16_t             mNextOffset;
+            uint8_t              mNext; // Index (plus one) of the next entry in the same bucket, zero if none.
+            BitVector<kNumUnits> mReceivedUnits;
+        };
+
+        ReassemblyTable(void) { Clear(); }
+
+        Entry *  Allocate(Message &aMessage, const Mac::Address &aSource, uint16_t aTag, uint16_t aSize);
+        Entry *  Find(const Mac::Address &aSource, uint16_t aTag, uint16_t aSize);
+        void     Remove(const Message &aMessage);
+        bool     IsFull(void) const;
+        Message *GetOldestMessage(void) const;
+
+    private:
+        static constexpr uint8_t kNumEntries = OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENTRIES;
+        static constexpr uint8_t kNumBuckets = 8; // Must be a power of two.
+
+        static_assert(kNumEntries < 0xff, "OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENTRIES is too large");
+
+        static uint8_t Hash(const Mac::Address &aSource, uint16_t aTag);
+
+        // Heads of the hash bucket chains, stored as entry index plus one (zero for an empty bucket).
+        uint8_t mBuckets[kNumBuckets];
+        Entry   mEntries[kNumEntries];
+    };
+#endif // OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    class FairScheduler : public Clearable<FairScheduler>
+    {
+    public:
+        FairScheduler(void) { Clear(); }
+
+        Message *       SelectDirectMessage(const PriorityQueue &aQueue);
+        Message *       SelectEvictionCandidate(const PriorityQueue &aQueue, Message::Priority aPriority) const;
+        uint16_t        CountDirectMessages(const PriorityQueue &aQueue, uint8_t aBucket) const;
+        static uint8_t  GetBucket(const Message &aMessage);
+        static uint16_t GetDestinationKey(const Message &aMessage);
+
+    private:
+        static constexpr uint8_t  kNumBuckets = OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_BUCKETS;
+        static constexpr uint16_t kQuantum    = OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_QUANTUM;
+
+        static_assert((kNumBuckets & (kNumBuckets - 1)) == 0, "FAIR_QUEUEING_BUCKETS must be a power of two");
+
+        Message *SelectDirectMessage(const PriorityQueue &aQueue, Message::Priority aPriority);
+
+        uint16_t mDeficits[Message::kNumPriorities][kNumBuckets];
+        uint8_t  mCurrentBuckets[Message::kNumPriorities];
+    };
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+
     void  SendIcmpErrorIfDstUnreach(const Message &     aMessage,
                                     const Mac::Address &aMacSource,
                                     const Mac::Address &aMacDest);
@@ -456,6 +570,14 @@ private:
                                  Message::Priority       aPriority);
     Error HandleDatagram(Message &aMessage, const ThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void  ClearReassemblyList(void);
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    void EvictOldestReassemblyMessage(void);
+    void UpdateReassemblyLatency(const ReassemblyTable::Entry &aEntry);
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    void EnforceDestinationLimit(const Message &aMessage);
+    void RecordSendQueueDelay(const Message &aMessage);
+#endif
     void  RemoveMessage(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
@@ -580,6 +702,16 @@ private:
 
     otIpCounters mIpCounters;
 
+#if OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE
+    ReassemblyTable      mReassemblyTable;
+    otReassemblyCounters mReassemblyCounters;
+#endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    FairScheduler    mFairScheduler;
+    otSendQueueStats mSendQueueStats;
+#endif
+
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
     PriorityQueue        mResolvingQueue;
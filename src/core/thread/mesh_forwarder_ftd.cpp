@@ -55,6 +55,9 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
     mSendQueue.Enqueue(aMessage);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    aMessage.SetSendQueueTime(TimerMilli::GetNow());
+#endif
 
     switch (aMessage.GetType())
     {
@@ -134,6 +137,13 @@ Error MeshForwarder::SendMessage(Message &aMessage)
         break;
     }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    if (aMessage.GetDirectTransmission())
+    {
+        EnforceDestinationLimit(aMessage);
+    }
+#endif
+
     mScheduleTransmissionTask.Post();
 
     return error;
@@ -163,6 +173,9 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
             if (aError == kErrorNone)
             {
                 mSendQueue.Enqueue(*cur);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+                cur->SetSendQueueTime(TimerMilli::GetNow());
+#endif
                 enqueuedMessage = true;
             }
             else
@@ -212,6 +225,13 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority)
 
     if (evict != nullptr)
     {
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+        if (evict->GetPriorityQueue() == &mSendQueue)
+        {
+            evict = mFairScheduler.SelectEvictionCandidate(mSendQueue, evict->GetPriority());
+        }
+#endif
+
         ExitNow(error = kErrorNone);
     }
 
@@ -248,6 +268,45 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+void MeshForwarder::EnforceDestinationLimit(const Message &aMessage)
+{
+    static constexpr uint16_t kDestinationLimit = OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_DESTINATION_LIMIT;
+
+    uint8_t bucket = FairScheduler::GetBucket(aMessage);
+
+    VerifyOrExit(mFairScheduler.CountDirectMessages(mSendQueue, bucket) > kDestinationLimit);
+
+    // Evict the oldest message of the lowest priority queued for the same destination bucket. Messages with a higher
+    // priority, messages also destined for sleepy children and the message currently being sent are never evicted.
+
+    for (uint8_t priority = 0; priority <= aMessage.GetPriority(); priority++)
+    {
+        for (Message *message = mSendQueue.GetHeadForPriority(static_cast<Message::Priority>(priority));
+             message != nullptr; message = message->GetNext())
+        {
+            if (message->GetPriority() != priority)
+            {
+                break;
+            }
+
+            if ((message == &aMessage) || (message == mSendMessage) || !message->GetDirectTransmission() ||
+                message->IsChildPending() || message->GetDoNotEvict() || (FairScheduler::GetBucket(*message) != bucket))
+            {
+                continue;
+            }
+
+            mSendQueueStats.mDestinationLimitEvictions++;
+            RemoveMessage(*message);
+            ExitNow();
+        }
+    }
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+
 void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
 {
     Message *nextMessage;
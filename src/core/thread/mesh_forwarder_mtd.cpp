@@ -44,6 +44,9 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetDatagramTag(0);
 
     mSendQueue.Enqueue(aMessage);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE
+    aMessage.SetSendQueueTime(TimerMilli::GetNow());
+#endif
     mScheduleTransmissionTask.Post();
 
     return kErrorNone;
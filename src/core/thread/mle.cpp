@@ -2631,7 +2631,6 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
     uint8_t          nonce[Crypto::AesCcm::kNonceSize];
     uint8_t          tag[kMleSecurityTagSize];
     Crypto::AesCcm   aesCcm;
-    uint8_t          buf[64];
     uint16_t         length;
     Ip6::MessageInfo messageInfo;
 
@@ -2649,7 +2648,7 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         Crypto::AesCcm::GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(),
                                       Mac::Frame::kSecEncMic32, nonce);
 
-        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey());
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKeyEcb());
         aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1), sizeof(tag),
                     nonce, sizeof(nonce));
 
@@ -2659,13 +2658,9 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
 
         aMessage.SetOffset(header.GetLength() - 1);
 
-        while (aMessage.GetOffset() < aMessage.GetLength())
-        {
-            length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
-            aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kEncrypt);
-            aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
-            aMessage.MoveOffset(length);
-        }
+        length = aMessage.GetLength() - aMessage.GetOffset();
+        aesCcm.Payload(aMessage, aMessage.GetOffset(), length, Crypto::AesCcm::kEncrypt);
+        aMessage.MoveOffset(length);
 
         aesCcm.Finalize(tag);
         SuccessOrExit(error = aMessage.AppendBytes(tag, sizeof(tag)));
@@ -2709,21 +2704,19 @@ void Mle::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageI
 
 void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    Error              error = kErrorNone;
-    Header             header;
-    uint32_t           keySequence;
-    const KeyMaterial *mleKey;
-    uint32_t           frameCounter;
-    uint8_t            messageTag[kMleSecurityTagSize];
-    uint8_t            nonce[Crypto::AesCcm::kNonceSize];
-    Mac::ExtAddress    extAddr;
-    Crypto::AesCcm     aesCcm;
-    uint16_t           mleOffset;
-    uint8_t            buf[64];
-    uint16_t           length;
-    uint8_t            tag[kMleSecurityTagSize];
-    uint8_t            command;
-    Neighbor *         neighbor;
+    Error           error = kErrorNone;
+    Header          header;
+    uint32_t        keySequence;
+    uint32_t        frameCounter;
+    uint8_t         messageTag[kMleSecurityTagSize];
+    uint8_t         nonce[Crypto::AesCcm::kNonceSize];
+    Mac::ExtAddress extAddr;
+    Crypto::AesCcm  aesCcm;
+    uint16_t        mleOffset;
+    uint16_t        length;
+    uint8_t         tag[kMleSecurityTagSize];
+    uint8_t         command;
+    Neighbor *      neighbor;
 
     otLogDebgMle("Receive UDP message");
 
@@ -2763,11 +2756,11 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     if (keySequence == Get<KeyManager>().GetCurrentKeySequence())
     {
-        mleKey = &Get<KeyManager>().GetCurrentMleKey();
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKeyEcb());
     }
     else
     {
-        mleKey = &Get<KeyManager>().GetTemporaryMleKey(keySequence);
+        aesCcm.SetKey(Get<KeyManager>().GetTemporaryMleKey(keySequence));
     }
 
     VerifyOrExit(aMessage.GetOffset() + header.GetLength() + sizeof(messageTag) <= aMessage.GetLength(),
@@ -2782,7 +2775,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     Crypto::AesCcm::GenerateNonce(extAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(*mleKey);
     aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                 aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce));
 
@@ -2792,15 +2784,9 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     mleOffset = aMessage.GetOffset();
 
-    while (aMessage.GetOffset() < aMessage.GetLength())
-    {
-        length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
-        aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kDecrypt);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
+    aesCcm.Payload(aMessage, mleOffset, aMessage.GetLength() - mleOffset, Crypto::AesCcm::kDecrypt);
 #endif
-        aMessage.MoveOffset(length);
-    }
 
     aesCcm.Finalize(tag);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
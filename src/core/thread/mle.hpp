@@ -1763,6 +1763,10 @@ private:
         uint8_t  mCommand;
     } OT_TOOL_PACKED_END;
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventIp6AddressAdded | kEventIp6AddressRemoved | kEventIp6MulticastSubscribed |
+        kEventIp6MulticastUnsubscribed | kEventThreadNetdataChanged | kEventThreadKeySeqCounterChanged;
+
     Error       Start(StartMode aMode);
     void        Stop(StopMode aMode);
     void        HandleNotifierEvents(Events aEvents);
@@ -142,6 +142,8 @@ public:
 #endif
 
 private:
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventIp6MulticastSubscribed;
+
     void HandleNotifierEvents(Events aEvents);
 
     void  SendMulticastListenerRegistration(void);
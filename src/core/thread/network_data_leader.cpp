@@ -58,6 +58,9 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    InvalidateLookupIndex();
+#endif
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -117,20 +120,40 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         aContext.mCompressFlag = true;
     }
 
-    while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    if (UpdateLookupIndex())
     {
-        contextTlv = prefix->FindSubTlv<ContextTlv>();
-
-        if (contextTlv == nullptr)
+        for (uint8_t i = 0; i < mLookupIndex.mNumPrefixes; i++)
         {
-            continue;
-        }
+            const IndexedPrefix &indexedPrefix = mLookupIndex.mPrefixes[i];
 
-        if (prefix->GetPrefixLength() > aContext.mPrefix.GetLength())
+            if (indexedPrefix.mHasContext && (indexedPrefix.mPrefix.GetLength() > aContext.mPrefix.GetLength()) &&
+                indexedPrefix.Matches(aAddress))
+            {
+                aContext.mPrefix       = indexedPrefix.mPrefix;
+                aContext.mContextId    = indexedPrefix.mContextId;
+                aContext.mCompressFlag = indexedPrefix.mCompress;
+            }
+        }
+    }
+    else
+#endif
+    {
+        while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
         {
-            aContext.mPrefix.Set(prefix->GetPrefix(), prefix->GetPrefixLength());
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
+            contextTlv = prefix->FindSubTlv<ContextTlv>();
+
+            if (contextTlv == nullptr)
+            {
+                continue;
+            }
+
+            if (prefix->GetPrefixLength() > aContext.mPrefix.GetLength())
+            {
+                aContext.mPrefix.Set(prefix->GetPrefix(), prefix->GetPrefixLength());
+                aContext.mContextId    = contextTlv->GetContextId();
+                aContext.mCompressFlag = contextTlv->IsCompress();
+            }
         }
     }
 
@@ -151,6 +174,22 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    if (UpdateLookupIndex())
+    {
+        const IndexedPrefix *indexedPrefix;
+
+        VerifyOrExit(aContextId < kIndexNumContexts);
+        VerifyOrExit(mLookupIndex.mContexts[aContextId] != kIndexNoPrefix);
+
+        indexedPrefix          = &mLookupIndex.mPrefixes[mLookupIndex.mContexts[aContextId]];
+        aContext.mPrefix       = indexedPrefix->mPrefix;
+        aContext.mContextId    = indexedPrefix->mContextId;
+        aContext.mCompressFlag = indexedPrefix->mCompress;
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
     while ((prefix = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
         const ContextTlv *contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -177,6 +216,23 @@ bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 
     VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), rval = true);
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    if (UpdateLookupIndex())
+    {
+        for (uint8_t i = 0; i < mLookupIndex.mNumPrefixes; i++)
+        {
+            const IndexedPrefix &indexedPrefix = mLookupIndex.mPrefixes[i];
+
+            if (indexedPrefix.mIsOnMesh && indexedPrefix.Matches(aAddress))
+            {
+                ExitNow(rval = true);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         // check both stable and temporary Border Router TLVs
@@ -212,6 +268,39 @@ Error LeaderBase::RouteLookup(const Ip6::Address &aSource,
     Error            error  = kErrorNoRoute;
     const PrefixTlv *prefix = nullptr;
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    if (UpdateLookupIndex())
+    {
+        for (uint8_t i = 0; i < mLookupIndex.mNumPrefixes; i++)
+        {
+            const IndexedPrefix &indexedPrefix = mLookupIndex.mPrefixes[i];
+
+            if (!indexedPrefix.Matches(aSource))
+            {
+                continue;
+            }
+
+            if (ExternalRouteLookup(indexedPrefix.mDomainId, aDestination, aPrefixMatchLength, aRloc16) ==
+                kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
+
+            if (DefaultRouteLookup(indexedPrefix, aRloc16) == kErrorNone)
+            {
+                if (aPrefixMatchLength)
+                {
+                    *aPrefixMatchLength = 0;
+                }
+
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefix = FindNextMatchingPrefix(aSource, prefix)) != nullptr)
     {
         if (ExternalRouteLookup(prefix->GetDomainId(), aDestination, aPrefixMatchLength, aRloc16) == kErrorNone)
@@ -234,6 +323,23 @@ exit:
     return error;
 }
 
+bool LeaderBase::IsPreferredRoute(uint16_t aRloc16,
+                                  int8_t   aPreference,
+                                  uint16_t aOtherRloc16,
+                                  int8_t   aOtherPreference) const
+{
+    // A route is preferred over another if it has a higher preference.
+    // On equal preference, a route through this device is preferred,
+    // then the one with the lower path cost.
+
+    uint16_t rloc16 = Get<Mle::MleRouter>().GetRloc16();
+
+    return (aPreference > aOtherPreference) ||
+           ((aPreference == aOtherPreference) &&
+            ((aRloc16 == rloc16) || ((aOtherRloc16 != rloc16) && (Get<Mle::MleRouter>().GetCost(aRloc16) <
+                                                                   Get<Mle::MleRouter>().GetCost(aOtherRloc16)))));
+}
+
 Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
                                       const Ip6::Address &aDestination,
                                       uint8_t *           aPrefixMatchLength,
@@ -244,6 +350,45 @@ Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
     const PrefixTlv *    prefixTlv;
     const HasRouteEntry *bestRouteEntry  = nullptr;
     uint8_t              bestMatchLength = 0;
+    uint16_t             bestRloc16      = Mac::kShortAddrInvalid;
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    if (UpdateLookupIndex())
+    {
+        const IndexedRoute *bestRoute = nullptr;
+
+        for (uint8_t i = 0; i < mLookupIndex.mNumPrefixes; i++)
+        {
+            const IndexedPrefix &indexedPrefix = mLookupIndex.mPrefixes[i];
+
+            if ((indexedPrefix.mDomainId != aDomainId) || !indexedPrefix.Matches(aDestination))
+            {
+                continue;
+            }
+
+            if ((bestRoute != nullptr) && (indexedPrefix.mPrefix.GetLength() <= bestMatchLength))
+            {
+                continue;
+            }
+
+            for (uint8_t j = indexedPrefix.mRoutesStart; j < indexedPrefix.mDefaultRoutesStart; j++)
+            {
+                const IndexedRoute &route = mLookupIndex.mRoutes[j];
+
+                if (bestRoute == nullptr ||
+                    IsPreferredRoute(route.mRloc16, route.mPreference, bestRoute->mRloc16, bestRoute->mPreference))
+                {
+                    bestRoute       = &route;
+                    bestMatchLength = indexedPrefix.mPrefix.GetLength();
+                }
+            }
+        }
+
+        VerifyOrExit(bestRoute != nullptr);
+        bestRloc16 = bestRoute->mRloc16;
+        ExitNow(error = kErrorNone);
+    }
+#endif
 
     while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
@@ -271,12 +416,9 @@ Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
             for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
                  entry                      = entry->GetNext())
             {
-                if (bestRouteEntry == nullptr || entry->GetPreference() > bestRouteEntry->GetPreference() ||
-                    (entry->GetPreference() == bestRouteEntry->GetPreference() &&
-                     (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                      (bestRouteEntry->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                       Get<Mle::MleRouter>().GetCost(entry->GetRloc()) <
-                           Get<Mle::MleRouter>().GetCost(bestRouteEntry->GetRloc())))))
+                if (bestRouteEntry == nullptr || IsPreferredRoute(entry->GetRloc(), entry->GetPreference(),
+                                                                  bestRouteEntry->GetRloc(),
+                                                                  bestRouteEntry->GetPreference()))
                 {
                     bestRouteEntry  = entry;
                     bestMatchLength = prefixLength;
@@ -285,19 +427,22 @@ Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
         }
     }
 
-    if (bestRouteEntry != nullptr)
+    VerifyOrExit(bestRouteEntry != nullptr);
+    bestRloc16 = bestRouteEntry->GetRloc();
+    error      = kErrorNone;
+
+exit:
+    if (error == kErrorNone)
     {
         if (aRloc16 != nullptr)
         {
-            *aRloc16 = bestRouteEntry->GetRloc();
+            *aRloc16 = bestRloc16;
         }
 
         if (aPrefixMatchLength != nullptr)
         {
             *aPrefixMatchLength = bestMatchLength;
         }
-
-        error = kErrorNone;
     }
 
     return error;
@@ -320,11 +465,8 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16
                 continue;
             }
 
-            if (route == nullptr || entry->GetPreference() > route->GetPreference() ||
-                (entry->GetPreference() == route->GetPreference() &&
-                 (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                  (route->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                   Get<Mle::MleRouter>().GetCost(entry->GetRloc()) < Get<Mle::MleRouter>().GetCost(route->GetRloc())))))
+            if (route == nullptr ||
+                IsPreferredRoute(entry->GetRloc(), entry->GetPreference(), route->GetRloc(), route->GetPreference()))
             {
                 route = entry;
             }
@@ -344,6 +486,158 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16
     return error;
 }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+
+Error LeaderBase::DefaultRouteLookup(const IndexedPrefix &aPrefix, uint16_t *aRloc16) const
+{
+    Error               error = kErrorNoRoute;
+    const IndexedRoute *route = nullptr;
+
+    for (uint8_t i = aPrefix.mDefaultRoutesStart; i < aPrefix.mRoutesEnd; i++)
+    {
+        const IndexedRoute &entry = mLookupIndex.mRoutes[i];
+
+        if (route == nullptr || IsPreferredRoute(entry.mRloc16, entry.mPreference, route->mRloc16, route->mPreference))
+        {
+            route = &entry;
+        }
+    }
+
+    if (route != nullptr)
+    {
+        if (aRloc16 != nullptr)
+        {
+            *aRloc16 = route->mRloc16;
+        }
+
+        error = kErrorNone;
+    }
+
+    return error;
+}
+
+bool LeaderBase::UpdateLookupIndex(void) const
+{
+    if ((mLookupIndex.mState == LookupIndex::kStateStale) || (mLookupIndex.mVersion != mVersion) ||
+        (mLookupIndex.mStableVersion != mStableVersion) || (mLookupIndex.mLength != mLength))
+    {
+        BuildLookupIndex();
+    }
+
+    return (mLookupIndex.mState == LookupIndex::kStateValid);
+}
+
+void LeaderBase::BuildLookupIndex(void) const
+{
+    LookupIndex &    index = mLookupIndex;
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+    uint8_t          numRoutes = 0;
+
+    index.mState         = LookupIndex::kStateOverflow;
+    index.mVersion       = mVersion;
+    index.mStableVersion = mStableVersion;
+    index.mLength        = mLength;
+    index.mNumPrefixes   = 0;
+    memset(index.mContexts, kIndexNoPrefix, sizeof(index.mContexts));
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        const ContextTlv *     contextTlv;
+        const HasRouteTlv *    hasRoute;
+        const BorderRouterTlv *borderRouter;
+        TlvIterator            hasRouteIterator(*prefixTlv);
+        TlvIterator            borderRouterIterator(*prefixTlv);
+
+        VerifyOrExit(index.mNumPrefixes < kIndexMaxPrefixes);
+        VerifyOrExit(prefixTlv->IsValid());
+
+        IndexedPrefix &indexedPrefix = index.mPrefixes[index.mNumPrefixes];
+
+        indexedPrefix.mPrefix.Set(prefixTlv->GetPrefix(), prefixTlv->GetPrefixLength());
+        indexedPrefix.mDomainId = prefixTlv->GetDomainId();
+
+        contextTlv                 = prefixTlv->FindSubTlv<ContextTlv>();
+        indexedPrefix.mHasContext  = (contextTlv != nullptr);
+        indexedPrefix.mContextId   = (contextTlv != nullptr) ? contextTlv->GetContextId() : 0;
+        indexedPrefix.mCompress    = (contextTlv != nullptr) && contextTlv->IsCompress();
+
+        if ((contextTlv != nullptr) && (index.mContexts[contextTlv->GetContextId()] == kIndexNoPrefix))
+        {
+            index.mContexts[contextTlv->GetContextId()] = index.mNumPrefixes;
+        }
+
+        // Same as `IsOnMesh()`, check the first stable and the first
+        // temporary Border Router TLVs.
+        indexedPrefix.mIsOnMesh = false;
+
+        for (int i = 0; i < 2; i++)
+        {
+            borderRouter = prefixTlv->FindSubTlv<BorderRouterTlv>(/* aStable */ (i == 0));
+
+            if (borderRouter == nullptr)
+            {
+                continue;
+            }
+
+            for (const BorderRouterEntry *entry = borderRouter->GetFirstEntry(); entry <= borderRouter->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                if (entry->IsOnMesh())
+                {
+                    indexedPrefix.mIsOnMesh = true;
+                }
+            }
+        }
+
+        indexedPrefix.mRoutesStart = numRoutes;
+
+        while ((hasRoute = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+        {
+            for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
+                 entry                      = entry->GetNext())
+            {
+                VerifyOrExit(numRoutes < kIndexMaxRoutes);
+                index.mRoutes[numRoutes].mRloc16     = entry->GetRloc();
+                index.mRoutes[numRoutes].mPreference = entry->GetPreference();
+                numRoutes++;
+            }
+        }
+
+        indexedPrefix.mDefaultRoutesStart = numRoutes;
+
+        while ((borderRouter = borderRouterIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            for (const BorderRouterEntry *entry = borderRouter->GetFirstEntry(); entry <= borderRouter->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                if (!entry->IsDefaultRoute())
+                {
+                    continue;
+                }
+
+                VerifyOrExit(numRoutes < kIndexMaxRoutes);
+                index.mRoutes[numRoutes].mRloc16     = entry->GetRloc();
+                index.mRoutes[numRoutes].mPreference = entry->GetPreference();
+                numRoutes++;
+            }
+        }
+
+        indexedPrefix.mRoutesEnd = numRoutes;
+        index.mNumPrefixes++;
+    }
+
+    index.mState = LookupIndex::kStateValid;
+
+exit:
+    if (index.mState != LookupIndex::kStateValid)
+    {
+        otLogInfoNetData("Network Data does not fit in lookup index, parsing TLVs on lookups");
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+
 Error LeaderBase::SetNetworkData(uint8_t        aVersion,
                                  uint8_t        aStableVersion,
                                  bool           aStableOnly,
@@ -356,6 +650,10 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
 
     SuccessOrExit(error = aMessage.Read(aMessageOffset, tlv));
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    InvalidateLookupIndex();
+#endif
+
     length = aMessage.ReadBytes(aMessageOffset + sizeof(tlv), mTlvs, tlv.GetLength());
     VerifyOrExit(length == tlv.GetLength(), error = kErrorParse);
 
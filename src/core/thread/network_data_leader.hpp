@@ -291,7 +291,73 @@ private:
                               uint8_t *           aPrefixMatchLength,
                               uint16_t *          aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16) const;
+    bool  IsPreferredRoute(uint16_t aRloc16, int8_t aPreference, uint16_t aOtherRloc16, int8_t aOtherPreference) const;
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE
+    // The lookup index is a parsed copy of the Prefix TLVs (kept in
+    // Network Data order) with their contexts, on-mesh flags and route
+    // entries. It is rebuilt on the first lookup after the Network Data
+    // changes (tracked by the versions and length, and explicitly
+    // invalidated when new Network Data is set). Route selection still
+    // evaluates path costs on each lookup since they change independently
+    // of the Network Data.
+
+    static constexpr uint8_t kIndexMaxPrefixes = OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_PREFIXES;
+    static constexpr uint8_t kIndexMaxRoutes   = OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_MAX_ROUTES;
+    static constexpr uint8_t kIndexNumContexts = 16;   // Context ID is 4 bits.
+    static constexpr uint8_t kIndexNoPrefix    = 0xff; // No prefix in `mContexts[]`.
+
+    static_assert(kIndexMaxPrefixes < kIndexNoPrefix, "TMF_NETDATA_LOOKUP_INDEX_MAX_PREFIXES is too large");
+    static_assert(kIndexMaxRoutes <= 255, "TMF_NETDATA_LOOKUP_INDEX_MAX_ROUTES is too large");
+
+    struct IndexedRoute
+    {
+        uint16_t mRloc16;
+        int8_t   mPreference;
+    };
+
+    struct IndexedPrefix
+    {
+        bool Matches(const Ip6::Address &aAddress) const { return aAddress.MatchesPrefix(mPrefix); }
+
+        Ip6::Prefix mPrefix;
+        uint8_t     mDomainId;
+        uint8_t     mContextId;
+        bool        mHasContext : 1;
+        bool        mCompress : 1;
+        bool        mIsOnMesh : 1;
+        uint8_t     mRoutesStart;        // Has Route entries are in [mRoutesStart, mDefaultRoutesStart).
+        uint8_t     mDefaultRoutesStart; // Default route Border Router entries are in [mDefaultRoutesStart, mRoutesEnd).
+        uint8_t     mRoutesEnd;
+    };
+
+    struct LookupIndex
+    {
+        enum State : uint8_t
+        {
+            kStateStale,    // Needs to be rebuilt.
+            kStateValid,    // Matches the Network Data.
+            kStateOverflow, // Network Data does not fit, lookups parse the TLVs.
+        };
+
+        State         mState;
+        uint8_t       mVersion;
+        uint8_t       mStableVersion;
+        uint8_t       mLength;
+        uint8_t       mNumPrefixes;
+        uint8_t       mContexts[kIndexNumContexts];
+        IndexedPrefix mPrefixes[kIndexMaxPrefixes];
+        IndexedRoute  mRoutes[kIndexMaxRoutes];
+    };
+
+    void  InvalidateLookupIndex(void) { mLookupIndex.mState = LookupIndex::kStateStale; }
+    bool  UpdateLookupIndex(void) const;
+    void  BuildLookupIndex(void) const;
+    Error DefaultRouteLookup(const IndexedPrefix &aPrefix, uint16_t *aRloc16) const;
+
+    mutable LookupIndex mLookupIndex;
+#endif
 };
 
 /**
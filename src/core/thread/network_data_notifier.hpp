@@ -74,6 +74,9 @@ private:
     static constexpr uint32_t kDelayRemoveStaleChildren   = 5000;   // in msec
     static constexpr uint32_t kDelaySynchronizeServerData = 300000; // in msec
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadChildRemoved | kEventThreadNetdataChanged;
+
     void HandleNotifierEvents(Events aEvents);
 
     static void HandleTimer(Timer &aTimer);
@@ -438,6 +438,9 @@ private:
     void               NotifyPrefixEntryChange(Event aEvent, const Ip6::Prefix &aPrefix) const;
 #endif
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadNetdataChanged | kEventThreadMeshLocalAddrChanged;
+
     TimerMilli &GetTimer(void) { return mTimer; }
     void        HandleNotifierEvents(Events aEvents);
     static void HandleTimer(Timer &aTimer);
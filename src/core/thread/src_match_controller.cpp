@@ -51,7 +51,13 @@ namespace ot {
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    , mNumInTable(0)
+    , mTableCapacity(0)
+    , mFlushTasklet(aInstance, HandleFlushTasklet)
+#endif
 {
+    ResetCounters();
     ClearTable();
 }
 
@@ -113,6 +119,17 @@ void SourceMatchController::ClearTable(void)
 {
     Get<Radio>().ClearSrcMatchShortEntries();
     Get<Radio>().ClearSrcMatchExtEntries();
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    for (MirrorEntry &entry : mMirror)
+    {
+        entry.mInTable      = false;
+        entry.mClearPending = false;
+    }
+
+    mNumInTable = 0;
+#endif
+
     otLogDebgMac("SrcAddrMatch - Cleared all entries");
 }
 
@@ -134,7 +151,7 @@ void SourceMatchController::AddEntry(Child &aChild)
     }
     else
     {
-        VerifyOrExit(AddAddress(aChild) == kErrorNone, Enable(false));
+        VerifyOrExit(AddAddress(aChild) == kErrorNone, HandleTableFull());
         aChild.SetIndirectSourceMatchPending(false);
     }
 
@@ -142,7 +159,73 @@ exit:
     return;
 }
 
+void SourceMatchController::HandleTableFull(void)
+{
+    mCounters.mTableFullEvents++;
+    otLogInfoMac("SrcAddrMatch - Table full, disabling");
+    Enable(false);
+}
+
 Error SourceMatchController::AddAddress(const Child &aChild)
+{
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    MirrorEntry &entry = GetMirrorEntry(aChild);
+
+    if (entry.mInTable)
+    {
+        if (entry.mClearPending && entry.Matches(aChild))
+        {
+            // The address was not cleared from the table yet, so
+            // there is nothing to tell the radio.
+            entry.mClearPending = false;
+            mCounters.mCoalescedClears++;
+            ExitNow();
+        }
+
+        // The entry holds the address of a previous child (or the
+        // other address of this child), it needs to be cleared first.
+        IgnoreError(ClearMirrorEntry(entry));
+    }
+
+    if (!HasRoomFor(1) && (FlushPendingClears() == 0 || !HasRoomFor(1)))
+    {
+        mCounters.mSkippedAdds++;
+        ExitNow(error = kErrorNoBufs);
+    }
+#endif
+
+    error = ProgramAddress(aChild);
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    if (error == kErrorNoBufs)
+    {
+        // Remember the capacity of the table so that further
+        // additions are not attempted while it is full.
+        mTableCapacity = mNumInTable;
+
+        if (FlushPendingClears() > 0)
+        {
+            error = ProgramAddress(aChild);
+        }
+    }
+
+    SuccessOrExit(error);
+
+    entry.mInTable      = true;
+    entry.mIsShort      = aChild.IsIndirectSourceMatchShort();
+    entry.mClearPending = false;
+    entry.mShortAddress = aChild.GetRloc16();
+    entry.mExtAddress.Set(aChild.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+    mNumInTable++;
+
+exit:
+#endif
+    return error;
+}
+
+Error SourceMatchController::ProgramAddress(const Child &aChild)
 {
     Error error = kErrorNone;
 
@@ -164,13 +247,16 @@ Error SourceMatchController::AddAddress(const Child &aChild)
                      ErrorToString(error), error);
     }
 
+    if (error == kErrorNone)
+    {
+        mCounters.mAddressAdds++;
+    }
+
     return error;
 }
 
 void SourceMatchController::ClearEntry(Child &aChild)
 {
-    Error error = kErrorNone;
-
     if (aChild.IsIndirectSourceMatchPending())
     {
         otLogDebgMac("SrcAddrMatch - Clearing pending flag for 0x%04x", aChild.GetRloc16());
@@ -178,6 +264,40 @@ void SourceMatchController::ClearEntry(Child &aChild)
         ExitNow();
     }
 
+    SuccessOrExit(ClearAddress(aChild));
+
+    if (!IsEnabled())
+    {
+        SuccessOrExit(AddPendingEntries());
+        Enable(true);
+    }
+
+exit:
+    return;
+}
+
+Error SourceMatchController::ClearAddress(Child &aChild)
+{
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    MirrorEntry &entry = GetMirrorEntry(aChild);
+
+    VerifyOrExit(entry.mInTable && !entry.mClearPending, error = kErrorNotFound);
+
+    if (IsEnabled())
+    {
+        // Clearing is deferred, if the child gets a new frame before
+        // the tasklet runs the address simply stays in the table.
+        entry.mClearPending = true;
+        mFlushTasklet.Post();
+        ExitNow();
+    }
+
+    // While source matching is disabled, the room is needed right
+    // away to add the pending entries.
+    error = ClearMirrorEntry(entry);
+#else
     if (aChild.IsIndirectSourceMatchShort())
     {
         error = Get<Radio>().ClearSrcMatchShortEntry(aChild.GetRloc16());
@@ -197,21 +317,40 @@ void SourceMatchController::ClearEntry(Child &aChild)
     }
 
     SuccessOrExit(error);
-
-    if (!IsEnabled())
-    {
-        SuccessOrExit(AddPendingEntries());
-        Enable(true);
-    }
+    mCounters.mAddressClears++;
+#endif
 
 exit:
-    return;
+    return error;
 }
 
 Error SourceMatchController::AddPendingEntries(void)
 {
     Error error = kErrorNone;
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    // When the table cannot hold all the pending entries, the children
+    // with the most queued messages are added first. They stay in the
+    // table the longest, so source matching can be enabled again as
+    // soon as the children with fewer messages are served.
+    while (true)
+    {
+        Child *next = nullptr;
+
+        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+        {
+            if (child.IsIndirectSourceMatchPending() &&
+                (next == nullptr || child.GetIndirectMessageCount() > next->GetIndirectMessageCount()))
+            {
+                next = &child;
+            }
+        }
+
+        VerifyOrExit(next != nullptr);
+        SuccessOrExit(error = AddAddress(*next));
+        next->SetIndirectSourceMatchPending(false);
+    }
+#else
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
     {
         if (child.IsIndirectSourceMatchPending())
@@ -220,11 +359,112 @@ Error SourceMatchController::AddPendingEntries(void)
             child.SetIndirectSourceMatchPending(false);
         }
     }
+#endif
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+
+bool SourceMatchController::MirrorEntry::Matches(const Child &aChild) const
+{
+    bool matches;
+
+    if (mIsShort)
+    {
+        matches = aChild.IsIndirectSourceMatchShort() && (mShortAddress == aChild.GetRloc16());
+    }
+    else
+    {
+        Mac::ExtAddress address;
+
+        address.Set(aChild.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+        matches = !aChild.IsIndirectSourceMatchShort() && (mExtAddress == address);
+    }
+
+    return matches;
+}
+
+SourceMatchController::MirrorEntry &SourceMatchController::GetMirrorEntry(const Child &aChild)
+{
+    return mMirror[Get<ChildTable>().GetChildIndex(aChild)];
+}
+
+Error SourceMatchController::ClearMirrorEntry(MirrorEntry &aEntry)
+{
+    Error error;
+
+    if (aEntry.mIsShort)
+    {
+        error = Get<Radio>().ClearSrcMatchShortEntry(aEntry.mShortAddress);
+
+        otLogDebgMac("SrcAddrMatch - Clearing short addr: 0x%04x -- %s (%d)", aEntry.mShortAddress,
+                     ErrorToString(error), error);
+    }
+    else
+    {
+        error = Get<Radio>().ClearSrcMatchExtEntry(aEntry.mExtAddress);
+
+        otLogDebgMac("SrcAddrMatch - Clearing addr: %s -- %s (%d)", aEntry.mExtAddress.ToString().AsCString(),
+                     ErrorToString(error), error);
+    }
+
+    // The address is gone from the table even if the radio did not
+    // know about it.
+    aEntry.mInTable      = false;
+    aEntry.mClearPending = false;
+    mNumInTable--;
+
+    if (error == kErrorNone)
+    {
+        mCounters.mAddressClears++;
+    }
+
+    return error;
+}
+
+uint16_t SourceMatchController::FlushPendingClears(void)
+{
+    uint16_t numCleared = 0;
+
+    for (MirrorEntry &entry : mMirror)
+    {
+        if (entry.mClearPending)
+        {
+            IgnoreError(ClearMirrorEntry(entry));
+            numCleared++;
+        }
+    }
+
+    return numCleared;
+}
+
+bool SourceMatchController::HasRoomFor(uint16_t aNumEntries) const
+{
+    return (mTableCapacity == 0) || (mNumInTable + aNumEntries <= mTableCapacity);
+}
+
+void SourceMatchController::HandleFlushTasklet(Tasklet &aTasklet)
+{
+    aTasklet.Get<SourceMatchController>().HandleFlushTasklet();
+}
+
+void SourceMatchController::HandleFlushTasklet(void)
+{
+    VerifyOrExit(FlushPendingClears() > 0);
+
+    if (!IsEnabled() && AddPendingEntries() == kErrorNone)
+    {
+        Enable(true);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -38,9 +38,16 @@
 
 #if OPENTHREAD_FTD
 
+#include <string.h>
+
+#include <openthread/thread_ftd.h>
+
 #include "common/error.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
+#include "mac/mac_types.hpp"
+#include "thread/mle_types.hpp"
 
 namespace ot {
 
@@ -121,6 +128,20 @@ public:
      */
     void SetSrcMatchAsShort(Child &aChild, bool aUseShortAddress);
 
+    /**
+     * This method returns the source match counters.
+     *
+     * @returns A reference to the source match counters.
+     *
+     */
+    const otSrcMatchCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the source match counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
 private:
     /**
      * This method clears the source match table.
@@ -186,7 +207,57 @@ private:
      */
     Error AddPendingEntries(void);
 
-    bool mEnabled;
+    /**
+     * This method clears a given child's address (short or extended address depending on child's setting) from the
+     * source match table.
+     *
+     * @param[in] aChild            A reference to the child
+     *
+     * @retval kErrorNone       Child's address was cleared from the source match table.
+     * @retval kErrorNotFound   Child's address was not in the source match table.
+     *
+     */
+    Error ClearAddress(Child &aChild);
+
+    Error ProgramAddress(const Child &aChild);
+    void  HandleTableFull(void);
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    /**
+     * This class represents the mirror of a child's entry in the radio source match table.
+     *
+     * The entry keeps the address as it was programmed, so it can still be cleared after the child is removed or its
+     * short address changes.
+     *
+     */
+    struct MirrorEntry
+    {
+        bool Matches(const Child &aChild) const;
+
+        Mac::ExtAddress mExtAddress;       ///< Extended address (in the byte order of the radio).
+        uint16_t        mShortAddress;     ///< Short address.
+        bool            mInTable : 1;      ///< The address is in the radio source match table.
+        bool            mIsShort : 1;      ///< Whether the short or the extended address is in the table.
+        bool            mClearPending : 1; ///< Clearing the address from the table is deferred.
+    };
+
+    MirrorEntry &GetMirrorEntry(const Child &aChild);
+    Error        ClearMirrorEntry(MirrorEntry &aEntry);
+    uint16_t     FlushPendingClears(void);
+    bool         HasRoomFor(uint16_t aNumEntries) const;
+    static void  HandleFlushTasklet(Tasklet &aTasklet);
+    void         HandleFlushTasklet(void);
+#endif
+
+    bool               mEnabled;
+    otSrcMatchCounters mCounters;
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE
+    MirrorEntry mMirror[Mle::kMaxChildren];
+    uint16_t    mNumInTable;    ///< Number of addresses in the radio table (including the ones pending clear).
+    uint16_t    mTableCapacity; ///< Capacity of the radio table learned when it got full (zero if unknown).
+    Tasklet     mFlushTasklet;
+#endif
 };
 
 /**
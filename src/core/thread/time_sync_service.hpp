@@ -162,6 +162,8 @@ public:
     void HandleTimeout(void);
 
 private:
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged | kEventThreadPartitionIdChanged;
+
     /**
      * Callback to be called when thread state changes.
      *
@@ -154,6 +154,27 @@ bool Neighbor::MatchesFilter(StateFilter aFilter) const
     return matches;
 }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    // The child table index is keyed by the current addresses, so a
+    // child's entries are removed before an address changes and are
+    // added back afterwards. `ChildTable` ignores neighbors that are
+    // not in its table (e.g., routers or the parent).
+
+    Get<ChildTable>().RemoveFromIndex(*this);
+    mMacAddr = aAddress;
+    Get<ChildTable>().AddToIndex(*this);
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    Get<ChildTable>().RemoveFromIndex(*this);
+    mRloc16 = aRloc16;
+    Get<ChildTable>().AddToIndex(*this);
+}
+#endif
+
 void Neighbor::GenerateChallenge(void)
 {
     IgnoreError(
@@ -279,6 +300,10 @@ void Child::Clear(void)
 {
     Instance &instance = GetInstance();
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Get<ChildTable>().RemoveFromIndex(*this);
+#endif
+
     memset(reinterpret_cast<void *>(this), 0, sizeof(Child));
     Init(instance);
 }
@@ -177,6 +177,23 @@ public:
          */
         bool Matches(const Neighbor &aNeighbor) const;
 
+        /**
+         * This method returns the MAC short address (RLOC16) to match.
+         *
+         * @returns The MAC short address, or `Mac::kShortAddrInvalid` if the matcher does not match a short address.
+         *
+         */
+        Mac::ShortAddress GetShortAddress(void) const { return mShortAddress; }
+
+        /**
+         * This method returns the MAC extended address to match.
+         *
+         * @returns A pointer to the MAC extended address, or `nullptr` if the matcher does not match an extended
+         *          address.
+         *
+         */
+        const Mac::ExtAddress *GetExtAddress(void) const { return mExtAddress; }
+
     private:
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
@@ -379,7 +396,11 @@ public:
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
+#else
     void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+#endif
 
     /**
      * This method gets the key sequence value.
@@ -492,7 +513,11 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void SetRloc16(uint16_t aRloc16);
+#else
     void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+#endif
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -161,6 +161,9 @@ public:
 private:
     static constexpr uint16_t kDefaultSupervisionInterval = OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL; // (seconds)
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadChildAdded | kEventThreadChildRemoved;
+
     void SendMessage(Child &aChild);
     void CheckState(void);
     void HandleTimeTick(void);
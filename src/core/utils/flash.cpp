@@ -68,6 +68,10 @@ void Flash::Init(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    ClearIndex();
+#endif
+
     for (mSwapUsed = kSwapMarkerSize; mSwapUsed <= mSwapSize - sizeof(record); mSwapUsed += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(record));
@@ -80,6 +84,10 @@ void Flash::Init(void)
         {
             break;
         }
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+        AddIndexEntry(mSwapUsed, record);
+#endif
     }
 
     SanitizeFreeSpace();
@@ -122,6 +130,47 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
     uint32_t     offset;
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    if (mIndexValid)
+    {
+        const IndexEntry *match = nullptr;
+
+        // Same matching rules as the scan below, the last record with
+        // the given index (restarted on a first record) is used.
+
+        for (uint16_t i = 0; i < mIndexLength; i++)
+        {
+            if (mIndex[i].mKey != aKey)
+            {
+                continue;
+            }
+
+            if (mIndex[i].mFirst)
+            {
+                index = 0;
+            }
+
+            if (index == aIndex)
+            {
+                match = &mIndex[i];
+            }
+
+            index++;
+        }
+
+        VerifyOrExit(match != nullptr);
+
+        if (aValue && aValueLength)
+        {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, match->mOffset + sizeof(record), aValue,
+                            OT_MIN(*aValueLength, match->mLength));
+        }
+
+        valueLength = match->mLength;
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
     for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -157,6 +206,9 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
         index++;
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+exit:
+#endif
     if (aValueLength)
     {
         *aValueLength = valueLength;
@@ -167,8 +219,40 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
 
 Error Flash::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    return Add(aKey, true, aValue, aValueLength);
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+    VerifyOrExit(!IsValueUnchanged(aKey, aValue, aValueLength));
+#endif
+
+    error = Add(aKey, true, aValue, aValueLength);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+exit:
+#endif
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+bool Flash::IsValueUnchanged(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength) const
+{
+    // The value is unchanged if it is the only value of `aKey` and it
+    // matches `aValue`.
+
+    uint8_t  value[kMaxDataSize];
+    uint16_t length = sizeof(value);
+    bool     rval   = false;
+
+    VerifyOrExit(aValueLength <= sizeof(value));
+    VerifyOrExit(Get(aKey, 1, nullptr, nullptr) == kErrorNotFound);
+    SuccessOrExit(Get(aKey, 0, value, &length));
+
+    rval = (length == aValueLength) && ((aValueLength == 0) || (memcmp(value, aValue, aValueLength) == 0));
+
+exit:
+    return rval;
 }
+#endif
 
 Error Flash::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
@@ -198,6 +282,10 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    AddIndexEntry(mSwapUsed, record);
+#endif
+
     mSwapUsed += record.GetSize();
 
 exit:
@@ -231,6 +319,14 @@ void Flash::Swap(void)
 
     otPlatFlashErase(&GetInstance(), dstIndex);
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    if (mIndexValid)
+    {
+        dstOffset = SwapIndexedRecords(dstIndex);
+        ExitNow();
+    }
+#endif
+
     for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, sizeof(RecordHeader));
@@ -253,6 +349,14 @@ exit:
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    if (!mIndexValid)
+    {
+        // The index overflowed earlier, try again on the compacted records.
+        BuildIndex();
+    }
+#endif
 }
 
 Error Flash::Delete(uint16_t aKey, int aIndex)
@@ -261,6 +365,61 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
     int          index = 0; // This must be initalized to 0. See [Note] below.
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    if (mIndexValid)
+    {
+        // Same as the scan below, iterating over the index instead of
+        // the record headers in flash.
+
+        for (uint16_t i = 0; i < mIndexLength;)
+        {
+            IndexEntry &entry   = mIndex[i];
+            bool        deleted = false;
+
+            if (entry.mKey != aKey)
+            {
+                i++;
+                continue;
+            }
+
+            if (entry.mFirst)
+            {
+                index = 0;
+            }
+
+            if ((aIndex == index) || (aIndex == -1))
+            {
+                otPlatFlashRead(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+                record.SetDeleted();
+                otPlatFlashWrite(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+                deleted = true;
+                error   = kErrorNone;
+            }
+
+            if ((index == 1) && (aIndex == 0))
+            {
+                otPlatFlashRead(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+                record.SetFirst();
+                otPlatFlashWrite(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+                entry.mFirst = true;
+            }
+
+            index++;
+
+            if (deleted)
+            {
+                RemoveIndexEntry(i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -295,6 +454,9 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
         index++;
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -305,8 +467,143 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    ClearIndex();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+
+void Flash::ClearIndex(void)
+{
+    mIndexValid  = true;
+    mIndexLength = 0;
+}
+
+void Flash::BuildIndex(void)
+{
+    RecordHeader record;
+
+    ClearIndex();
+
+    for (uint32_t offset = kSwapMarkerSize; mIndexValid && (offset < mSwapUsed); offset += record.GetSize())
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+        AddIndexEntry(offset, record);
+    }
+}
+
+void Flash::AddIndexEntry(uint32_t aOffset, const RecordHeader &aRecord)
+{
+    IndexEntry *entry;
+
+    VerifyOrExit(mIndexValid && aRecord.IsValid());
+
+    if (mIndexLength >= kIndexMaxEntries)
+    {
+        // Fall back to scanning the record headers until the index
+        // can be rebuilt after the next swap.
+        mIndexValid = false;
+        ExitNow();
+    }
+
+    entry          = &mIndex[mIndexLength++];
+    entry->mOffset = aOffset;
+    entry->mKey    = aRecord.GetKey();
+    entry->mLength = aRecord.GetLength();
+    entry->mFirst  = aRecord.IsFirst();
+
+exit:
+    return;
+}
+
+void Flash::RemoveIndexEntry(uint16_t aEntry)
+{
+    mIndexLength--;
+    memmove(&mIndex[aEntry], &mIndex[aEntry + 1], (mIndexLength - aEntry) * sizeof(IndexEntry));
+}
+
+bool Flash::IsIndexEntryShadowed(uint16_t aEntry) const
+{
+    // A record is dropped on swap if a later valid first record with
+    // the same key exists (same as `DoesValidRecordExist()`).
+
+    bool rval = false;
+
+    for (uint16_t i = aEntry + 1; i < mIndexLength; i++)
+    {
+        if (mIndex[i].mFirst && (mIndex[i].mKey == mIndex[aEntry].mKey))
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
 }
 
+uint32_t Flash::SwapIndexedRecords(uint8_t aDstIndex)
+{
+    // Copies the records that are kept into `aDstIndex` swap area,
+    // merging adjacent records into a single run copy, and updates the
+    // index to the new offsets.
+
+    uint32_t dstOffset  = kSwapMarkerSize;
+    uint32_t runOffset  = 0;
+    uint32_t runLength  = 0;
+    uint16_t numEntries = 0;
+
+    for (uint16_t i = 0; i < mIndexLength; i++)
+    {
+        IndexEntry entry = mIndex[i];
+
+        if (IsIndexEntryShadowed(i))
+        {
+            continue;
+        }
+
+        if (entry.mOffset != runOffset + runLength)
+        {
+            CopyRecords(aDstIndex, dstOffset, runOffset, runLength);
+            dstOffset += runLength;
+            runOffset = entry.mOffset;
+            runLength = 0;
+        }
+
+        entry.mOffset = dstOffset + runLength;
+        runLength += entry.GetSize();
+
+        mIndex[numEntries++] = entry;
+    }
+
+    CopyRecords(aDstIndex, dstOffset, runOffset, runLength);
+    dstOffset += runLength;
+
+    mIndexLength = numEntries;
+
+    return dstOffset;
+}
+
+void Flash::CopyRecords(uint8_t aDstIndex, uint32_t aDstOffset, uint32_t aSrcOffset, uint32_t aLength)
+{
+    uint8_t buffer[sizeof(Record)];
+
+    while (aLength > 0)
+    {
+        uint32_t chunkLength = OT_MIN(aLength, static_cast<uint32_t>(sizeof(buffer)));
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, aSrcOffset, buffer, chunkLength);
+        otPlatFlashWrite(&GetInstance(), aDstIndex, aDstOffset, buffer, chunkLength);
+
+        aSrcOffset += chunkLength;
+        aDstOffset += chunkLength;
+        aLength -= chunkLength;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
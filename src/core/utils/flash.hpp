@@ -139,6 +139,8 @@ public:
 private:
     static constexpr uint32_t kSwapMarkerSize = 4; // in bytes
 
+    static constexpr uint16_t kMaxDataSize    = 255; // in bytes
+
     static const uint32_t sSwapActive   = 0xbe5cc5ee;
     static const uint32_t sSwapInactive = 0xbe5cc5ec;
 
@@ -208,19 +210,49 @@ private:
         }
 
     private:
-        static constexpr uint16_t kMaxDataSize = 255;
-
         uint8_t mData[kMaxDataSize];
     } OT_TOOL_PACKED_END;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    static constexpr uint16_t kIndexMaxEntries = OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES;
+
+    // One entry per valid record, kept in flash (offset) order.
+    struct IndexEntry
+    {
+        uint16_t GetSize(void) const { return sizeof(RecordHeader) + ((mLength + 3) & 0xfffc); }
+
+        uint32_t mOffset;
+        uint16_t mKey;
+        uint16_t mLength;
+        bool     mFirst;
+    };
+#endif
+
     Error Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
     bool  DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
     void  SanitizeFreeSpace(void);
     void  Swap(void);
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+    bool IsValueUnchanged(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength) const;
+#endif
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    void     ClearIndex(void);
+    void     BuildIndex(void);
+    void     AddIndexEntry(uint32_t aOffset, const RecordHeader &aRecord);
+    void     RemoveIndexEntry(uint16_t aEntry);
+    bool     IsIndexEntryShadowed(uint16_t aEntry) const;
+    uint32_t SwapIndexedRecords(uint8_t aDstIndex);
+    void     CopyRecords(uint8_t aDstIndex, uint32_t aDstOffset, uint32_t aSrcOffset, uint32_t aLength);
+#endif
 
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    bool       mIndexValid;
+    uint16_t   mIndexLength;
+    IndexEntry mIndex[kIndexMaxEntries];
+#endif
 };
 
 } // namespace ot
@@ -45,6 +45,8 @@ namespace ot {
 namespace Utils {
 
 Heap::Heap(void)
+    : mMaxUsedSize(0)
+    , mFailedAllocs(0)
 {
     Block &super = BlockAt(kSuperBlockOffset);
     super.SetSize(kSuperBlockSize);
@@ -55,8 +57,25 @@ Heap::Heap(void)
     Block &guard = BlockRight(first);
     guard.SetSize(Block::kGuardBlockSize);
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    super.SetNext(0);
+
+    mFirstLevelBitmap = 0;
+    memset(mSecondLevelBitmaps, 0, sizeof(mSecondLevelBitmaps));
+
+    for (uint16_t(&lists)[kSecondLevelCount] : mFreeLists)
+    {
+        for (uint16_t &list : lists)
+        {
+            list = kNullOffset;
+        }
+    }
+
+    InsertFreeBlock(first);
+#else
     super.SetNext(BlockOffset(first));
     first.SetNext(BlockOffset(guard));
+#endif
 
     mMemory.mFreeSize = kFirstBlockSize;
 }
@@ -74,6 +93,26 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     size &= ~(kAlignSize - 1);
     size += kBlockRemainderSize;
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    OT_UNUSED_VARIABLE(prev);
+
+    curr = FindFreeBlock(size);
+    VerifyOrExit(curr != nullptr, mFailedAllocs++);
+
+    RemoveFreeBlock(*curr);
+
+    if (curr->GetSize() > size + sizeof(Block))
+    {
+        const uint16_t newBlockSize = curr->GetSize() - size - sizeof(Block);
+        curr->SetSize(size);
+
+        Block &newBlock = BlockRight(*curr);
+        newBlock.SetSize(newBlockSize);
+        InsertFreeBlock(newBlock);
+
+        mMemory.mFreeSize -= sizeof(Block);
+    }
+#else
     prev = &BlockSuper();
     curr = &BlockNext(*prev);
 
@@ -83,7 +122,7 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
         curr = &BlockNext(*curr);
     }
 
-    VerifyOrExit(curr->IsFree());
+    VerifyOrExit(curr->IsFree(), mFailedAllocs++);
 
     prev->SetNext(curr->GetNext());
 
@@ -107,8 +146,10 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
 
         mMemory.mFreeSize -= sizeof(Block);
     }
+#endif // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
 
     mMemory.mFreeSize -= curr->GetSize();
+    mMaxUsedSize = OT_MAX(mMaxUsedSize, static_cast<uint16_t>(kFirstBlockSize - mMemory.mFreeSize));
 
     curr->SetNext(0);
 
@@ -151,6 +192,33 @@ void Heap::Free(void *aPointer)
         return;
     }
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    Block *block = &BlockOf(aPointer);
+    Block &right = BlockRight(*block);
+
+    mMemory.mFreeSize += block->GetSize();
+
+    if (IsLeftFree(*block))
+    {
+        Block &left = BlockAt(block->GetLeftOffset());
+
+        RemoveFreeBlock(left);
+        left.SetSize(left.GetSize() + block->GetSize() + sizeof(Block));
+        block = &left;
+
+        mMemory.mFreeSize += sizeof(Block);
+    }
+
+    if (right.IsFree())
+    {
+        RemoveFreeBlock(right);
+        block->SetSize(block->GetSize() + right.GetSize() + sizeof(Block));
+
+        mMemory.mFreeSize += sizeof(Block);
+    }
+
+    InsertFreeBlock(*block);
+#else
     Block &block = BlockOf(aPointer);
     Block &right = BlockRight(block);
 
@@ -215,8 +283,209 @@ void Heap::Free(void *aPointer)
             BlockInsert(BlockSuper(), block);
         }
     }
+#endif // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
 }
 
+void Heap::GetStats(Stats &aStats) const
+{
+    Heap &self = *AsNonConst(this);
+
+    aStats.mFreeSize         = mMemory.mFreeSize;
+    aStats.mMaxUsedSize      = mMaxUsedSize;
+    aStats.mLargestFreeBlock = 0;
+    aStats.mFreeBlockCount   = 0;
+    aStats.mFailedAllocs     = mFailedAllocs;
+
+    for (const Block *block = &self.BlockRight(self.BlockSuper()); block->GetSize() != Block::kGuardBlockSize;
+         block              = &self.BlockRight(*block))
+    {
+        if (block->IsFree())
+        {
+            aStats.mFreeBlockCount++;
+            aStats.mLargestFreeBlock = OT_MAX(aStats.mLargestFreeBlock, block->GetSize());
+        }
+    }
+
+    aStats.mFragmentation =
+        (aStats.mFreeSize == 0)
+            ? 0
+            : static_cast<uint8_t>(100 - static_cast<uint32_t>(aStats.mLargestFreeBlock) * 100 / aStats.mFreeSize);
+}
+
+void Heap::ResetStats(void)
+{
+    mMaxUsedSize  = static_cast<uint16_t>(kFirstBlockSize - mMemory.mFreeSize);
+    mFailedAllocs = 0;
+}
+
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
+uint8_t Heap::MostSignificantBit(uint32_t aValue)
+{
+    uint8_t bit = 0;
+
+    while (aValue >>= 1)
+    {
+        bit++;
+    }
+
+    return bit;
+}
+
+uint8_t Heap::LeastSignificantBit(uint32_t aValue)
+{
+    uint8_t bit = 0;
+
+    OT_ASSERT(aValue != 0);
+
+    while ((aValue & 1) == 0)
+    {
+        aValue >>= 1;
+        bit++;
+    }
+
+    return bit;
+}
+
+void Heap::MapSize(uint32_t aSize, uint8_t &aFirstLevel, uint8_t &aSecondLevel)
+{
+    if (aSize < (1U << kSmallSizeShift))
+    {
+        aFirstLevel  = 0;
+        aSecondLevel = static_cast<uint8_t>(aSize >> (kSmallSizeShift - kSecondLevelBits));
+    }
+    else
+    {
+        uint8_t msb = MostSignificantBit(aSize);
+
+        aFirstLevel  = msb - kSmallSizeShift + 1;
+        aSecondLevel = static_cast<uint8_t>((aSize >> (msb - kSecondLevelBits)) - kSecondLevelCount);
+    }
+}
+
+Block *Heap::FindFreeBlock(uint16_t aSize)
+{
+    Block *  block = nullptr;
+    uint32_t size  = aSize;
+    uint8_t  firstLevel;
+    uint8_t  secondLevel;
+    uint32_t bitmap;
+
+    // Round the size up to the next size class, so that any block in
+    // the selected class (or in a larger one) is large enough.
+
+    if (size >= (1U << kSmallSizeShift))
+    {
+        size += (1U << (MostSignificantBit(size) - kSecondLevelBits)) - 1;
+    }
+
+    MapSize(size, firstLevel, secondLevel);
+
+    if (firstLevel < kFirstLevelCount)
+    {
+        bitmap = mSecondLevelBitmaps[firstLevel] & (~0U << secondLevel);
+
+        if (bitmap == 0)
+        {
+            bitmap = mFirstLevelBitmap & (~0U << (firstLevel + 1));
+
+            if (bitmap != 0)
+            {
+                firstLevel = LeastSignificantBit(bitmap);
+                bitmap     = mSecondLevelBitmaps[firstLevel];
+            }
+        }
+
+        if (bitmap != 0)
+        {
+            block = &BlockAt(mFreeLists[firstLevel][LeastSignificantBit(bitmap)]);
+        }
+    }
+
+    if (block == nullptr)
+    {
+        // Rounding up skips the blocks in the size class of `aSize`
+        // itself, some of which may still be large enough (e.g., the
+        // whole heap when it is clean).
+
+        MapSize(aSize, firstLevel, secondLevel);
+
+        for (uint16_t offset = mFreeLists[firstLevel][secondLevel]; offset != kNullOffset;
+             offset          = BlockAt(offset).GetNext())
+        {
+            if (BlockAt(offset).GetSize() >= aSize)
+            {
+                block = &BlockAt(offset);
+                break;
+            }
+        }
+    }
+
+    return block;
+}
+
+void Heap::InsertFreeBlock(Block &aBlock)
+{
+    uint16_t  offset = BlockOffset(aBlock);
+    uint8_t   firstLevel;
+    uint8_t   secondLevel;
+    uint16_t *list;
+
+    MapSize(aBlock.GetSize(), firstLevel, secondLevel);
+    list = &mFreeLists[firstLevel][secondLevel];
+
+    aBlock.SetPrev(kNullOffset);
+    aBlock.SetNext(*list);
+    aBlock.SetOffsetTag(offset);
+
+    if (*list != kNullOffset)
+    {
+        BlockAt(*list).SetPrev(offset);
+    }
+
+    *list = offset;
+
+    mFirstLevelBitmap |= (1U << firstLevel);
+    mSecondLevelBitmaps[firstLevel] |= (1U << secondLevel);
+}
+
+void Heap::RemoveFreeBlock(Block &aBlock)
+{
+    uint16_t prev = aBlock.GetPrev();
+    uint16_t next = aBlock.GetNext();
+    uint8_t  firstLevel;
+    uint8_t  secondLevel;
+
+    if (next != kNullOffset)
+    {
+        BlockAt(next).SetPrev(prev);
+    }
+
+    if (prev != kNullOffset)
+    {
+        BlockAt(prev).SetNext(next);
+    }
+    else
+    {
+        MapSize(aBlock.GetSize(), firstLevel, secondLevel);
+        mFreeLists[firstLevel][secondLevel] = next;
+
+        if (next == kNullOffset)
+        {
+            mSecondLevelBitmaps[firstLevel] &= ~(1U << secondLevel);
+
+            if (mSecondLevelBitmaps[firstLevel] == 0)
+            {
+                mFirstLevelBitmap &= ~(1U << firstLevel);
+            }
+        }
+    }
+
+    aBlock.SetNext(0);
+}
+
+#endif // OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
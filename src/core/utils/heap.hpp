@@ -39,6 +39,7 @@
 
 #if !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -148,6 +149,51 @@ public:
      */
     bool IsFree(void) const { return mSize != kGuardBlockSize && GetNext() != 0; }
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    /**
+     * This method returns the offset of the free block before this block in its free block list.
+     *
+     * @note This is only valid for a free block (it is stored in the user memory).
+     *
+     * @returns Offset of the previous free block in bytes.
+     *
+     */
+    uint16_t GetPrev(void) const
+    {
+        return *reinterpret_cast<const uint16_t *>(reinterpret_cast<const void *>(mMemory));
+    }
+
+    /**
+     * This method updates the offset of the free block before this block in its free block list.
+     *
+     * @param[in]   aPrev   Offset of the previous free block in bytes.
+     *
+     */
+    void SetPrev(uint16_t aPrev) { *reinterpret_cast<uint16_t *>(reinterpret_cast<void *>(mMemory)) = aPrev; }
+
+    /**
+     * This method returns the offset of the left neighbor block.
+     *
+     * @note This is only valid if the left neighbor block is free (see `SetOffsetTag()`).
+     *
+     * @returns Offset of the left neighbor block in bytes.
+     *
+     */
+    uint16_t GetLeftOffset(void) const { return *(&mSize - 2); }
+
+    /**
+     * This method records the offset of this free block in the last two bytes of its user memory, so that the block
+     * on its right side can locate it.
+     *
+     * @param[in]   aOffset   Offset of this block in bytes.
+     *
+     */
+    void SetOffsetTag(uint16_t aOffset)
+    {
+        *reinterpret_cast<uint16_t *>(reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(this) + mSize)) = aOffset;
+    }
+#endif
+
 private:
     static constexpr uint16_t kGuardBlockSize = 0xffff; // Size value of the guard block.
 
@@ -172,6 +218,14 @@ private:
  *     | kAlignSize - 2 | kAlignSize | 4 + s1  | 4 + s2  | ... | 4 + s4  |   2    |
  *     +--------------------------------------------------------------------------+
  *
+ * By default the free blocks are kept in a single list sorted by size (starting at the super block), so allocating
+ * and freeing take linear time in the number of free blocks.
+ *
+ * With `OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE` the free blocks are instead kept in doubly linked lists segregated by size
+ * class (Two-Level Segregated Fit), with bitmaps of the non-empty classes. A free block then stores the offset of the
+ * previous free block in its first two bytes and its own offset in its last two bytes (so that the freed block on its
+ * right side can coalesce with it), and both allocating and freeing take constant time.
+ *
  */
 class Heap : private NonCopyable
 {
@@ -210,9 +264,8 @@ public:
     bool IsClean(void) const
     {
         Heap &       self  = *AsNonConst(this);
-        const Block &super = self.BlockSuper();
-        const Block &first = self.BlockRight(super);
-        return super.GetNext() == self.BlockOffset(first) && first.GetSize() == kFirstBlockSize;
+        const Block &first = self.BlockRight(self.BlockSuper());
+        return first.IsFree() && first.GetSize() == kFirstBlockSize;
     }
 
     /**
@@ -226,6 +279,36 @@ public:
      */
     size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
 
+    /**
+     * This structure represents the heap statistics.
+     *
+     */
+    struct Stats
+    {
+        uint16_t mFreeSize;         ///< Free space in bytes.
+        uint16_t mMaxUsedSize;      ///< The high-water mark of used space (including block metadata) in bytes.
+        uint16_t mLargestFreeBlock; ///< Size of the largest free block (i.e., the largest possible allocation).
+        uint16_t mFreeBlockCount;   ///< Number of free blocks.
+        uint8_t  mFragmentation;    ///< Percentage of free space outside the largest free block.
+        uint32_t mFailedAllocs;     ///< Number of allocations which failed due to no large enough free block.
+    };
+
+    /**
+     * This method gets the heap statistics.
+     *
+     * This method walks all the blocks in the heap.
+     *
+     * @param[out]  aStats  A reference to output the statistics.
+     *
+     */
+    void GetStats(Stats &aStats) const;
+
+    /**
+     * This method resets the high-water mark (to the current used space) and the failed allocation counter.
+     *
+     */
+    void ResetStats(void);
+
 private:
 #if OPENTHREAD_CONFIG_DTLS_ENABLE
     static constexpr uint16_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE;
@@ -242,6 +325,20 @@ private:
 
     static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    // Block sizes below `1 << kSmallSizeShift` are in first level zero, split into `kSecondLevelCount` equal ranges.
+    // Larger block sizes are classed by their most significant bit (first level) and the `kSecondLevelBits` bits
+    // following it (second level).
+    static constexpr uint8_t  kSecondLevelBits  = 4;
+    static constexpr uint8_t  kSecondLevelCount = (1 << kSecondLevelBits);
+    static constexpr uint8_t  kSmallSizeShift   = kSecondLevelBits + 2;
+    static constexpr uint8_t  kFirstLevelCount  = sizeof(uint16_t) * CHAR_BIT - kSmallSizeShift + 1;
+    static constexpr uint16_t kNullOffset       = kGuardBlockOffset; // Ends a free list (as next is 0 if in use).
+
+    static_assert(kFirstLevelCount <= sizeof(uint16_t) * CHAR_BIT, "kFirstLevelCount does not fit in bitmap");
+    static_assert(kSecondLevelCount <= sizeof(uint16_t) * CHAR_BIT, "kSecondLevelCount does not fit in bitmap");
+#endif
+
     /**
      * This method returns the block at offset @p aOffset.
      *
@@ -335,6 +432,23 @@ private:
      */
     void BlockInsert(Block &aPrev, Block &aBlock);
 
+#if OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE
+    static void    MapSize(uint32_t aSize, uint8_t &aFirstLevel, uint8_t &aSecondLevel);
+    static uint8_t MostSignificantBit(uint32_t aValue);
+    static uint8_t LeastSignificantBit(uint32_t aValue);
+
+    Block *FindFreeBlock(uint16_t aSize);
+    void   InsertFreeBlock(Block &aBlock);
+    void   RemoveFreeBlock(Block &aBlock);
+
+    uint16_t mFirstLevelBitmap;
+    uint16_t mSecondLevelBitmaps[kFirstLevelCount];
+    uint16_t mFreeLists[kFirstLevelCount][kSecondLevelCount];
+#endif
+
+    uint16_t mMaxUsedSize;
+    uint32_t mFailedAllocs;
+
     union
     {
         uint16_t mFreeSize;
@@ -320,6 +320,9 @@ private:
         RecordMessage(aMessage, aMacDest, kTxMessage);
     }
 
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadRlocAdded | kEventThreadRlocRemoved | kEventThreadPartitionIdChanged;
+
     void        RecordNetworkInfo(void);
     void        RecordMessage(const Message &aMessage, const Mac::Address &aMacAddress, MessageType aType);
     void        RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo);
@@ -186,6 +186,8 @@ private:
     static constexpr uint32_t kMaxRandomDelay    = 4;    // in ms
     static constexpr uint32_t kOneSecondInterval = 1000; // in ms
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadRoleChanged;
+
     void        CheckState(void);
     void        SetJamState(bool aNewState);
     static void HandleTimer(Timer &aTimer);
@@ -173,6 +173,9 @@ public:
     static void EmitCoapReceive(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    static constexpr Events::Flags kNotifierEvents =
+        kEventThreadRoleChanged | kEventThreadPartitionIdChanged | kEventJoinerStateChanged;
+
     static void EmitStatus(const char *aFmt, ...);
     void        HandleNotifierEvents(Events aEvents);
 };
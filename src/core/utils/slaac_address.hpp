@@ -158,6 +158,8 @@ private:
     // - When SLAAC is disabled, remove all previously added addresses.
     static constexpr UpdateMode kModeRemove = 1 << 1;
 
+    static constexpr Events::Flags kNotifierEvents = kEventThreadNetdataChanged | kEventIp6AddressRemoved;
+
     bool        ShouldFilter(const Ip6::Prefix &aPrefix) const;
     void        Update(UpdateMode aMode);
     void        GetIidSecretKey(IidSecretKey &aKey) const;
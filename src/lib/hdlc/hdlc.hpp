@@ -39,6 +39,8 @@
 
 #include <openthread/error.h>
 
+#include "openthread-hdlc-config.h"
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
@@ -98,6 +100,31 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aData     A pointer to the bytes to write.
+     * @param[in]  aLength   The number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes (nothing is written).
+     *
+     */
+    otError WriteBytes(const uint8_t *aData, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NO_BUFS;
+
+        if (CanWrite(aLength))
+        {
+            memcpy(mWritePointer, aData, aLength);
+            mWritePointer += aLength;
+            mRemainingLength -= aLength;
+            error = OT_ERROR_NONE;
+        }
+
+        return error;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -55,4 +55,30 @@
 #define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS
+ *
+ * The maximum number of property update requests the host keeps outstanding at the RCP while restoring its
+ * properties after an RCP reset.
+ *
+ * Each pipelined request uses its own spinel transaction id, so this must leave room for the transaction ids used by
+ * a synchronous request and a frame transmission. Define to 1 to wait for each response before sending the next
+ * request.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS
+#define OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS 8
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES
+ *
+ * The maximum number of short and of extended source match entries the host keeps for restoring them after an RCP
+ * reset.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES
+#define OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
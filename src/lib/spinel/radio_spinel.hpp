@@ -750,8 +750,13 @@ private:
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
         kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kNumTids               = 15,   ///< Number of spinel transaction ids.
+        kMaxPipelinedRequests  = OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS,
     };
 
+    static_assert(kMaxPipelinedRequests >= 1 && kMaxPipelinedRequests <= kNumTids - 2,
+                  "OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS must leave tids for a request and a transmission");
+
     enum State
     {
         kStateDisabled,     ///< Radio is disabled.
@@ -763,6 +768,23 @@ private:
 
     typedef otError (RadioSpinel::*ResponseHandler)(const uint8_t *aBuffer, uint16_t aLength);
 
+    /**
+     * This type represents the handler invoked when the response to a pipelined request is received.
+     *
+     * @param[in]  aKey    The spinel property key of the request.
+     * @param[in]  aError  The result of the request.
+     *
+     */
+    typedef void (RadioSpinel::*PipelinedResponseHandler)(spinel_prop_key_t aKey, otError aError);
+
+    struct PipelinedRequest
+    {
+        PipelinedResponseHandler mHandler;         ///< The handler invoked on response (`nullptr` for default).
+        uint32_t                 mExpectedCommand; ///< Expected response command.
+        spinel_prop_key_t        mKey;             ///< The property key of the request.
+        spinel_tid_t             mTid;             ///< The transaction id of the request.
+    };
+
     static void HandleReceivedFrame(void *aContext);
 
     otError CheckSpinelVersion(void);
@@ -878,6 +900,65 @@ private:
                                         const char *      aFormat,
                                         va_list           aArgs);
     otError WaitResponse(void);
+
+    /**
+     * This method sends a spinel property set request without waiting for its response.
+     *
+     * Up to `kMaxPipelinedRequests` requests are kept outstanding at the RCP, this method waits for the oldest ones to
+     * complete when the pipeline is full. The response is reported to @p aHandler, or recorded in `mPipelineError`
+     * when @p aHandler is `nullptr` and the request failed.
+     *
+     * @param[in]   aHandler    The handler invoked on response, or `nullptr`.
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack property value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE               Successfully sent the request.
+     * @retval  OT_ERROR_BUSY               No transaction id is available.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError SetPipelined(PipelinedResponseHandler aHandler, spinel_prop_key_t aKey, const char *aFormat, ...);
+
+    /**
+     * This method sends a spinel list property insert request without waiting for its response.
+     *
+     * @param[in]   aHandler    The handler invoked on response, or `nullptr`.
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack the item.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE               Successfully sent the request.
+     * @retval  OT_ERROR_BUSY               No transaction id is available.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError InsertPipelined(PipelinedResponseHandler aHandler, spinel_prop_key_t aKey, const char *aFormat, ...);
+
+    otError RequestPipelinedV(PipelinedResponseHandler aHandler,
+                              uint32_t                 aExpectedCommand,
+                              uint32_t                 aCommand,
+                              spinel_prop_key_t        aKey,
+                              const char *             aFormat,
+                              va_list                  aArgs);
+
+    /**
+     * This method waits until no more than @p aMaxOutstanding pipelined requests are outstanding.
+     *
+     * @param[in]  aMaxOutstanding  The number of pipelined requests allowed to remain outstanding.
+     *
+     * @retval  OT_ERROR_NONE               Successfully received the responses.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError WaitPipelinedResponses(uint8_t aMaxOutstanding);
+    void    HandlePipelinedResponse(uint8_t           aIndex,
+                                    uint32_t          aCommand,
+                                    spinel_prop_key_t aKey,
+                                    const uint8_t *   aBuffer,
+                                    uint16_t          aLength);
+    void    ClearPipelinedRequests(void);
+
     otError SendReset(void);
     otError SendCommand(uint32_t          command,
                         spinel_prop_key_t key,
@@ -923,6 +1004,7 @@ private:
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     void RestoreProperties(void);
+    void HandleChannelMaxPowerRestored(spinel_prop_key_t aKey, otError aError);
 #endif
 
     otInstance *mInstance;
@@ -941,6 +1023,10 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+    PipelinedRequest mPipelinedRequests[kMaxPipelinedRequests]; ///< Outstanding pipelined requests.
+    uint8_t          mPipelinedRequestCount;                    ///< Number of outstanding pipelined requests.
+    otError          mPipelineError;                            ///< First error of pipelined requests w/o handler.
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -976,9 +1062,9 @@ private:
     otMacKey     mPrevKey;
     otMacKey     mCurrKey;
     otMacKey     mNextKey;
-    uint16_t     mSrcMatchShortEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+    uint16_t     mSrcMatchShortEntries[OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES];
     int16_t      mSrcMatchShortEntryCount;
-    otExtAddress mSrcMatchExtEntries[OPENTHREAD_CONFIG_MLE_MAX_CHILDREN];
+    otExtAddress mSrcMatchExtEntries[OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES];
     int16_t      mSrcMatchExtEntryCount;
     uint8_t      mScanChannel;
     uint16_t     mScanDuration;
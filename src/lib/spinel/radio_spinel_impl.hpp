@@ -184,6 +184,8 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mPipelinedRequestCount(0)
+    , mPipelineError(OT_ERROR_NONE)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -583,6 +585,15 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
     }
     else
     {
+        for (uint8_t i = 0; i < mPipelinedRequestCount; i++)
+        {
+            if (mPipelinedRequests[i].mTid == SPINEL_HEADER_GET_TID(header))
+            {
+                HandlePipelinedResponse(i, cmd, key, data, static_cast<uint16_t>(len));
+                ExitNow();
+            }
+        }
+
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
         error = OT_ERROR_DROP;
     }
@@ -1234,7 +1245,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchShortEntry(ui
     SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchShortEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    assert(mSrcMatchShortEntryCount < OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES);
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
@@ -1260,7 +1271,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::AddSrcMatchExtEntry(cons
                       Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    assert(mSrcMatchExtEntryCount < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    assert(mSrcMatchExtEntryCount < OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES);
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
@@ -1687,16 +1698,182 @@ exit:
     return mError;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SetPipelined(PipelinedResponseHandler aHandler,
+                                                                     spinel_prop_key_t        aKey,
+                                                                     const char *             aFormat,
+                                                                     ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestPipelinedV(aHandler, SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::InsertPipelined(PipelinedResponseHandler aHandler,
+                                                                        spinel_prop_key_t        aKey,
+                                                                        const char *             aFormat,
+                                                                        ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestPipelinedV(aHandler, SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT, aKey, aFormat,
+                              args);
+    va_end(args);
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::RequestPipelinedV(PipelinedResponseHandler aHandler,
+                                                                          uint32_t                 aExpectedCommand,
+                                                                          uint32_t                 aCommand,
+                                                                          spinel_prop_key_t        aKey,
+                                                                          const char *             aFormat,
+                                                                          va_list                  aArgs)
+{
+    otError           error;
+    spinel_tid_t      tid;
+    PipelinedRequest *request;
+
+    SuccessOrExit(error = WaitPipelinedResponses(kMaxPipelinedRequests - 1));
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    request                   = &mPipelinedRequests[mPipelinedRequestCount++];
+    request->mHandler         = aHandler;
+    request->mExpectedCommand = aExpectedCommand;
+    request->mKey             = aKey;
+    request->mTid             = tid;
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::WaitPipelinedResponses(uint8_t aMaxOutstanding)
+{
+    otError  error = OT_ERROR_NONE;
+    uint8_t  count = mPipelinedRequestCount;
+    uint64_t end   = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+
+    while (mPipelinedRequestCount > aMaxOutstanding)
+    {
+        uint64_t now = otPlatTimeGet();
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        if (mRcpFailed)
+        {
+            // The RCP was reset while the requests were outstanding, they will never be answered.
+            ClearPipelinedRequests();
+            ExitNow(error = OT_ERROR_FAILED);
+        }
+#endif
+
+        // Every response received restarts the wait, so a slow but responsive RCP is not considered as failed.
+        if (mPipelinedRequestCount < count)
+        {
+            count = mPipelinedRequestCount;
+            end   = now + kMaxWaitTime * US_PER_MS;
+        }
+
+        if (end <= now || mSpinelInterface.WaitForFrame(end - now) != OT_ERROR_NONE)
+        {
+            otLogWarnPlat("Wait pipelined responses timeout: %u outstanding", mPipelinedRequestCount);
+            ClearPipelinedRequests();
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandlePipelinedResponse(uint8_t           aIndex,
+                                                                             uint32_t          aCommand,
+                                                                             spinel_prop_key_t aKey,
+                                                                             const uint8_t *   aBuffer,
+                                                                             uint16_t          aLength)
+{
+    PipelinedRequest request = mPipelinedRequests[aIndex];
+    otError          error   = OT_ERROR_NONE;
+
+    // Responses are handled in any order, so the last request fills the freed slot.
+    mPipelinedRequests[aIndex] = mPipelinedRequests[--mPipelinedRequestCount];
+    FreeTid(request.mTid);
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        error = (unpacked > 0) ? SpinelStatusToOtError(status) : OT_ERROR_PARSE;
+    }
+    else if (aKey != request.mKey || aCommand != request.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+    if (request.mHandler != nullptr)
+    {
+        (this->*request.mHandler)(request.mKey, error);
+    }
+    else if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Pipelined request for property %s failed: %s", spinel_prop_key_to_cstr(request.mKey),
+                      otThreadErrorToString(error));
+
+        if (mPipelineError == OT_ERROR_NONE)
+        {
+            mPipelineError = error;
+        }
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::ClearPipelinedRequests(void)
+{
+    for (uint8_t i = 0; i < mPipelinedRequestCount; i++)
+    {
+        FreeTid(mPipelinedRequests[i].mTid);
+    }
+
+    mPipelinedRequestCount = 0;
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 spinel_tid_t RadioSpinel<InterfaceType, ProcessContextType>::GetNextTid(void)
 {
     spinel_tid_t tid = 0;
 
-    if (((1 << mCmdNextTid) & mCmdTidsInUse) == 0)
+    // Skip over the transaction ids still used by pipelined requests or frame transmission.
+    for (uint8_t i = 0; i < kNumTids && tid == 0; i++)
     {
-        tid         = mCmdNextTid;
+        if (((1 << mCmdNextTid) & mCmdTidsInUse) == 0)
+        {
+            tid = mCmdNextTid;
+            mCmdTidsInUse |= (1 << tid);
+        }
+
         mCmdNextTid = SPINEL_GET_NEXT_TID(mCmdNextTid);
-        mCmdTidsInUse |= (1 << tid);
     }
 
     return tid;
@@ -2254,6 +2431,9 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RecoverFromRcpFailure(void)
     mIsReady      = false;
     mIsTimeSynced = false;
 
+    mPipelinedRequestCount = 0;
+    mPipelineError         = OT_ERROR_NONE;
+
     if (mResetRadioOnStartup)
     {
         SuccessOrDie(SendReset());
@@ -2300,59 +2480,67 @@ exit:
 template <typename InterfaceType, typename ProcessContextType>
 void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
 {
+    otError               error = OT_ERROR_NONE;
     Settings::NetworkInfo networkInfo;
 
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
-    SuccessOrDie(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    // The properties are independent of each other, so they are pipelined instead of paying one round trip to the
+    // RCP each. This matters most for the source match tables of a router with many sleepy children.
+    mPipelineError = OT_ERROR_NONE;
+
+    SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
+    SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
+    SuccessOrExit(
+        error = SetPipelined(nullptr, SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
+    SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
 
     if (mMacKeySet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_KEY,
-                         SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                             SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                         mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey), mNextKey.m8,
-                         sizeof(otMacKey)));
+        SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_RCP_MAC_KEY,
+                                           SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                               SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                           mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8,
+                                           sizeof(otMacKey), mNextKey.m8, sizeof(otMacKey)));
     }
 
     if (mInstance != nullptr)
     {
         SuccessOrDie(static_cast<Instance *>(mInstance)->template Get<Settings>().Read(networkInfo));
-        SuccessOrDie(
-            Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, networkInfo.GetMacFrameCounter()));
+        SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S,
+                                           networkInfo.GetMacFrameCounter()));
     }
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
+        SuccessOrExit(error = InsertPipelined(nullptr, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES,
+                                              SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
     }
 
     for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
     {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
+        SuccessOrExit(error = InsertPipelined(nullptr, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES,
+                                              SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
     }
 
     if (mCcaEnergyDetectThresholdSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
+        SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S,
+                                           mCcaEnergyDetectThreshold));
     }
 
     if (mTransmitPowerSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower));
+        SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower));
     }
 
     if (mCoexEnabledSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
+        SuccessOrExit(error =
+                          SetPipelined(nullptr, SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
     }
 
     if (mFemLnaGainSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
+        SuccessOrExit(error = SetPipelined(nullptr, SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
     }
 
     for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
@@ -2361,17 +2549,36 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
 
         if (power != OT_RADIO_POWER_INVALID)
         {
-            // Some old RCPs doesn't support max transmit power
-            otError error = SetChannelMaxTransmitPower(channel, power);
-
-            if (error != OT_ERROR_NONE && error != OT_ERROR_NOT_FOUND)
-            {
-                DieNow(OT_EXIT_FAILURE);
-            }
+            SuccessOrExit(error = SetPipelined(&RadioSpinel::HandleChannelMaxPowerRestored,
+                                               SPINEL_PROP_PHY_CHAN_MAX_POWER,
+                                               SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S, channel, power));
         }
     }
 
+    SuccessOrExit(error = WaitPipelinedResponses(0));
+    SuccessOrDie(mPipelineError);
+
     CalcRcpTimeOffset();
+
+exit:
+    // A new RCP failure is recovered by the caller retrying its operation.
+    if (!mRcpFailed)
+    {
+        SuccessOrDie(error);
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandleChannelMaxPowerRestored(spinel_prop_key_t aKey,
+                                                                                   otError           aError)
+{
+    OT_UNUSED_VARIABLE(aKey);
+
+    // Some old RCPs doesn't support max transmit power
+    if (aError != OT_ERROR_NONE && aError != OT_ERROR_NOT_FOUND)
+    {
+        DieNow(OT_EXIT_FAILURE);
+    }
 }
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
@@ -333,13 +333,46 @@ void otPlatReset(otInstance *aInstance)
     assert(false);
 }
 
+static void ProcessNetifBatch(uint8_t aArgsLength, char *aArgs[])
+{
+    const otSysNetifBatchStats *stats = otSysGetNetifBatchStats();
+
+    if ((aArgsLength == 1) && (strcmp(aArgs[0], "reset") == 0))
+    {
+        otSysResetNetifBatchStats();
+        ExitNow();
+    }
+
+    otCliOutputFormat("read iterations: %u\r\n", stats->mNumReadIterations);
+    otCliOutputFormat("read packets: %u\r\n", stats->mNumReadPackets);
+    otCliOutputFormat("full batches: %u\r\n", stats->mNumFullBatches);
+    otCliOutputFormat("max batch size: %u\r\n", stats->mMaxReadBatchSize);
+    otCliOutputFormat("write packets: %u\r\n", stats->mNumWritePackets);
+    otCliOutputFormat("batch size histogram:");
+
+    for (uint8_t i = 0; i < OT_SYS_NETIF_BATCH_SIZE_HISTOGRAM_BUCKETS; i++)
+    {
+        otCliOutputFormat(" %u", stats->mReadBatchSizeHistogram[i]);
+    }
+
+    otCliOutputFormat("\r\n");
+
+exit:
+    return;
+}
+
 static void ProcessNetif(void *aContext, uint8_t aArgsLength, char *aArgs[])
 {
     OT_UNUSED_VARIABLE(aContext);
-    OT_UNUSED_VARIABLE(aArgsLength);
-    OT_UNUSED_VARIABLE(aArgs);
 
-    otCliOutputFormat("%s:%u\r\n", otSysGetThreadNetifName(), otSysGetThreadNetifIndex());
+    if ((aArgsLength > 0) && (strcmp(aArgs[0], "batch") == 0))
+    {
+        ProcessNetifBatch(aArgsLength - 1, aArgs + 1);
+    }
+    else
+    {
+        otCliOutputFormat("%s:%u\r\n", otSysGetThreadNetifName(), otSysGetThreadNetifIndex());
+    }
 }
 
 #if !OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
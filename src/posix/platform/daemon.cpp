@@ -92,8 +92,7 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
     if (rval < 0)
     {
         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
 
 exit:
@@ -126,10 +125,8 @@ void Daemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-    }
+    CloseSessionSocket();
+    SuccessOrDie(Mainloop::Manager::Get().RegisterFd(newSessionSocket));
     mSessionSocket = newSessionSocket;
 
 exit:
@@ -147,6 +144,18 @@ exit:
     }
 }
 
+void Daemon::CloseSessionSocket(void)
+{
+    VerifyOrExit(mSessionSocket != -1);
+
+    Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
+    close(mSessionSocket);
+    mSessionSocket = -1;
+
+exit:
+    return;
+}
+
 void Daemon::SetUp(void)
 {
     struct sockaddr_un sockname;
@@ -162,6 +171,8 @@ void Daemon::SetUp(void)
         DieNow(OT_EXIT_FAILURE);
     }
 
+    SuccessOrDie(Mainloop::Manager::Get().RegisterFd(mListenSocket));
+
     {
         static_assert(sizeof(OPENTHREAD_POSIX_DAEMON_SOCKET_LOCK) == sizeof(OPENTHREAD_POSIX_DAEMON_SOCKET_NAME),
                       "sock and lock file name pattern should have the same length!");
@@ -221,14 +232,11 @@ void Daemon::TearDown(void)
 {
     Mainloop::Manager::Get().Remove(*this);
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-        mSessionSocket = -1;
-    }
+    CloseSessionSocket();
 
     if (mListenSocket != -1)
     {
+        Mainloop::Manager::Get().UnregisterFd(mListenSocket);
         close(mListenSocket);
         mListenSocket = -1;
     }
@@ -296,8 +304,7 @@ void Daemon::Process(const otSysMainloopContext &aContext)
 
     if (FD_ISSET(mSessionSocket, &aContext.mErrorFdSet))
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
     else if (FD_ISSET(mSessionSocket, &aContext.mReadFdSet))
     {
@@ -318,8 +325,7 @@ void Daemon::Process(const otSysMainloopContext &aContext)
             {
                 otLogWarnPlat("Daemon read: %s", strerror(errno));
             }
-            close(mSessionSocket);
-            mSessionSocket = -1;
+            CloseSessionSocket();
         }
     }
 
@@ -49,6 +49,7 @@ public:
 private:
     int  OutputFormatV(const char *aFormat, va_list aArguments);
     void InitializeSessionSocket(void);
+    void CloseSessionSocket(void);
 
     int mListenSocket  = -1;
     int mDaemonLock    = -1;
@@ -59,6 +59,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "posix/platform/mainloop.hpp"
 
 #ifdef __APPLE__
 
@@ -168,6 +169,8 @@ otError HdlcInterface::Init(const Url::Url &aRadioUrl)
         ExitNow(error = OT_ERROR_INVALID_ARGS);
     }
 
+    SuccessOrDie(Mainloop::Manager::Get().RegisterFd(mSockFd));
+
     mRadioUrl = &aRadioUrl;
 
 exit:
@@ -585,6 +588,8 @@ void HdlcInterface::CloseFile(void)
 {
     VerifyOrExit(mSockFd != -1);
 
+    Mainloop::Manager::Get().UnregisterFd(mSockFd);
+
     VerifyOrExit(0 == close(mSockFd), perror("close RCP"));
     VerifyOrExit(-1 != wait(nullptr) || errno == ECHILD, perror("wait RCP"));
 
@@ -680,6 +685,7 @@ otError HdlcInterface::ResetConnection(void)
             mSockFd = OpenFile(*mRadioUrl);
             if (mSockFd != -1)
             {
+                SuccessOrDie(Mainloop::Manager::Get().RegisterFd(mSockFd));
                 ExitNow();
             }
             usleep(static_cast<useconds_t>(kOpenFileDelay) * US_PER_MS);
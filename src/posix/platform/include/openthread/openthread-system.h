@@ -174,6 +174,42 @@ const char *otSysGetThreadNetifName(void);
  */
 unsigned int otSysGetThreadNetifIndex(void);
 
+#define OT_SYS_NETIF_BATCH_SIZE_HISTOGRAM_BUCKETS 6 ///< Number of buckets in the read batch size histogram.
+
+/**
+ * This structure represents the statistics of packets exchanged with the Thread network interface.
+ *
+ */
+typedef struct otSysNetifBatchStats
+{
+    uint32_t mNumReadIterations; ///< Number of mainloop iterations in which packets were read from the interface.
+    uint32_t mNumReadPackets;    ///< Number of packets read from the interface.
+    uint32_t mNumFullBatches;    ///< Number of iterations that read the maximum number of packets.
+    uint16_t mMaxReadBatchSize;  ///< Largest number of packets read in a single iteration.
+    uint32_t mNumWritePackets;   ///< Number of packets written to the interface.
+
+    /**
+     * Histogram of the number of packets read per iteration. Bucket `i` counts iterations which read between `2^i`
+     * and `2^(i+1) - 1` packets (the last bucket includes all larger batches).
+     *
+     */
+    uint32_t mReadBatchSizeHistogram[OT_SYS_NETIF_BATCH_SIZE_HISTOGRAM_BUCKETS];
+} otSysNetifBatchStats;
+
+/**
+ * This method returns the Thread network interface batching statistics.
+ *
+ * @returns A pointer to the Thread network interface batching statistics.
+ *
+ */
+const otSysNetifBatchStats *otSysGetNetifBatchStats(void);
+
+/**
+ * This method resets the Thread network interface batching statistics.
+ *
+ */
+void otSysResetNetifBatchStats(void);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
@@ -30,6 +30,14 @@
 
 #include <assert.h>
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/time.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
 #include "core/common/code_utils.hpp"
 
 namespace ot {
@@ -74,6 +82,288 @@ void Manager::Process(const otSysMainloopContext &aContext)
     }
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+static_assert(sizeof(fd_set) % sizeof(unsigned long) == 0, "fd_set is not an array of words");
+
+bool Manager::SetUpEpoll(void)
+{
+    struct epoll_event event;
+
+    VerifyOrExit(mEpollFd == -1);
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd != -1);
+
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (mTimerFd == -1)
+    {
+        close(mEpollFd);
+        ExitNow(mEpollFd = -1);
+    }
+
+    event.events  = EPOLLIN;
+    event.data.fd = mTimerFd;
+
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) != 0)
+    {
+        close(mTimerFd);
+        close(mEpollFd);
+        mTimerFd = -1;
+        ExitNow(mEpollFd = -1);
+    }
+
+    FD_ZERO(&mRegisteredFdSet);
+    FD_ZERO(&mReadInterestFdSet);
+    FD_ZERO(&mWriteInterestFdSet);
+    FD_ZERO(&mErrorInterestFdSet);
+
+exit:
+    return mEpollFd != -1;
+}
+
+otError Manager::RegisterFd(int aFd)
+{
+    otError            error = OT_ERROR_NONE;
+    struct epoll_event event;
+
+    assert(aFd >= 0 && aFd < FD_SETSIZE);
+
+    VerifyOrExit(SetUpEpoll(), error = OT_ERROR_FAILED);
+    VerifyOrExit(!FD_ISSET(aFd, &mRegisteredFdSet));
+
+    // The file descriptor is added without any events, they are
+    // enabled by `Poll()` once the source requests them.
+    event.events  = 0;
+    event.data.fd = aFd;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OT_ERROR_FAILED);
+
+    FD_SET(aFd, &mRegisteredFdSet);
+
+    if (aFd > mMaxRegisteredFd)
+    {
+        mMaxRegisteredFd = aFd;
+    }
+
+exit:
+    return error;
+}
+
+void Manager::UnregisterFd(int aFd)
+{
+    VerifyOrExit(mEpollFd != -1 && aFd >= 0 && FD_ISSET(aFd, &mRegisteredFdSet));
+
+    epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr);
+
+    FD_CLR(aFd, &mRegisteredFdSet);
+    FD_CLR(aFd, &mReadInterestFdSet);
+    FD_CLR(aFd, &mWriteInterestFdSet);
+    FD_CLR(aFd, &mErrorInterestFdSet);
+
+exit:
+    return;
+}
+
+void Manager::UpdateEpollInterest(int aFd, bool aRead, bool aWrite, bool aError)
+{
+    struct epoll_event event;
+
+    event.events = 0;
+
+    if (aRead)
+    {
+        event.events |= EPOLLIN;
+    }
+
+    if (aWrite)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    if (aError)
+    {
+        event.events |= EPOLLPRI;
+    }
+
+    event.data.fd = aFd;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == 0);
+
+    aRead ? FD_SET(aFd, &mReadInterestFdSet) : FD_CLR(aFd, &mReadInterestFdSet);
+    aWrite ? FD_SET(aFd, &mWriteInterestFdSet) : FD_CLR(aFd, &mWriteInterestFdSet);
+    aError ? FD_SET(aFd, &mErrorInterestFdSet) : FD_CLR(aFd, &mErrorInterestFdSet);
+
+exit:
+    return;
+}
+
+Manager::FdSetWord Manager::ValidBits(int aWord, int aMaxFd)
+{
+    // Returns the bits of word `aWord` of an `fd_set` which are not
+    // greater than `aMaxFd`.
+
+    FdSetWord valid;
+
+    if (aMaxFd < aWord * kFdSetWordBits)
+    {
+        valid = 0;
+    }
+    else if (aMaxFd >= (aWord + 1) * kFdSetWordBits - 1)
+    {
+        valid = ~static_cast<FdSetWord>(0);
+    }
+    else
+    {
+        valid = (static_cast<FdSetWord>(1) << (aMaxFd - aWord * kFdSetWordBits + 1)) - 1;
+    }
+
+    return valid;
+}
+
+int Manager::Poll(otSysMainloopContext &aContext)
+{
+    int                rval  = -1;
+    int                maxFd = -1;
+    bool               block = timerisset(&aContext.mTimeout);
+    fd_set             readFdSet;
+    fd_set             writeFdSet;
+    fd_set             errorFdSet;
+    struct itimerspec  timerSpec;
+    struct epoll_event events[kMaxEpollEvents];
+    int                numEvents = 0;
+
+    VerifyOrExit(SetUpEpoll());
+
+    // Registered file descriptors only have their epoll interest
+    // updated (a system call is made only when it changes), all
+    // others are collected to be polled with select(). The sets are
+    // scanned a word at a time so that idle registered descriptors
+    // cost next to nothing.
+
+    FD_ZERO(&readFdSet);
+    FD_ZERO(&writeFdSet);
+    FD_ZERO(&errorFdSet);
+
+    for (int word = 0; word * kFdSetWordBits <= aContext.mMaxFd || word * kFdSetWordBits <= mMaxRegisteredFd; word++)
+    {
+        FdSetWord valid      = ValidBits(word, aContext.mMaxFd);
+        FdSetWord registered = GetWords(mRegisteredFdSet)[word];
+        FdSetWord read       = GetWords(aContext.mReadFdSet)[word] & valid;
+        FdSetWord write      = GetWords(aContext.mWriteFdSet)[word] & valid;
+        FdSetWord error      = GetWords(aContext.mErrorFdSet)[word] & valid;
+        FdSetWord changed;
+        FdSetWord transient;
+
+        changed = ((read ^ GetWords(mReadInterestFdSet)[word]) | (write ^ GetWords(mWriteInterestFdSet)[word]) |
+                   (error ^ GetWords(mErrorInterestFdSet)[word])) &
+                  registered;
+
+        while (changed != 0)
+        {
+            int       bit  = __builtin_ctzl(changed);
+            FdSetWord mask = static_cast<FdSetWord>(1) << bit;
+
+            UpdateEpollInterest(word * kFdSetWordBits + bit, (read & mask) != 0, (write & mask) != 0, (error & mask) != 0);
+            changed &= ~mask;
+        }
+
+        GetWords(readFdSet)[word]  = read & ~registered;
+        GetWords(writeFdSet)[word] = write & ~registered;
+        GetWords(errorFdSet)[word] = error & ~registered;
+
+        transient = (read | write | error) & ~registered;
+
+        if (transient != 0)
+        {
+            maxFd = word * kFdSetWordBits + kFdSetWordBits - 1 - __builtin_clzl(transient);
+        }
+    }
+
+    if (block)
+    {
+        // The timer wakes up the epoll instance when the timeout
+        // expires. Re-arming it also clears a prior expiration.
+        timerSpec.it_interval.tv_sec  = 0;
+        timerSpec.it_interval.tv_nsec = 0;
+        timerSpec.it_value.tv_sec     = aContext.mTimeout.tv_sec;
+        timerSpec.it_value.tv_nsec    = aContext.mTimeout.tv_usec * 1000;
+        VerifyOrExit(timerfd_settime(mTimerFd, 0, &timerSpec, nullptr) == 0);
+    }
+
+    if (maxFd == -1)
+    {
+        numEvents = epoll_wait(mEpollFd, events, kMaxEpollEvents, block ? -1 : 0);
+        VerifyOrExit(numEvents >= 0);
+        rval = 0;
+    }
+    else
+    {
+        struct timeval zeroTimeout = {0, 0};
+
+        FD_SET(mEpollFd, &readFdSet);
+
+        if (mEpollFd > maxFd)
+        {
+            maxFd = mEpollFd;
+        }
+
+        rval = select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, block ? nullptr : &zeroTimeout);
+        VerifyOrExit(rval >= 0);
+
+        if (FD_ISSET(mEpollFd, &readFdSet))
+        {
+            FD_CLR(mEpollFd, &readFdSet);
+            rval--;
+
+            numEvents = epoll_wait(mEpollFd, events, kMaxEpollEvents, 0);
+            VerifyOrExit(numEvents >= 0, rval = -1);
+        }
+    }
+
+    aContext.mReadFdSet  = readFdSet;
+    aContext.mWriteFdSet = writeFdSet;
+    aContext.mErrorFdSet = errorFdSet;
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        int      fd   = events[i].data.fd;
+        uint32_t mask = events[i].events;
+
+        if (fd == mTimerFd)
+        {
+            continue;
+        }
+
+        if ((mask & (EPOLLIN | EPOLLHUP | EPOLLERR)) && FD_ISSET(fd, &mReadInterestFdSet))
+        {
+            FD_SET(fd, &aContext.mReadFdSet);
+            rval++;
+        }
+
+        if ((mask & (EPOLLOUT | EPOLLERR)) && FD_ISSET(fd, &mWriteInterestFdSet))
+        {
+            FD_SET(fd, &aContext.mWriteFdSet);
+            rval++;
+        }
+
+        if ((mask & EPOLLPRI) && FD_ISSET(fd, &mErrorInterestFdSet))
+        {
+            FD_SET(fd, &aContext.mErrorFdSet);
+            rval++;
+        }
+
+        if (fd > aContext.mMaxFd)
+        {
+            aContext.mMaxFd = fd;
+        }
+    }
+
+exit:
+    return rval;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
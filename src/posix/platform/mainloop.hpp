@@ -34,6 +34,8 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -108,6 +110,50 @@ public:
      */
     void Remove(Source &aSource);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * This method registers a long-lived file descriptor with the epoll backend.
+     *
+     * A registered file descriptor stays in the epoll interest list across mainloop iterations. Its source still adds
+     * it to the context file descriptor sets in `Update()` and checks them in `Process()` as usual, but only changes in
+     * the requested events cost a system call. Unregistered file descriptors found in the context are polled each
+     * iteration as with select().
+     *
+     * A registered file descriptor MUST be unregistered before it is closed.
+     *
+     * @param[in]   aFd     The file descriptor, which MUST be less than `FD_SETSIZE`.
+     *
+     * @retval OT_ERROR_NONE    Successfully registered the file descriptor.
+     * @retval OT_ERROR_FAILED  Failed to set up epoll or to add the file descriptor.
+     *
+     */
+    otError RegisterFd(int aFd);
+
+    /**
+     * This method unregisters a file descriptor registered by `RegisterFd()`.
+     *
+     * @param[in]   aFd     The file descriptor.
+     *
+     */
+    void UnregisterFd(int aFd);
+
+    /**
+     * This method waits for the events in the mainloop context using epoll.
+     *
+     * On return the file descriptor sets in @p aContext only contain the file descriptors which are ready, as they
+     * would after select().
+     *
+     * @param[inout]    aContext    A reference to the mainloop context.
+     *
+     * @returns The number of ready events, or -1 on error with `errno` set.
+     *
+     */
+    int Poll(otSysMainloopContext &aContext);
+#else
+    otError RegisterFd(int) { return OT_ERROR_NONE; }
+    void    UnregisterFd(int) {}
+#endif
+
     /**
      * This function returns the Mainloop singleton.
      *
@@ -117,6 +163,30 @@ public:
     static Manager &Get(void);
 
 private:
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 64;
+
+    // `fd_set` is handled as an array of words to scan it quickly.
+    typedef unsigned long FdSetWord;
+
+    static constexpr int kFdSetWordBits = sizeof(FdSetWord) * 8;
+
+    static FdSetWord *      GetWords(fd_set &aFdSet) { return reinterpret_cast<FdSetWord *>(&aFdSet); }
+    static const FdSetWord *GetWords(const fd_set &aFdSet) { return reinterpret_cast<const FdSetWord *>(&aFdSet); }
+    static FdSetWord        ValidBits(int aWord, int aMaxFd);
+
+    bool SetUpEpoll(void);
+    void UpdateEpollInterest(int aFd, bool aRead, bool aWrite, bool aError);
+
+    int    mEpollFd         = -1;
+    int    mTimerFd         = -1;
+    int    mMaxRegisteredFd = -1;
+    fd_set mRegisteredFdSet;
+    fd_set mReadInterestFdSet;
+    fd_set mWriteInterestFdSet;
+    fd_set mErrorInterestFdSet;
+#endif
+
     Source *mSources = nullptr;
 };
 
@@ -85,6 +85,7 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
@@ -162,8 +163,21 @@ unsigned int otSysGetThreadNetifIndex(void)
     return gNetifIndex;
 }
 
+static otSysNetifBatchStats sBatchStats;
+
+const otSysNetifBatchStats *otSysGetNetifBatchStats(void)
+{
+    return &sBatchStats;
+}
+
+void otSysResetNetifBatchStats(void)
+{
+    memset(&sBatchStats, 0, sizeof(sBatchStats));
+}
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 #include "posix/platform/ip6_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 using namespace ot::Posix::Ip6Utils;
 
@@ -752,11 +766,22 @@ static void processReceive(otMessage *aMessage, void *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
 
-    char     packet[kMaxIp6Size + 4];
-    otError  error     = OT_ERROR_NONE;
-    uint16_t length    = otMessageGetLength(aMessage);
-    size_t   offset    = 0;
-    uint16_t maxLength = sizeof(packet) - 4;
+    // The message buffers are handed to the kernel directly through
+    // `writev()` (one `iovec` per message chunk). The message is only
+    // copied into a flat buffer when it spans more chunks than fit in
+    // the `iovec` array (or when logging the packet).
+
+    static constexpr uint8_t kMaxIovecs = 32;
+
+    char           packet[kMaxIp6Size + 4];
+    struct iovec   iov[kMaxIovecs];
+    otMessageChunk chunks[kMaxIovecs];
+    uint16_t       numChunks;
+    int            iovCount  = 0;
+    otError        error     = OT_ERROR_NONE;
+    uint16_t       length    = otMessageGetLength(aMessage);
+    size_t         offset    = 0;
+    uint16_t       maxLength = sizeof(packet) - 4;
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
     offset += 4;
@@ -767,9 +792,8 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(sTunFd > 0);
 
-    VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
-
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
+    VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
     otLogInfoPlat("[netif] Packet from NCP (%u bytes)", static_cast<uint16_t>(length));
     otDumpInfo(OT_LOG_REGION_PLATFORM, "", &packet[offset], length);
 #endif
@@ -779,10 +803,35 @@ static void processReceive(otMessage *aMessage, void *aContext)
     packet[1] = 0;
     packet[2] = (PF_INET6 << 8) & 0xFF;
     packet[3] = (PF_INET6 << 0) & 0xFF;
-    length += 4;
+
+    iov[iovCount].iov_base = packet;
+    iov[iovCount].iov_len  = offset;
+    iovCount++;
 #endif
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    numChunks = kMaxIovecs - iovCount;
+
+    if (otMessageGetChunks(aMessage, 0, length, chunks, &numChunks) == OT_ERROR_NONE)
+    {
+        for (uint16_t i = 0; i < numChunks; i++)
+        {
+            iov[iovCount].iov_base = const_cast<uint8_t *>(chunks[i].mData);
+            iov[iovCount].iov_len  = chunks[i].mLength;
+            iovCount++;
+        }
+    }
+    else
+    {
+        VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
+
+        iov[0].iov_base = packet;
+        iov[0].iov_len  = offset + length;
+        iovCount        = 1;
+    }
+
+    VerifyOrExit(writev(sTunFd, iov, iovCount) == static_cast<ssize_t>(offset + length), perror("writev");
+                 error = OT_ERROR_FAILED);
+    sBatchStats.mNumWritePackets++;
 
 exit:
     otMessageFree(aMessage);
@@ -793,18 +842,29 @@ exit:
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+static bool transmitPacket(otInstance *aInstance)
 {
+    // Reads one packet from the tun device and sends it into the
+    // Thread network. Returns `false` if no packet could be read or
+    // sent, which ends the current batch.
+
     otMessage *message = nullptr;
     ssize_t    rval;
     char       packet[kMaxIp6Size];
     otError    error  = OT_ERROR_NONE;
     size_t     offset = 0;
 
-    assert(gInstance == aInstance);
-
     rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
+
+    if (rval <= 0)
+    {
+        if ((rval == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)))
+        {
+            error = OT_ERROR_FAILED;
+        }
+
+        ExitNow();
+    }
 
     {
         otMessageSettings settings;
@@ -844,6 +904,51 @@ exit:
     {
         otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
     }
+
+    return (rval > 0) && (error == OT_ERROR_NONE);
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    // Drains up to `OPENTHREAD_POSIX_CONFIG_NETIF_READ_BATCH_SIZE`
+    // packets from the (non-blocking) tun device.
+
+    static constexpr uint16_t kReadBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_READ_BATCH_SIZE;
+
+    uint16_t batchSize = 0;
+    uint8_t  bucket    = 0;
+
+    assert(gInstance == aInstance);
+
+    while ((batchSize < kReadBatchSize) && transmitPacket(aInstance))
+    {
+        batchSize++;
+    }
+
+    VerifyOrExit(batchSize > 0);
+
+    sBatchStats.mNumReadIterations++;
+    sBatchStats.mNumReadPackets += batchSize;
+
+    if (batchSize == kReadBatchSize)
+    {
+        sBatchStats.mNumFullBatches++;
+    }
+
+    if (batchSize > sBatchStats.mMaxReadBatchSize)
+    {
+        sBatchStats.mMaxReadBatchSize = batchSize;
+    }
+
+    for (uint16_t size = batchSize; (size > 1) && (bucket < OT_SYS_NETIF_BATCH_SIZE_HISTOGRAM_BUCKETS - 1); size >>= 1)
+    {
+        bucket++;
+    }
+
+    sBatchStats.mReadBatchSizeHistogram[bucket]++;
+
+exit:
+    return;
 }
 
 static void logAddrEvent(bool isAdd, bool isUnicast, struct sockaddr_in6 &addr6, otError error)
@@ -1631,7 +1736,11 @@ void platformNetifInit(const char *aInterfaceName)
 
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     mldListenerInit();
+    SuccessOrDie(ot::Posix::Mainloop::Manager::Get().RegisterFd(sMLDMonitorFd));
 #endif
+
+    SuccessOrDie(ot::Posix::Mainloop::Manager::Get().RegisterFd(sTunFd));
+    SuccessOrDie(ot::Posix::Mainloop::Manager::Get().RegisterFd(sNetlinkFd));
 }
 
 void platformNetifSetUp(void)
@@ -1655,6 +1764,7 @@ void platformNetifDeinit(void)
 {
     if (sTunFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sTunFd);
         close(sTunFd);
         sTunFd = -1;
 
@@ -1671,6 +1781,7 @@ void platformNetifDeinit(void)
 
     if (sNetlinkFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sNetlinkFd);
         close(sNetlinkFd);
         sNetlinkFd = -1;
     }
@@ -1678,6 +1789,7 @@ void platformNetifDeinit(void)
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     if (sMLDMonitorFd != -1)
     {
+        ot::Posix::Mainloop::Manager::Get().UnregisterFd(sMLDMonitorFd);
         close(sMLDMonitorFd);
         sMLDMonitorFd = -1;
     }
@@ -100,6 +100,24 @@
 #define OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define to 1 to poll the mainloop with epoll instead of select().
+ *
+ * Long-lived file descriptors (radio, netif, daemon) stay registered in the epoll interest list across iterations and
+ * the mainloop timeout is driven by a timerfd, so the per-iteration cost does not grow with the number of idle file
+ * descriptors. This is only supported on Linux.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is only supported on Linux"
+#endif
+
 /**
  * RCP bus UART.
  *
@@ -187,6 +205,20 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_EXTERNAL_ROUTE_NUM 8
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_READ_BATCH_SIZE
+ *
+ * This macro defines the maximum number of packets read from the Thread network interface (TUN device) and sent
+ * into the Thread network per mainloop iteration.
+ *
+ * When larger than 1, bursts of packets from off-mesh hosts are drained from the TUN device in one iteration instead
+ * of waking up the mainloop once per packet.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_READ_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_READ_BATCH_SIZE 1
+#endif
+
 #ifdef __APPLE__
 
 /**
@@ -40,6 +40,7 @@
 #include <openthread-core-config.h>
 #include <openthread/border_router.h>
 #include <openthread/heap.h>
+#include <openthread/logging.h>
 #include <openthread/tasklet.h>
 #include <openthread/platform/alarm-milli.h>
 #include <openthread/platform/infra_if.h>
@@ -284,6 +285,11 @@ static int trySelect(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSe
 
 void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
 {
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    // Output the log lines deferred by the tasklets before blocking in `select()`.
+    otLoggingProcessBinaryLogs();
+#endif
+
     ot::Posix::Mainloop::Manager::Get().Update(*aMainloop);
 
     platformAlarmUpdateTimeout(&aMainloop->mTimeout);
@@ -344,8 +350,12 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        rval = ot::Posix::Mainloop::Manager::Get().Poll(*aMainloop);
+#else
         rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                       &aMainloop->mTimeout);
+#endif
     }
 
     return rval;
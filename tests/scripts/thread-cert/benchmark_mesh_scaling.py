@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS'
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Mesh scaling benchmark for the simulation platform under virtual time.
+
+This script spawns N simulated FTD nodes in radio range of each other and
+drives a scripted workload:
+
+  1. Attach: node 1 forms the partition, then all other nodes start at the
+     same time. The attach time of a node is the virtual time from its
+     `thread start` until it becomes a child, router or leader.
+  2. Unicast echo: ICMPv6 echo between random node pairs over the ML-EID.
+  3. Multicast echo: ICMPv6 echo from node 1 to the realm-local all-nodes
+     address (ff03::1).
+
+For each network size, it reports attach time, per-node CPU time, message
+buffer high-water marks and echo round-trip percentiles as JSON.
+
+The simulation must be built with virtual time, the ping sender and a
+network size large enough for the benchmark. MAX_NETWORK_SIZE sets both:
+
+    MAX_NETWORK_SIZE=128 ./script/test clean build benchmark --nodes 32 64 128 --output scaling.json
+"""
+
+import argparse
+import binascii
+import json
+import os
+import random
+import sys
+
+import pexpect
+
+import config
+import simulator
+import thread_cert  # noqa: F401 (must be imported before `node`)
+from node import Node
+
+LEADER_STARTUP_DELAY = 5
+ATTACHED_STATES = ('child', 'router', 'leader')
+PERCENTILES = (50, 90, 99)
+
+
+def percentiles(samples):
+    """Return nearest-rank percentiles and extremes of `samples`."""
+    if not samples:
+        return None
+
+    ordered = sorted(samples)
+    result = {'min': ordered[0], 'max': ordered[-1], 'mean': sum(ordered) / len(ordered)}
+
+    for p in PERCENTILES:
+        rank = max(1, -(-p * len(ordered) // 100))
+        result['p%d' % p] = ordered[rank - 1]
+
+    return result
+
+
+def cpu_time(node):
+    """Return the CPU seconds used by the process of `node`."""
+    try:
+        # The first field is the time spent on the CPU in nanoseconds.
+        with open('/proc/%d/schedstat' % node.pexpect.pid) as f:
+            return int(f.read().split()[0]) / 1e9
+    except FileNotFoundError:
+        pass
+
+    with open('/proc/%d/stat' % node.pexpect.pid) as f:
+        # The process name field may contain spaces, so split after it.
+        fields = f.read().rsplit(')', 1)[1].split()
+
+    return (int(fields[11]) + int(fields[12])) / os.sysconf('SC_CLK_TCK')
+
+
+def get_max_used_buffers(node):
+    node.send_command('bufferinfo')
+    node._expect(r'max used: (\d+)')
+    value = int(node.pexpect.match.group(1))
+    node._expect_done()
+    return value
+
+
+def reset_buffer_info(node):
+    node.send_command('bufferinfo reset')
+    node._expect_done()
+
+
+def ping(node, sim, address, count, interval, size=16, timeout=2):
+    """Send `count` echo requests and return the round-trip times (ms) of all replies."""
+    node.send_command('ping %s %d %d %d 64 %d' % (address, size, count, interval, timeout))
+
+    rtts = []
+    end = sim.now() + count * interval + timeout + 3
+
+    while sim.now() < end:
+        sim.go(1)
+
+        while True:
+            try:
+                i = node._expect([r'time=(\d+)ms', r'packets transmitted'], timeout=0.1)
+            except pexpect.TIMEOUT:
+                break
+
+            if i == 0:
+                rtts.append(int(node.pexpect.match.group(1)))
+            else:
+                node._expect_done()
+                return rtts
+
+    return rtts
+
+
+class MeshScalingBenchmark(object):
+
+    def __init__(self, num_nodes, args):
+        self.num_nodes = num_nodes
+        self.args = args
+        self.random = random.Random(args.seed)
+        self.simulator = simulator.VirtualTime(use_message_factory=False)
+        self.nodes = {}
+
+    def run(self):
+        try:
+            for nodeid in range(1, self.num_nodes + 1):
+                node = Node(nodeid, simulator=self.simulator)
+                node.set_networkkey(binascii.hexlify(config.DEFAULT_NETWORK_KEY).decode())
+                node.set_panid(config.PANID)
+                node.set_mode('rdn')
+                self.nodes[nodeid] = node
+
+            result = {'nodes': self.num_nodes, 'seed': self.args.seed}
+            result['attach'] = self._attach()
+
+            result['buffers_max_used'] = {'attach': self._collect_max_used_buffers()}
+
+            self.simulator.go(self.args.settle_time)
+            result['roles'] = self._collect_roles()
+
+            result['unicast_echo'] = self._unicast_echo()
+            result['multicast_echo'] = self._multicast_echo()
+            result['buffers_max_used']['workload'] = self._collect_max_used_buffers()
+
+            cpu = [cpu_time(node) for node in self.nodes.values()]
+            result['cpu_s'] = percentiles(cpu)
+            result['cpu_s']['total'] = sum(cpu)
+            result['virtual_time_s'] = self.simulator.now()
+
+            return result
+        finally:
+            for node in self.nodes.values():
+                node.destroy()
+            self.simulator.stop()
+
+    def _attach(self):
+        leader = self.nodes[1]
+        leader.start()
+        self.simulator.go(LEADER_STARTUP_DELAY)
+        assert leader.get_state() == 'leader'
+
+        start_time = self.simulator.now()
+        pending = set(self.nodes) - {1}
+
+        for nodeid in sorted(pending):
+            self.nodes[nodeid].start()
+
+        attach_times = []
+        deadline = start_time + self.args.attach_timeout
+
+        while pending and self.simulator.now() < deadline:
+            self.simulator.go(self.args.poll_interval)
+
+            for nodeid in sorted(pending):
+                if self.nodes[nodeid].get_state() in ATTACHED_STATES:
+                    attach_times.append(self.simulator.now() - start_time)
+                    pending.remove(nodeid)
+
+        return {'time_s': percentiles(attach_times), 'unattached': len(pending)}
+
+    def _collect_max_used_buffers(self):
+        values = []
+
+        for node in self.nodes.values():
+            values.append(get_max_used_buffers(node))
+            reset_buffer_info(node)
+
+        return percentiles(values)
+
+    def _collect_roles(self):
+        roles = {}
+
+        for node in self.nodes.values():
+            state = node.get_state()
+            roles[state] = roles.get(state, 0) + 1
+
+        return roles
+
+    def _unicast_echo(self):
+        rtts = []
+        sent = 0
+
+        for _ in range(self.args.echo_pairs):
+            src, dst = self.random.sample(sorted(self.nodes), 2)
+            rtts += ping(self.nodes[src], self.simulator, self.nodes[dst].get_mleid(), self.args.echo_count,
+                         self.args.echo_interval)
+            sent += self.args.echo_count
+
+        return {'sent': sent, 'received': len(rtts), 'rtt_ms': percentiles(rtts)}
+
+    def _multicast_echo(self):
+        rtts = ping(self.nodes[1], self.simulator, 'ff03::1', self.args.echo_count, self.args.echo_interval)
+
+        return {
+            'sent': self.args.echo_count,
+            'received': len(rtts),
+            'replies_per_request': len(rtts) / self.args.echo_count,
+            'rtt_ms': percentiles(rtts),
+        }
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Mesh scaling benchmark on the simulation platform.')
+    parser.add_argument('--nodes', type=int, nargs='+', default=[32], help='network sizes to benchmark')
+    parser.add_argument('--seed', type=int, default=0, help='seed for choosing echo node pairs')
+    parser.add_argument('--attach-timeout', type=int, default=600, help='attach timeout in virtual seconds')
+    parser.add_argument('--poll-interval', type=int, default=2, help='attach state poll interval in virtual seconds')
+    parser.add_argument('--settle-time', type=int, default=300, help='virtual seconds to wait after attach')
+    parser.add_argument('--echo-pairs', type=int, default=16, help='number of unicast echo node pairs')
+    parser.add_argument('--echo-count', type=int, default=5, help='echo requests per pair and for multicast')
+    parser.add_argument('--echo-interval', type=int, default=1, help='echo request interval in seconds')
+    parser.add_argument('--output', help='write the JSON report to this file instead of stdout')
+    args = parser.parse_args()
+
+    if os.getenv('VIRTUAL_TIME', '1') != '1':
+        sys.exit('The mesh scaling benchmark requires VIRTUAL_TIME=1')
+
+    for num_nodes in args.nodes:
+        if not 2 <= num_nodes <= simulator.VirtualTime.MAX_NODES:
+            sys.exit('Network size %d is not in [2, %d], set MAX_NETWORK_SIZE and build with '
+                     'OT_SIMULATION_MAX_NETWORK_SIZE' % (num_nodes, simulator.VirtualTime.MAX_NODES))
+
+    results = [MeshScalingBenchmark(num_nodes, args).run() for num_nodes in args.nodes]
+    report = json.dumps({'benchmark': 'mesh_scaling', 'results': results}, indent=2)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(report + '\n')
+    else:
+        print(report)
+
+
+if __name__ == '__main__':
+    main()
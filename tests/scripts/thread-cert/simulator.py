@@ -137,7 +137,8 @@ class VirtualTime(BaseSimulator):
     EVENT_DATA = 5
 
     BASE_PORT = 9000
-    MAX_NODES = 33
+    # Must match OT_SIMULATION_MAX_NETWORK_SIZE of the simulation build.
+    MAX_NODES = int(os.getenv('MAX_NETWORK_SIZE', '33'))
     MAX_MESSAGE = 1024
     END_OF_TIME = float('inf')
     PORT_OFFSET = int(os.getenv('PORT_OFFSET', '0'))
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OPENTHREAD_CORE_OPTIONAL_FEATURES_CONFIG_H_
+#define OPENTHREAD_CORE_OPTIONAL_FEATURES_CONFIG_H_
+
+/**
+ * This header file defines the OpenThread core configuration used to build the simulation platform and run the unit
+ * tests with the optional (disabled by default) data structure features enabled.
+ *
+ * It is selected with `-DOT_CONFIG=../tests/unit/openthread-core-optional-features-config.h`.
+ *
+ */
+
+// Include the simulation platform configuration.
+#include "openthread-core-simulation-config.h"
+
+// Some of the features below only take effect when the module they
+// extend is also enabled (e.g., `-DOT_BACKBONE_ROUTER=ON`,
+// `-DOT_DNS_CLIENT=ON`, `-DOT_SRP_SERVER=ON`). The HDLC and POSIX
+// options are set through `-DOT_HDLC_FCS_SLICE_BY_8=ON` and the
+// POSIX platform configuration, respectively.
+
+#define OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_LISTENERS_INDEX_ENABLE 1
+#define OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE 1
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+#define OPENTHREAD_CONFIG_HEAP_TLSF_ENABLE 1
+#define OPENTHREAD_CONFIG_LOG_BINARY_ENABLE 1
+#define OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE 1
+#define OPENTHREAD_CONFIG_LOWPAN_REASSEMBLY_TABLE_ENABLE 1
+#define OPENTHREAD_CONFIG_MAC_SRC_MATCH_MIRROR_ENABLE 1
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FAIR_QUEUEING_ENABLE 1
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 1
+#define OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE 1
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE 1
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE 1
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE 1
+#define OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE 1
+#define OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE 1
+
+// Table sizes large enough for the benchmarks in the unit tests to run
+// their large cases with the indexes above.
+
+#define OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES 256
+#define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 511
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 1024
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES 512
+
+#endif // OPENTHREAD_CORE_OPTIONAL_FEATURES_CONFIG_H_
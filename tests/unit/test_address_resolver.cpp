@@ -0,0 +1,328 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+#include "thread/mle_router.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+static constexpr uint16_t kNumCacheEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES;
+static constexpr uint16_t kMaxSnoopEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES;
+
+static_assert(kNumCacheEntries > kMaxSnoopEntries + 2, "Test requires a larger address cache");
+
+Ip6::Address GetEid(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    eid.Clear();
+    eid.mFields.m16[0] = HostSwap16(0xfd00);
+    eid.mFields.m16[7] = HostSwap16(aIndex + 1);
+
+    return eid;
+}
+
+Mac::ShortAddress GetRloc16(uint16_t aIndex)
+{
+    // Entries are spread over three routers.
+
+    return Mle::Mle::Rloc16FromRouterId(static_cast<uint8_t>(1 + (aIndex % 3)));
+}
+
+void Snoop(uint16_t aIndex, Mac::ShortAddress aRloc16)
+{
+    // The destination of the snooped message must be this device.
+
+    sInstance->Get<AddressResolver>().UpdateSnoopedCacheEntry(GetEid(aIndex), aRloc16,
+                                                              sInstance->Get<Mac::Mac>().GetShortAddress());
+}
+
+bool IsInCache(uint16_t aIndex)
+{
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+    bool                       found = false;
+
+    memset(&iterator, 0, sizeof(iterator));
+
+    while (sInstance->Get<AddressResolver>().GetNextCacheEntry(info, iterator) == kErrorNone)
+    {
+        if (static_cast<Ip6::Address &>(info.mTarget) == GetEid(aIndex))
+        {
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+uint16_t CountEntries(otCacheEntryState aState)
+{
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+    uint16_t                   count = 0;
+
+    memset(&iterator, 0, sizeof(iterator));
+
+    while (sInstance->Get<AddressResolver>().GetNextCacheEntry(info, iterator) == kErrorNone)
+    {
+        if (info.mState == aState)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void VerifyCounters(uint32_t aHits, uint32_t aMisses, uint32_t aEvictions)
+{
+    const otAddressCacheCounters &counters = sInstance->Get<AddressResolver>().GetCounters();
+
+    VerifyOrQuit(counters.mHits == aHits, "Hits counter is incorrect");
+    VerifyOrQuit(counters.mMisses == aMisses, "Misses counter is incorrect");
+    VerifyOrQuit(counters.mEvictions == aEvictions, "Evictions counter is incorrect");
+}
+
+AddressResolver &InitTest(void)
+{
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    // Snooped entries are only added by an FTD.
+
+    SuccessOrQuit(sInstance->Get<Mle::MleRouter>().SetDeviceMode(Mle::DeviceMode(
+        Mle::DeviceMode::kModeRxOnWhenIdle | Mle::DeviceMode::kModeFullThreadDevice |
+        Mle::DeviceMode::kModeFullNetworkData)));
+
+    sInstance->Get<AddressResolver>().ResetCounters();
+
+    return sInstance->Get<AddressResolver>();
+}
+
+void TestAddressResolverLookup(void)
+{
+    AddressResolver & resolver = InitTest();
+    Mac::ShortAddress rloc16;
+
+    printf("TestAddressResolverLookup");
+
+    for (uint16_t i = 0; i < kNumCacheEntries; i++)
+    {
+        Snoop(i, GetRloc16(i));
+    }
+
+    VerifyOrQuit(CountEntries(OT_CACHE_ENTRY_STATE_SNOOPED) == kNumCacheEntries);
+    VerifyCounters(0, 0, 0);
+
+    // Resolving a snooped entry is a hit and moves it to the cached list.
+
+    for (uint16_t i = 0; i < kNumCacheEntries; i++)
+    {
+        SuccessOrQuit(resolver.Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false));
+        VerifyOrQuit(rloc16 == GetRloc16(i), "Resolve() returned incorrect RLOC16");
+    }
+
+    VerifyOrQuit(CountEntries(OT_CACHE_ENTRY_STATE_CACHED) == kNumCacheEntries);
+    VerifyCounters(kNumCacheEntries, 0, 0);
+
+    // A snoop for a cached EID updates the entry in place.
+
+    Snoop(0, GetRloc16(1));
+    SuccessOrQuit(resolver.Resolve(GetEid(0), rloc16, /* aAllowAddressQuery */ false));
+    VerifyOrQuit(rloc16 == GetRloc16(1), "Snoop did not update the cached entry");
+    VerifyCounters(kNumCacheEntries + 1, 0, 0);
+
+    VerifyOrQuit(resolver.Resolve(GetEid(kNumCacheEntries), rloc16, /* aAllowAddressQuery */ false) ==
+                 kErrorNotFound);
+    VerifyCounters(kNumCacheEntries + 1, 1, 0);
+
+    resolver.ResetCounters();
+    VerifyCounters(0, 0, 0);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestAddressResolverEviction(void)
+{
+    AddressResolver & resolver = InitTest();
+    Mac::ShortAddress rloc16;
+    uint16_t          newIndex = kNumCacheEntries;
+
+    printf("TestAddressResolverEviction");
+
+    // Fill the cache and resolve all entries, so they are cached in
+    // the order of `i` (entry 0 being the least recently used).
+
+    for (uint16_t i = 0; i < kNumCacheEntries; i++)
+    {
+        Snoop(i, GetRloc16(i));
+        SuccessOrQuit(resolver.Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false));
+    }
+
+    // Use entry 0 again so that entry 1 becomes the least recently used.
+
+    SuccessOrQuit(resolver.Resolve(GetEid(0), rloc16, /* aAllowAddressQuery */ false));
+    VerifyCounters(kNumCacheEntries + 1, 0, 0);
+
+    // Each new snooped entry evicts the least recently used cached
+    // entry. New snooped entries can not themselves be evicted until
+    // their timeout expires.
+
+    for (uint16_t i = 0; i < kMaxSnoopEntries; i++)
+    {
+        Snoop(newIndex, GetRloc16(newIndex));
+
+        VerifyOrQuit(IsInCache(newIndex), "New snooped entry was not added");
+        VerifyOrQuit(!IsInCache(1 + i), "Least recently used entry was not evicted");
+        VerifyOrQuit(IsInCache(2 + i), "Entry evicted out of order");
+        VerifyOrQuit(IsInCache(0), "Recently used entry was evicted");
+        VerifyCounters(kNumCacheEntries + 1, 0, i + 1);
+
+        newIndex++;
+    }
+
+    VerifyOrQuit(CountEntries(OT_CACHE_ENTRY_STATE_SNOOPED) == kMaxSnoopEntries);
+
+    // Once the limit of non-evictable snooped entries is reached, a new
+    // snooped entry must not evict a cached entry.
+
+    Snoop(newIndex, GetRloc16(newIndex));
+    VerifyOrQuit(!IsInCache(newIndex), "Snooped entry added over the limit");
+    VerifyCounters(kNumCacheEntries + 1, 0, kMaxSnoopEntries);
+
+    VerifyOrQuit(resolver.Resolve(GetEid(1), rloc16, /* aAllowAddressQuery */ false) == kErrorNotFound);
+    VerifyCounters(kNumCacheEntries + 1, 1, kMaxSnoopEntries);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestAddressResolverRemove(void)
+{
+    AddressResolver & resolver = InitTest();
+    Mac::ShortAddress rloc16;
+    Mac::ShortAddress childRloc16 = static_cast<Mac::ShortAddress>(GetRloc16(0) + 1);
+
+    printf("TestAddressResolverRemove");
+
+    for (uint16_t i = 0; i < kNumCacheEntries - 1; i++)
+    {
+        Snoop(i, GetRloc16(i));
+        SuccessOrQuit(resolver.Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false));
+    }
+
+    // The last entry maps to a child of the router of entry 0.
+
+    Snoop(kNumCacheEntries - 1, childRloc16);
+
+    // Remove by EID.
+
+    resolver.Remove(GetEid(1));
+    VerifyOrQuit(!IsInCache(1), "Remove(EID) failed");
+    VerifyOrQuit(resolver.Resolve(GetEid(1), rloc16, /* aAllowAddressQuery */ false) == kErrorNotFound);
+
+    // Removing an EID again or one which is not cached is a no-op.
+
+    resolver.Remove(GetEid(1));
+    resolver.Remove(GetEid(kNumCacheEntries));
+    VerifyOrQuit(CountEntries(OT_CACHE_ENTRY_STATE_CACHED) == kNumCacheEntries - 2);
+
+    // Remove by RLOC16 only removes the entries with the exact RLOC16.
+
+    resolver.Remove(GetRloc16(2));
+
+    for (uint16_t i = 0; i < kNumCacheEntries - 1; i++)
+    {
+        VerifyOrQuit(IsInCache(i) == ((i != 1) && (GetRloc16(i) != GetRloc16(2))), "Remove(RLOC16) failed");
+    }
+
+    VerifyOrQuit(IsInCache(kNumCacheEntries - 1), "Remove(RLOC16) removed a child entry");
+
+    // Remove by Router ID also removes the entries of its children.
+
+    resolver.Remove(Mle::Mle::RouterIdFromRloc16(GetRloc16(0)));
+
+    for (uint16_t i = 0; i < kNumCacheEntries; i++)
+    {
+        if (IsInCache(i))
+        {
+            SuccessOrQuit(resolver.Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false));
+            VerifyOrQuit(!Mle::Mle::RouterIdMatch(rloc16, GetRloc16(0)), "Remove(RouterId) failed");
+        }
+    }
+
+    VerifyOrQuit(!IsInCache(kNumCacheEntries - 1), "Remove(RouterId) did not remove a child entry");
+
+    // Removed entries are freed and can be used for new entries
+    // without evicting any entry.
+
+    resolver.ResetCounters();
+
+    for (uint16_t i = 0; i < kNumCacheEntries; i++)
+    {
+        if (!IsInCache(i))
+        {
+            Snoop(i, GetRloc16(1));
+            SuccessOrQuit(resolver.Resolve(GetEid(i), rloc16, /* aAllowAddressQuery */ false));
+        }
+    }
+
+    VerifyOrQuit(CountEntries(OT_CACHE_ENTRY_STATE_CACHED) == kNumCacheEntries);
+    VerifyOrQuit(resolver.GetCounters().mEvictions == 0, "Entries were evicted while the cache had room");
+
+    resolver.Clear();
+    VerifyOrQuit(CountEntries(OT_CACHE_ENTRY_STATE_CACHED) == 0, "Clear() failed");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestAddressResolverLookup();
+    ot::TestAddressResolverEviction();
+    ot::TestAddressResolverRemove();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -29,10 +29,12 @@
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/random.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
 #include "test_util.h"
+#include "test_util.hpp"
 
 /**
  * Verifies test vectors from IEEE 802.15.4-2006 Annex C Section C.2.1
@@ -137,10 +139,171 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0);
 }
 
+/**
+ * Verifies that feeding header and payload in arbitrary pieces, and using a pre-keyed `AesEcb`, produce the same
+ * result as processing the whole buffers with a freshly keyed `AesCcm`.
+ */
+void TestAesCcmSplitAndKeyedEcb(void)
+{
+    static constexpr uint16_t kMaxHeaderLength  = 40;
+    static constexpr uint16_t kMaxPayloadLength = 127;
+    static constexpr uint8_t  kTagLength        = 8;
+    static constexpr uint16_t kNumIterations    = 500;
+
+    otInstance *       instance = testInitInstance();
+    uint8_t            keyBytes[ot::Crypto::AesEcb::kBlockSize];
+    uint8_t            nonce[ot::Crypto::AesCcm::kNonceSize];
+    uint8_t            header[kMaxHeaderLength];
+    uint8_t            plain[kMaxPayloadLength];
+    uint8_t            expected[kMaxPayloadLength];
+    uint8_t            cipher[kMaxPayloadLength];
+    uint8_t            decrypted[kMaxPayloadLength];
+    uint8_t            expectedTag[kTagLength];
+    uint8_t            tag[kTagLength];
+    ot::Crypto::Key    key;
+    ot::Crypto::AesEcb keyedEcb;
+
+    VerifyOrQuit(instance != nullptr);
+
+    ot::Random::NonCrypto::FillBuffer(keyBytes, sizeof(keyBytes));
+    key.Set(keyBytes, sizeof(keyBytes));
+    keyedEcb.SetKey(key);
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        uint16_t           headerLength  = ot::Random::NonCrypto::GetUint16InRange(0, kMaxHeaderLength + 1);
+        uint16_t           payloadLength = ot::Random::NonCrypto::GetUint16InRange(0, kMaxPayloadLength + 1);
+        uint16_t           offset;
+        ot::Crypto::AesCcm reference;
+        ot::Crypto::AesCcm aesCcm;
+
+        ot::Random::NonCrypto::FillBuffer(nonce, sizeof(nonce));
+        ot::Random::NonCrypto::FillBuffer(header, sizeof(header));
+        ot::Random::NonCrypto::FillBuffer(plain, sizeof(plain));
+
+        reference.SetKey(key);
+        reference.Init(headerLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+        reference.Header(header, headerLength);
+        reference.Payload(plain, expected, payloadLength, ot::Crypto::AesCcm::kEncrypt);
+        reference.Finalize(expectedTag);
+
+        aesCcm.SetKey(keyedEcb);
+        aesCcm.Init(headerLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+
+        for (offset = 0; offset < headerLength;)
+        {
+            uint16_t length = ot::Random::NonCrypto::GetUint16InRange(1, headerLength - offset + 1);
+
+            aesCcm.Header(header + offset, length);
+            offset += length;
+        }
+
+        for (offset = 0; offset < payloadLength;)
+        {
+            uint16_t length = ot::Random::NonCrypto::GetUint16InRange(1, payloadLength - offset + 1);
+
+            aesCcm.Payload(plain + offset, cipher + offset, length, ot::Crypto::AesCcm::kEncrypt);
+            offset += length;
+        }
+
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(cipher, expected, payloadLength) == 0);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(tag)) == 0);
+
+        aesCcm.Init(headerLength, payloadLength, kTagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, headerLength);
+
+        for (offset = 0; offset < payloadLength;)
+        {
+            uint16_t length = ot::Random::NonCrypto::GetUint16InRange(1, payloadLength - offset + 1);
+
+            aesCcm.Payload(decrypted + offset, cipher + offset, length, ot::Crypto::AesCcm::kDecrypt);
+            offset += length;
+        }
+
+        aesCcm.Finalize(tag);
+
+        VerifyOrQuit(memcmp(decrypted, plain, payloadLength) == 0);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(tag)) == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+/**
+ * Measures the 802.15.4 frame security throughput, expanding the key per frame vs. reusing a keyed `AesEcb`.
+ */
+void BenchmarkMacFrameSecurity(void)
+{
+    static constexpr uint16_t kHeaderLength  = 23;
+    static constexpr uint16_t kPayloadLength = 127 - kHeaderLength - 4 - 2;
+    static constexpr uint8_t  kTagLength     = 4;
+    static constexpr uint32_t kNumFrames     = 20000;
+
+    otInstance *       instance = testInitInstance();
+    uint8_t            keyBytes[ot::Crypto::AesEcb::kBlockSize];
+    uint8_t            nonce[ot::Crypto::AesCcm::kNonceSize];
+    uint8_t            frame[kHeaderLength + kPayloadLength + kTagLength];
+    ot::Crypto::Key    key;
+    ot::Crypto::AesEcb keyedEcb;
+    uint64_t           startTime;
+    uint64_t           perFrameKeyTime;
+    uint64_t           cachedKeyTime;
+
+    VerifyOrQuit(instance != nullptr);
+
+    ot::Random::NonCrypto::FillBuffer(keyBytes, sizeof(keyBytes));
+    ot::Random::NonCrypto::FillBuffer(nonce, sizeof(nonce));
+    ot::Random::NonCrypto::FillBuffer(frame, sizeof(frame));
+    key.Set(keyBytes, sizeof(keyBytes));
+    keyedEcb.SetKey(key);
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(key);
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(frame + kHeaderLength + kPayloadLength);
+    }
+
+    perFrameKeyTime = GetMonotonicTimeUsec() - startTime;
+    startTime       = GetMonotonicTimeUsec();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(keyedEcb);
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(frame + kHeaderLength + kPayloadLength);
+    }
+
+    cachedKeyTime = GetMonotonicTimeUsec() - startTime;
+
+    printf("BenchmarkMacFrameSecurity(%u frames): per-frame key %llu usec (%llu frames/s), cached key %llu usec (%llu "
+           "frames/s)\n",
+           kNumFrames, static_cast<unsigned long long>(perFrameKeyTime),
+           static_cast<unsigned long long>(perFrameKeyTime ? (uint64_t{kNumFrames} * 1000000) / perFrameKeyTime : 0),
+           static_cast<unsigned long long>(cachedKeyTime),
+           static_cast<unsigned long long>(cachedKeyTime ? (uint64_t{kNumFrames} * 1000000) / cachedKeyTime : 0));
+
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestAesCcmSplitAndKeyedEcb();
+    BenchmarkMacFrameSecurity();
     printf("All tests passed\n");
     return 0;
 }
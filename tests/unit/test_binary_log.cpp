@@ -0,0 +1,280 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "common/binary_log.hpp"
+
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/code_utils.hpp"
+#include "common/string.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+namespace ot {
+
+typedef String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> LogString;
+
+static void RecordLog(BinaryLogBuffer &aBuffer, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    aBuffer.Record(OT_LOG_LEVEL_INFO, OT_LOG_REGION_CORE, 0, aFormat, args);
+    va_end(args);
+}
+
+static void FormatLog(StringWriter &aWriter, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    aWriter.AppendVarArgs(aFormat, args);
+    va_end(args);
+}
+
+static void VerifyFormat(BinaryLogBuffer &aBuffer, const char *aFormat, ...)
+{
+    // Verifies that a log line recorded in binary form and formatted
+    // later matches the log line formatted directly.
+
+    va_list                args;
+    LogString              expected;
+    LogString              actual;
+    BinaryLogBuffer::Entry entry;
+
+    va_start(args, aFormat);
+    expected.AppendVarArgs(aFormat, args);
+    va_end(args);
+
+    va_start(args, aFormat);
+    aBuffer.Record(OT_LOG_LEVEL_WARN, OT_LOG_REGION_MAC, 1234, aFormat, args);
+    va_end(args);
+
+    VerifyOrQuit(aBuffer.Read(entry), "Read() failed");
+    VerifyOrQuit(entry.mLevel == OT_LOG_LEVEL_WARN && entry.mRegion == OT_LOG_REGION_MAC, "level/region mismatch");
+    VerifyOrQuit(entry.mUptime == 1234 && entry.mFormat == aFormat, "uptime/format mismatch");
+    VerifyOrQuit(!aBuffer.Read(entry), "Read() succeeded on an empty buffer");
+
+    BinaryLogBuffer::Format(entry, actual);
+
+    printf("\n\"%s\"", actual.AsCString());
+    VerifyOrQuit(strcmp(expected.AsCString(), actual.AsCString()) == 0, "formatted log line does not match");
+}
+
+void TestBinaryLogFormat(void)
+{
+    BinaryLogBuffer        buffer;
+    BinaryLogBuffer::Entry entry;
+    char                   longString[2 * OPENTHREAD_CONFIG_LOG_MAX_SIZE];
+    char                   changingString[] = "before";
+    LogString              logString;
+
+    printf("TestBinaryLogFormat");
+
+    memset(longString, 'a', sizeof(longString) - 1);
+    longString[sizeof(longString) - 1] = '\0';
+
+    VerifyFormat(buffer, "no arguments");
+    VerifyFormat(buffer, "");
+    VerifyFormat(buffer, "%d %i %u %x %X %o %c 100%%", -5, 7, 42u, 0xbeefu, 0xbeefu, 8u, 'z');
+    VerifyFormat(buffer, "%hhu %hu %lu %llu %zu %jd %td", 200, 60000, 4000000000ul, 1ull << 60, sizeof(buffer),
+                 static_cast<intmax_t>(-1), static_cast<ptrdiff_t>(-2));
+    VerifyFormat(buffer, "[%08lx] [%-6s] [%+5d] [%#x] [%ld]", 0x1234ul, "ab", 3, 255u, -1l);
+    VerifyFormat(buffer, "[%*d] [%-*.*s] [%.*s]", 5, 42, 8, 3, "abcdef", 2, "xyz");
+    VerifyFormat(buffer, "%f %.2e %g %Lf", 3.5, 1234.5, 0.25, static_cast<long double>(1.5));
+    VerifyFormat(buffer, "%p %s", static_cast<void *>(&buffer), "end");
+    VerifyFormat(buffer, "%s", longString);
+    VerifyFormat(buffer, "%s, %u, %s", longString, 1u, "not recorded");
+
+    // String arguments are copied when recorded.
+
+    RecordLog(buffer, "%s", changingString);
+    strcpy(changingString, "after");
+    VerifyOrQuit(buffer.Read(entry), "Read() failed");
+    BinaryLogBuffer::Format(entry, logString);
+    VerifyOrQuit(strcmp(logString.AsCString(), "before") == 0, "string argument was not copied");
+
+    RecordLog(buffer, "%s", static_cast<const char *>(nullptr));
+    VerifyOrQuit(buffer.Read(entry), "Read() failed");
+    BinaryLogBuffer::Format(entry, logString.Clear());
+    VerifyOrQuit(strcmp(logString.AsCString(), "(null)") == 0, "null string argument is incorrect");
+
+    VerifyOrQuit(buffer.GetDropCount() == 0, "log lines were dropped");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogWrapAndDrop(void)
+{
+    static const char kDigits[] = "0123456789012345678901234567890123456789012345678901234567890123";
+
+    BinaryLogBuffer        buffer;
+    BinaryLogBuffer::Entry entry;
+    LogString              logString;
+    LogString              expected;
+    uint32_t               numRecorded = 0;
+    uint32_t               numRead     = 0;
+
+    printf("TestBinaryLogWrapAndDrop");
+
+    // Fill the buffer until log lines get dropped, then read all of them back in order.
+
+    while (buffer.GetDropCount() == 0)
+    {
+        RecordLog(buffer, "line %u %s", numRecorded, "filler");
+        numRecorded++;
+    }
+
+    VerifyOrQuit(numRecorded > 2, "buffer holds too few log lines");
+
+    while (buffer.Read(entry))
+    {
+        BinaryLogBuffer::Format(entry, logString.Clear());
+        FormatLog(expected.Clear(), "line %u %s", numRead, "filler");
+        VerifyOrQuit(strcmp(logString.AsCString(), expected.AsCString()) == 0, "log lines are out of order");
+        numRead++;
+    }
+
+    VerifyOrQuit(numRead + buffer.GetDropCount() == numRecorded, "log lines were lost");
+
+    // Record and read log lines of varying length so that records wrap around the end of the buffer.
+
+    for (uint32_t i = 0; i <= 3000; i++)
+    {
+        RecordLog(buffer, "%u:%.*s", i, static_cast<int>(i % 64), kDigits);
+
+        if (i % 3 != 0)
+        {
+            continue;
+        }
+
+        for (uint32_t j = i - 2 * (i > 0); j <= i; j++)
+        {
+            VerifyOrQuit(buffer.Read(entry), "Read() failed");
+            BinaryLogBuffer::Format(entry, logString.Clear());
+            FormatLog(expected.Clear(), "%u:%.*s", j, static_cast<int>(j % 64), kDigits);
+            VerifyOrQuit(strcmp(logString.AsCString(), expected.AsCString()) == 0, "wrapped log line is incorrect");
+        }
+    }
+
+    VerifyOrQuit(!buffer.Read(entry), "buffer is not empty");
+    VerifyOrQuit(numRead + buffer.GetDropCount() == numRecorded, "log lines were dropped while wrapping");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogBenchmark(void)
+{
+    // Compares the cost of emitting a typical log line when it is
+    // formatted directly with the cost of recording it in binary form
+    // (and the cost of formatting it later, off the critical path).
+    // The buffer is read (without formatting) after each batch of
+    // records, as a consumer thread would.
+
+    static const char kFormat[] = "Sent IPv6 UDP msg, len:%d, chksum:%04x, ecn:%s, to:%s, sec:%s, prio:%s, radio:%s";
+    static constexpr uint32_t kNumIterations = 100000;
+    static constexpr uint32_t kBatchSize     = 32;
+
+    BinaryLogBuffer        buffer;
+    BinaryLogBuffer::Entry entry;
+    LogString              logString;
+    LogString              expected;
+    clock_t                start;
+    clock_t                textTime;
+    clock_t                recordTime;
+    clock_t                formatTime;
+
+    printf("TestBinaryLogBenchmark");
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        FormatLog(logString.Clear(), kFormat, 98 + i % 32, i & 0xffff, "no", "0xfc00", "yes", "normal", "15.4");
+    }
+
+    textTime = clock() - start;
+    start    = clock();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        RecordLog(buffer, kFormat, 98 + i % 32, i & 0xffff, "no", "0xfc00", "yes", "normal", "15.4");
+
+        if ((i % kBatchSize) == kBatchSize - 1)
+        {
+            while (buffer.Read(entry))
+            {
+            }
+        }
+    }
+
+    recordTime = clock() - start;
+    start      = clock();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        BinaryLogBuffer::Format(entry, logString.Clear());
+    }
+
+    formatTime = clock() - start;
+
+    VerifyOrQuit(buffer.GetDropCount() == 0, "log lines were dropped");
+
+    FormatLog(expected.Clear(), kFormat, 98 + (kNumIterations - 1) % 32, (kNumIterations - 1) & 0xffff, "no", "0xfc00",
+              "yes", "normal", "15.4");
+    VerifyOrQuit(strcmp(logString.AsCString(), expected.AsCString()) == 0, "formatted log line does not match");
+
+    printf("\n%lu log lines: formatting %lu us, recording (and reading) %lu us, deferred formatting %lu us",
+           static_cast<unsigned long>(kNumIterations), static_cast<unsigned long>(textTime * 1000000 / CLOCKS_PER_SEC),
+           static_cast<unsigned long>(recordTime * 1000000 / CLOCKS_PER_SEC),
+           static_cast<unsigned long>(formatTime * 1000000 / CLOCKS_PER_SEC));
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    ot::TestBinaryLogFormat();
+    ot::TestBinaryLogWrapAndDrop();
+    ot::TestBinaryLogBenchmark();
+    printf("All tests passed\n");
+#endif // OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    return 0;
+}
@@ -291,6 +291,119 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestRandomAddData(void)
+    {
+        // Cross-checks `AddData()` against adding the same bytes one at
+        // a time (`AddUint8()`), with random content, lengths and split
+        // points (covering odd start offsets and unaligned buffers).
+
+        enum : uint16_t
+        {
+            kMaxLength     = 1500,
+            kNumIterations = 2000,
+        };
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kMaxLength + 1];
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            Checksum checksum;
+            Checksum reference;
+            uint16_t length = Random::NonCrypto::GetUint16InRange(0, kMaxLength);
+            uint16_t start  = Random::NonCrypto::GetUint8InRange(0, 2);
+            uint16_t offset = 0;
+
+            Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+            if ((iter % 4) == 0)
+            {
+                // Use data that sums to a multiple of 0xffff.
+                memset(buffer, (iter % 8) == 0 ? 0xff : 0x00, sizeof(buffer));
+            }
+
+            length = OT_MIN(length, static_cast<uint16_t>(kMaxLength + 1 - start));
+
+            for (uint16_t i = 0; i < length; i++)
+            {
+                reference.AddUint8(buffer[start + i]);
+            }
+
+            while (offset < length)
+            {
+                uint16_t chunkLength = Random::NonCrypto::GetUint16InRange(0, length - offset + 1);
+
+                checksum.AddData(&buffer[start + offset], chunkLength);
+                offset += chunkLength;
+            }
+
+            VerifyOrQuit(checksum.GetValue() == reference.GetValue());
+            VerifyOrQuit(checksum.mAtOddIndex == reference.mAtOddIndex);
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void BenchmarkAddData(void)
+    {
+        enum : uint16_t
+        {
+            kLength        = 1280,
+            kNumIterations = 20000,
+        };
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kLength];
+        uint16_t  value = 0;
+        uint64_t  startTime;
+        uint64_t  byteTime;
+        uint64_t  wordTime;
+
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        startTime = GetMonotonicTimeUsec();
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            Checksum checksum;
+
+            for (uint8_t byte : buffer)
+            {
+                checksum.AddUint8(byte);
+            }
+
+            value ^= checksum.GetValue();
+        }
+
+        byteTime  = GetMonotonicTimeUsec() - startTime;
+        startTime = GetMonotonicTimeUsec();
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            Checksum checksum;
+
+            checksum.AddData(buffer, sizeof(buffer));
+            value ^= checksum.GetValue();
+        }
+
+        wordTime = GetMonotonicTimeUsec() - startTime;
+
+        // An even number of XORs with identical values cancels out.
+        VerifyOrQuit(value == 0);
+
+        printf("BenchmarkAddData(%u bytes x %u): byte-wise %llu usec (%llu MB/s), word-wise %llu usec (%llu MB/s)\n",
+               kLength, kNumIterations, static_cast<unsigned long long>(byteTime),
+               static_cast<unsigned long long>(byteTime ? (uint64_t{kLength} * kNumIterations) / byteTime : 0),
+               static_cast<unsigned long long>(wordTime),
+               static_cast<unsigned long long>(wordTime ? (uint64_t{kLength} * kNumIterations) / wordTime : 0));
+
+        testFreeInstance(instance);
+    }
 };
 
 } // namespace ot
@@ -298,8 +411,10 @@ public:
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestRandomAddData();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
+    ot::ChecksumTester::BenchmarkAddData();
     printf("All tests passed\n");
     return 0;
 }
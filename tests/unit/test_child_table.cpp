@@ -30,7 +30,7 @@
 
 #include <openthread/config.h>
 
-#include "test_util.h"
+#include "test_util.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "thread/child_table.hpp"
@@ -392,11 +392,151 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+void TestChildTableAddressUpdates(void)
+{
+    // Addresses of a child may be updated through a `Neighbor`
+    // reference (e.g., by `MleRouter` handling a link request). Check
+    // that the lookups always use the current addresses.
+
+    static const otExtAddress kExtAddress1 = {{0x10, 0x20, 0x03, 0x15, 0x10, 0x00, 0x60, 0x16}};
+    static const otExtAddress kExtAddress2 = {{0x10, 0x20, 0x03, 0x15, 0x10, 0x00, 0x60, 0x17}};
+
+    const uint16_t kRloc16_1 = 0x8001;
+    const uint16_t kRloc16_2 = 0x8002;
+
+    ChildTable *table;
+    Child *     child;
+    Neighbor *  neighbor;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("TestChildTableAddressUpdates()");
+
+    child = table->GetNewChild();
+    VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+    child->SetRloc16(kRloc16_1);
+    child->SetExtAddress(static_cast<const Mac::ExtAddress &>(kExtAddress1));
+    child->SetState(Child::kStateValid);
+
+    VerifyOrQuit(table->FindChild(kRloc16_1, Child::kInStateValid) == child);
+    VerifyOrQuit(table->FindChild(static_cast<const Mac::ExtAddress &>(kExtAddress1), Child::kInStateValid) == child);
+
+    neighbor = child;
+    neighbor->SetRloc16(kRloc16_2);
+    neighbor->SetExtAddress(static_cast<const Mac::ExtAddress &>(kExtAddress2));
+
+    VerifyOrQuit(table->FindChild(kRloc16_1, Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(static_cast<const Mac::ExtAddress &>(kExtAddress1), Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(kRloc16_2, Child::kInStateValid) == child);
+    VerifyOrQuit(table->FindChild(static_cast<const Mac::ExtAddress &>(kExtAddress2), Child::kInStateValid) == child);
+
+    child->Clear();
+
+    VerifyOrQuit(table->FindChild(kRloc16_2, Child::kInStateAny) == nullptr);
+    VerifyOrQuit(table->FindChild(static_cast<const Mac::ExtAddress &>(kExtAddress2), Child::kInStateAny) == nullptr);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void BenchmarkChildTableLookup(uint16_t aNumChildren)
+{
+    const uint32_t kNumLookups = 100000;
+
+    ChildTable *table;
+    uint64_t    startTime;
+    uint64_t    rloc16Time;
+    uint64_t    extAddrTime;
+    uint64_t    missTime;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("BenchmarkChildTableLookup(%u) (%s) ", aNumChildren,
+           OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE ? "indexed" : "linear scan");
+
+    if (aNumChildren > table->GetMaxChildren())
+    {
+        printf("-- SKIPPED (OPENTHREAD_CONFIG_MLE_MAX_CHILDREN is %u)\n", table->GetMaxChildren());
+        ExitNow();
+    }
+
+    SuccessOrQuit(table->SetMaxChildrenAllowed(aNumChildren));
+
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        Child *         child = table->GetNewChild();
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+        extAddress.GenerateRandom();
+        child->SetExtAddress(extAddress);
+        child->SetRloc16(0x8000 + i + 1);
+        child->SetState(Child::kStateValid);
+    }
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        uint16_t rloc16 = 0x8000 + (i % aNumChildren) + 1;
+        Child *  child  = table->FindChild(rloc16, Child::kInStateValid);
+
+        VerifyOrQuit((child != nullptr) && (child->GetRloc16() == rloc16), "FindChild(rloc16) failed");
+    }
+
+    rloc16Time = GetMonotonicTimeUsec() - startTime;
+    startTime  = GetMonotonicTimeUsec();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        Child *expected = table->GetChildAtIndex(static_cast<uint16_t>(i % aNumChildren));
+        Child *child    = table->FindChild(expected->GetExtAddress(), Child::kInStateValidOrRestoring);
+
+        VerifyOrQuit(child == expected, "FindChild(ExtAddress) failed");
+    }
+
+    extAddrTime = GetMonotonicTimeUsec() - startTime;
+    startTime   = GetMonotonicTimeUsec();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        Mac::Address macAddress;
+
+        macAddress.SetShort(static_cast<uint16_t>(0x4000 + (i % aNumChildren) + 1));
+        VerifyOrQuit(table->FindChild(macAddress, Child::kInStateAnyExceptInvalid) == nullptr,
+                     "FindChild(MacAddress) found a non-existing child");
+    }
+
+    missTime = GetMonotonicTimeUsec() - startTime;
+
+    printf("rloc16: %llu ns, ext-addr: %llu ns, miss: %llu ns per lookup -- PASS\n",
+           static_cast<unsigned long long>(rloc16Time * 1000 / kNumLookups),
+           static_cast<unsigned long long>(extAddrTime * 1000 / kNumLookups),
+           static_cast<unsigned long long>(missTime * 1000 / kNumLookups));
+
+exit:
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableAddressUpdates();
+    ot::BenchmarkChildTableLookup(OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+    ot::BenchmarkChildTableLookup(64);
+    ot::BenchmarkChildTableLookup(256);
+    ot::BenchmarkChildTableLookup(511);
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,499 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "coap/coap.hpp"
+#include "common/instance.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+static constexpr uint16_t kPeerPort    = 61631;
+static constexpr uint16_t kPayloadSize = 48;
+
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : CoapBase(aInstance, &TestCoap::Send)
+        , mNumSent(0)
+    {
+    }
+
+    using CoapBase::Receive;
+
+    uint32_t GetNumSent(void) const { return mNumSent; }
+
+private:
+    static Error Send(CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        static_cast<TestCoap &>(aCoapBase).mNumSent++;
+        aMessage.Free();
+
+        return kErrorNone;
+    }
+
+    uint32_t mNumSent;
+};
+
+struct ResponseContext
+{
+    uint16_t mNumResponses;
+    Error    mLastResult;
+};
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, Error aResult)
+{
+    ResponseContext *context = static_cast<ResponseContext *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    context->mNumResponses++;
+    context->mLastResult = aResult;
+}
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint16_t *>(aContext))++;
+}
+
+static void PreparePeerInfo(Ip6::MessageInfo &aMessageInfo)
+{
+    aMessageInfo.Clear();
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString("fd00::1"));
+    SuccessOrQuit(aMessageInfo.GetSockAddr().FromString("fd00::2"));
+    aMessageInfo.SetPeerPort(kPeerPort);
+}
+
+static Error SendRequest(TestCoap &aCoap, const Ip6::MessageInfo &aMessageInfo, ResponseContext &aContext)
+{
+    Error          error   = kErrorNone;
+    Coap::Message *request = aCoap.NewMessage();
+    uint8_t        payload[kPayloadSize];
+
+    VerifyOrExit(request != nullptr, error = kErrorNoBufs);
+
+    memset(payload, 0xa5, sizeof(payload));
+
+    SuccessOrExit(error = request->Init(Coap::kTypeConfirmable, Coap::kCodePost, "a/test"));
+    SuccessOrExit(error = request->GenerateRandomToken(Coap::Message::kDefaultTokenLength));
+    SuccessOrExit(error = request->SetPayloadMarker());
+    SuccessOrExit(error = request->AppendBytes(payload, sizeof(payload)));
+
+    error = aCoap.SendMessage(*request, aMessageInfo, HandleResponse, &aContext);
+
+exit:
+    if ((error != kErrorNone) && (request != nullptr))
+    {
+        request->Free();
+    }
+
+    return error;
+}
+
+struct RequestId
+{
+    void Init(const Coap::Message &aRequest)
+    {
+        mMessageId   = aRequest.GetMessageId();
+        mTokenLength = aRequest.GetTokenLength();
+        memcpy(mToken, aRequest.GetToken(), mTokenLength);
+    }
+
+    uint16_t mMessageId;
+    uint8_t  mToken[Coap::Message::kMaxTokenLength];
+    uint8_t  mTokenLength;
+};
+
+static void ReceiveResponse(TestCoap &              aCoap,
+                            const Ip6::MessageInfo &aMessageInfo,
+                            Coap::Type              aType,
+                            const RequestId &       aRequestId,
+                            bool                    aEmpty = false)
+{
+    Coap::Message *response = aCoap.NewMessage();
+
+    VerifyOrQuit(response != nullptr);
+
+    response->Init(aType, aEmpty ? Coap::kCodeEmpty : Coap::kCodeChanged);
+    response->SetMessageId(aType == Coap::kTypeConfirmable ? 0x1234 : aRequestId.mMessageId);
+
+    if (!aEmpty)
+    {
+        SuccessOrQuit(response->SetToken(aRequestId.mToken, aRequestId.mTokenLength));
+    }
+
+    response->Finish();
+
+    aCoap.Receive(*response, aMessageInfo);
+    response->Free();
+}
+
+static void ReceiveResponse(TestCoap &              aCoap,
+                            const Ip6::MessageInfo &aMessageInfo,
+                            Coap::Type              aType,
+                            const Coap::Message &   aRequest,
+                            bool                    aEmpty = false)
+{
+    RequestId requestId;
+
+    requestId.Init(aRequest);
+    ReceiveResponse(aCoap, aMessageInfo, aType, requestId, aEmpty);
+}
+
+static const Coap::Message &GetRequestAt(const TestCoap &aCoap, uint16_t aIndex)
+{
+    const ot::Message *message = aCoap.GetRequestMessages().GetHead();
+
+    for (; aIndex > 0; aIndex--)
+    {
+        VerifyOrQuit(message != nullptr);
+        message = message->GetNext();
+    }
+
+    VerifyOrQuit(message != nullptr);
+
+    return *static_cast<const Coap::Message *>(message);
+}
+
+static uint16_t GetNumPendingRequests(const TestCoap &aCoap)
+{
+    uint16_t messages;
+    uint16_t buffers;
+
+    aCoap.GetRequestMessages().GetInfo(messages, buffers);
+
+    return messages;
+}
+
+void TestCoapRequestMatching(void)
+{
+    TestCoap *       coap;
+    Ip6::MessageInfo peerInfo;
+    Ip6::MessageInfo otherPortInfo;
+    ResponseContext  contexts[3];
+
+    printf("TestCoapRequestMatching");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    coap = new TestCoap(*sInstance);
+
+    PreparePeerInfo(peerInfo);
+    otherPortInfo = peerInfo;
+    otherPortInfo.SetPeerPort(kPeerPort + 1);
+
+    memset(contexts, 0, sizeof(contexts));
+
+    for (ResponseContext &context : contexts)
+    {
+        SuccessOrQuit(SendRequest(*coap, peerInfo, context));
+    }
+
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 3);
+    VerifyOrQuit(coap->GetNumSent() == 3);
+
+    // A piggybacked response from a different port must not match.
+    ReceiveResponse(*coap, otherPortInfo, Coap::kTypeAck, GetRequestAt(*coap, 1));
+    VerifyOrQuit(contexts[1].mNumResponses == 0);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 3);
+
+    // Piggybacked response for the second request (matched by Message ID).
+    ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, GetRequestAt(*coap, 1));
+    VerifyOrQuit(contexts[1].mNumResponses == 1);
+    VerifyOrQuit(contexts[1].mLastResult == kErrorNone);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 2);
+
+    // Empty ACK followed by a separate response (matched by Token).
+    ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, GetRequestAt(*coap, 0), /* aEmpty */ true);
+    VerifyOrQuit(contexts[0].mNumResponses == 0);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 2);
+
+    ReceiveResponse(*coap, peerInfo, Coap::kTypeConfirmable, GetRequestAt(*coap, 0));
+    VerifyOrQuit(contexts[0].mNumResponses == 1);
+    VerifyOrQuit(contexts[0].mLastResult == kErrorNone);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 1);
+
+    // Reset aborts the last request.
+    ReceiveResponse(*coap, peerInfo, Coap::kTypeReset, GetRequestAt(*coap, 0), /* aEmpty */ true);
+    VerifyOrQuit(contexts[2].mNumResponses == 1);
+    VerifyOrQuit(contexts[2].mLastResult == kErrorAbort);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 0);
+
+    // Aborting a transaction removes all its requests.
+    SuccessOrQuit(SendRequest(*coap, peerInfo, contexts[0]));
+    SuccessOrQuit(SendRequest(*coap, peerInfo, contexts[0]));
+    SuccessOrQuit(SendRequest(*coap, peerInfo, contexts[1]));
+    SuccessOrQuit(coap->AbortTransaction(HandleResponse, &contexts[0]));
+    VerifyOrQuit(contexts[0].mNumResponses == 3);
+    VerifyOrQuit(contexts[0].mLastResult == kErrorAbort);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 1);
+
+    coap->ClearRequestsAndResponses();
+    VerifyOrQuit(contexts[1].mNumResponses == 2);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 0);
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+void TestCoapResponsesCache(void)
+{
+    TestCoap *       coap;
+    Ip6::MessageInfo peerInfo;
+    Ip6::MessageInfo otherPortInfo;
+    Coap::Message *  request;
+    Coap::Message *  response;
+    uint16_t         numRequests = 0;
+
+    printf("TestCoapResponsesCache");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    coap = new TestCoap(*sInstance);
+    coap->SetDefaultHandler(HandleRequest, &numRequests);
+
+    PreparePeerInfo(peerInfo);
+    otherPortInfo = peerInfo;
+    otherPortInfo.SetPeerPort(kPeerPort + 1);
+
+    for (uint16_t messageId = 1; messageId <= 3; messageId++)
+    {
+        VerifyOrQuit((response = coap->NewMessage()) != nullptr);
+        response->Init(Coap::kTypeAck, Coap::kCodeChanged);
+        response->SetMessageId(messageId);
+        SuccessOrQuit(coap->SendMessage(*response, peerInfo));
+    }
+
+    VerifyOrQuit(coap->GetNumSent() == 3);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        // A retransmitted request is answered from the cache, but the
+        // same Message ID from a different port is a new request.
+
+        VerifyOrQuit((request = coap->NewMessage()) != nullptr);
+        SuccessOrQuit(request->Init(Coap::kTypeConfirmable, Coap::kCodePost, "a/test"));
+        request->SetMessageId(2);
+        request->Finish();
+
+        coap->Receive(*request, (i == 0) ? peerInfo : otherPortInfo);
+        request->Free();
+
+        VerifyOrQuit(numRequests == i);
+        VerifyOrQuit(coap->GetNumSent() == 4);
+    }
+
+    coap->ClearRequestsAndResponses();
+    VerifyOrQuit(coap->GetCachedResponses().GetHead() == nullptr);
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+void TestCoapRequestIndexOverflow(void)
+{
+    // More requests than index entries. The requests beyond the index
+    // are matched by scanning the queue until they complete.
+
+    static constexpr uint16_t kNumRequests = OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES + 8;
+
+    static RequestId requestIds[kNumRequests];
+
+    TestCoap *       coap;
+    Ip6::MessageInfo peerInfo;
+    ResponseContext  context;
+    ResponseContext  lastContext;
+
+    printf("TestCoapRequestIndexOverflow");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    coap = new TestCoap(*sInstance);
+    PreparePeerInfo(peerInfo);
+    memset(&context, 0, sizeof(context));
+    memset(&lastContext, 0, sizeof(lastContext));
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        SuccessOrQuit(SendRequest(*coap, peerInfo, (i == kNumRequests - 1) ? lastContext : context),
+                      "Sending a request beyond the index entries failed");
+        requestIds[i].Init(GetRequestAt(*coap, i));
+    }
+
+    VerifyOrQuit(GetNumPendingRequests(*coap) == kNumRequests);
+
+    // Answer the last (unindexed) request with a separate response
+    // matched by Token, then the others alternating between both ends
+    // of the queue with piggybacked responses matched by Message ID.
+
+    ReceiveResponse(*coap, peerInfo, Coap::kTypeConfirmable, requestIds[kNumRequests - 1]);
+    VerifyOrQuit(lastContext.mNumResponses == 1);
+    VerifyOrQuit(lastContext.mLastResult == kErrorNone);
+
+    for (uint16_t i = 0; i < (kNumRequests - 1) / 2; i++)
+    {
+        ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, requestIds[kNumRequests - 2 - i]);
+        ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, requestIds[i]);
+    }
+
+    if ((kNumRequests - 1) % 2 != 0)
+    {
+        ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, requestIds[(kNumRequests - 1) / 2]);
+    }
+
+    VerifyOrQuit(context.mNumResponses == kNumRequests - 1);
+    VerifyOrQuit(context.mLastResult == kErrorNone);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 0);
+
+    // Once the unindexed requests are gone, new requests are indexed again.
+
+    SuccessOrQuit(SendRequest(*coap, peerInfo, lastContext));
+    ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, GetRequestAt(*coap, 0));
+    VerifyOrQuit(lastContext.mNumResponses == 2);
+    VerifyOrQuit(GetNumPendingRequests(*coap) == 0);
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+#endif // OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+
+void BenchmarkCoapResponseMatching(uint16_t aNumRequests)
+{
+    static constexpr uint16_t kNumRounds      = 20;
+    static constexpr uint16_t kMaxNumRequests = 256;
+
+    static RequestId requestIds[kMaxNumRequests];
+
+    TestCoap *       coap;
+    Ip6::MessageInfo peerInfo;
+    ResponseContext  context;
+    uint16_t         numRequests = 0;
+    uint64_t         elapsed     = 0;
+
+    printf("BenchmarkCoapResponseMatching(%u) (%s) ", aNumRequests,
+           OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE ? "indexed" : "linear");
+
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    VerifyOrQuit(aNumRequests <= OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES,
+                 "OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENTRIES is too small for the benchmark");
+#endif
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    VerifyOrQuit(aNumRequests <= kMaxNumRequests);
+
+    coap = new TestCoap(*sInstance);
+    PreparePeerInfo(peerInfo);
+    memset(&context, 0, sizeof(context));
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        const ot::Message *message;
+        uint64_t           startTime;
+
+        for (numRequests = 0; numRequests < aNumRequests; numRequests++)
+        {
+            SuccessOrQuit(SendRequest(*coap, peerInfo, context), "Not enough message buffers for the benchmark");
+        }
+
+        message = coap->GetRequestMessages().GetHead();
+
+        for (uint16_t i = 0; i < numRequests; i++, message = message->GetNext())
+        {
+            requestIds[i].Init(*static_cast<const Coap::Message *>(message));
+        }
+
+        // Answer the most recent request first, which is the worst
+        // case for a scan of the pending requests in queue order.
+
+        startTime = GetMonotonicTimeUsec();
+
+        for (uint16_t remaining = numRequests; remaining > 0; remaining--)
+        {
+            ReceiveResponse(*coap, peerInfo, Coap::kTypeAck, requestIds[remaining - 1]);
+        }
+
+        elapsed += GetMonotonicTimeUsec() - startTime;
+
+        VerifyOrQuit(GetNumPendingRequests(*coap) == 0);
+    }
+
+    VerifyOrQuit(context.mNumResponses == numRequests * kNumRounds);
+    VerifyOrQuit(context.mLastResult == kErrorNone);
+
+    printf("%llu ns per response -- PASS\n",
+           static_cast<unsigned long long>(elapsed * 1000 / (static_cast<uint32_t>(numRequests) * kNumRounds)));
+
+    delete coap;
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestCoapRequestMatching();
+    ot::TestCoapResponsesCache();
+    ot::BenchmarkCoapResponseMatching(16);
+
+    // The large cases need a message buffer for each of several hundred
+    // pending requests (see `openthread-core-optional-features-config.h`).
+#if (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS >= 512) && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+#if OPENTHREAD_CONFIG_COAP_REQUEST_INDEX_ENABLE
+    ot::TestCoapRequestIndexOverflow();
+#endif
+    ot::BenchmarkCoapResponseMatching(256);
+#endif
+    printf("\nAll tests passed.\n");
+    return 0;
+}
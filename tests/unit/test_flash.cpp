@@ -32,10 +32,73 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "common/settings.hpp"
 #include "utils/flash.hpp"
 
 #include "test_platform.h"
-#include "test_util.h"
+#include "test_util.hpp"
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+
+// The flash platform APIs below override the ones in `test_platform.cpp`. The flash area is large enough for the
+// benchmark, keeps its content across `otPlatFlashInit()` (i.e. a reboot), and counts the flash accesses.
+
+enum
+{
+    kFlashSwapSize = 32768,
+    kFlashSwapNum  = 2,
+};
+
+static uint8_t  sFlash[kFlashSwapSize * kFlashSwapNum];
+static uint32_t sFlashReadCount;
+static uint32_t sFlashWriteCount;
+
+static void ResetFlash(void)
+{
+    memset(sFlash, 0xff, sizeof(sFlash));
+}
+
+void otPlatFlashInit(otInstance *)
+{
+}
+
+uint32_t otPlatFlashGetSwapSize(otInstance *)
+{
+    return kFlashSwapSize;
+}
+
+void otPlatFlashErase(otInstance *, uint8_t aSwapIndex)
+{
+    VerifyOrQuit(aSwapIndex < kFlashSwapNum, "aSwapIndex invalid");
+
+    memset(sFlash + aSwapIndex * kFlashSwapSize, 0xff, kFlashSwapSize);
+}
+
+void otPlatFlashRead(otInstance *, uint8_t aSwapIndex, uint32_t aOffset, void *aData, uint32_t aSize)
+{
+    VerifyOrQuit(aSwapIndex < kFlashSwapNum, "aSwapIndex invalid");
+    VerifyOrQuit(aSize <= kFlashSwapSize, "aSize invalid");
+    VerifyOrQuit(aOffset <= (kFlashSwapSize - aSize), "aOffset + aSize invalid");
+
+    memcpy(aData, sFlash + aSwapIndex * kFlashSwapSize + aOffset, aSize);
+    sFlashReadCount++;
+}
+
+void otPlatFlashWrite(otInstance *, uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize)
+{
+    VerifyOrQuit(aSwapIndex < kFlashSwapNum, "aSwapIndex invalid");
+    VerifyOrQuit(aSize <= kFlashSwapSize, "aSize invalid");
+    VerifyOrQuit(aOffset <= (kFlashSwapSize - aSize), "aOffset + aSize invalid");
+
+    for (uint32_t index = 0; index < aSize; index++)
+    {
+        sFlash[aSwapIndex * kFlashSwapSize + aOffset + index] &= static_cast<const uint8_t *>(aData)[index];
+    }
+
+    sFlashWriteCount++;
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 
 namespace ot {
 
@@ -53,6 +116,7 @@ void TestFlash(void)
         readBuffer[i] = i & 0xff;
     }
 
+    ResetFlash();
     flash.Init();
 
     // No records in settings
@@ -183,6 +247,117 @@ void TestFlash(void)
         VerifyOrQuit(length == key, "Get() did not return expected length");
         VerifyOrQuit(memcmp(readBuffer, writeBuffer, length) == 0, "Get() did not return expected value");
     }
+
+    // Values are restored after a reboot
+
+    {
+        Flash rebootedFlash(*instance);
+
+        rebootedFlash.Init();
+
+        for (uint16_t key = 0; key < 16; key++)
+        {
+            uint16_t length = key;
+
+            SuccessOrQuit(rebootedFlash.Get(key, 0, readBuffer, &length));
+            VerifyOrQuit(length == key, "Get() did not return expected length after reboot");
+            VerifyOrQuit(rebootedFlash.Get(key, 1, nullptr, nullptr) == kErrorNotFound);
+        }
+    }
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_SKIP_UNCHANGED_SET_ENABLE
+    // Set() with an unchanged value does not write
+
+    {
+        uint32_t writeCount = sFlashWriteCount;
+
+        SuccessOrQuit(flash.Set(1, writeBuffer, 1));
+        VerifyOrQuit(sFlashWriteCount == writeCount, "Set() with unchanged value wrote to flash");
+
+        writeBuffer[0] ^= 0xff;
+        SuccessOrQuit(flash.Set(1, writeBuffer, 1));
+        VerifyOrQuit(sFlashWriteCount != writeCount, "Set() with changed value did not write to flash");
+    }
+#endif
+
+    testFreeInstance(instance);
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+}
+
+void BenchmarkFlashRestore(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+    // Measures the boot-time restore of the child table: `Init()`
+    // followed by reading every child info record by index, as done by
+    // `Settings::IterateChildInfo()`.
+
+    static constexpr uint16_t kNumChildren = 500;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    static_assert(OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES >= kNumChildren,
+                  "OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_MAX_ENTRIES is too small for the benchmark");
+#endif
+
+    Instance *          instance = testInitInstance();
+    Flash               flash(*instance);
+    Flash               rebootedFlash(*instance);
+    Settings::ChildInfo childInfo;
+    uint16_t            numRestored = 0;
+    uint64_t            startTime;
+    uint64_t            restoreTime;
+    uint32_t            readCount;
+    uint32_t            getReadCount;
+
+    printf("BenchmarkFlashRestore(%u) (%s) ", kNumChildren,
+           OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE ? "indexed" : "scan");
+
+    ResetFlash();
+    flash.Init();
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        childInfo.Init();
+        childInfo.SetRloc16(i);
+        SuccessOrQuit(flash.Add(SettingsBase::kKeyChildInfo, reinterpret_cast<const uint8_t *>(&childInfo),
+                                sizeof(childInfo)));
+    }
+
+    readCount = sFlashReadCount;
+    startTime = GetMonotonicTimeUsec();
+
+    rebootedFlash.Init();
+
+    getReadCount = sFlashReadCount;
+
+    while (true)
+    {
+        uint16_t length = sizeof(childInfo);
+
+        if (rebootedFlash.Get(SettingsBase::kKeyChildInfo, numRestored, reinterpret_cast<uint8_t *>(&childInfo),
+                              &length) != kErrorNone)
+        {
+            break;
+        }
+
+        VerifyOrQuit(childInfo.GetRloc16() == numRestored, "Get() did not return expected child info");
+        numRestored++;
+    }
+
+    restoreTime  = GetMonotonicTimeUsec() - startTime;
+    getReadCount = sFlashReadCount - getReadCount;
+    readCount    = sFlashReadCount - readCount;
+
+    VerifyOrQuit(numRestored == kNumChildren);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_ENABLE
+    // With the index, `Get()` only reads the value itself.
+    VerifyOrQuit(getReadCount == kNumChildren, "Get() did not use the index");
+#endif
+
+    printf("%llu usec, %lu flash reads -- PASS\n", static_cast<unsigned long long>(restoreTime),
+           static_cast<unsigned long>(readCount));
+
+    testFreeInstance(instance);
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 }
 
@@ -191,6 +366,7 @@ void TestFlash(void)
 int main(void)
 {
     ot::TestFlash();
+    ot::BenchmarkFlashRestore();
     printf("All tests passed\n");
     return 0;
 }
@@ -33,6 +33,7 @@
 #include "lib/hdlc/hdlc.hpp"
 
 #include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 namespace Ncp {
@@ -644,6 +645,198 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void TestEncoderDecoderBlocks(void)
+{
+    enum
+    {
+        kSmallBufferSize = 64,
+    };
+
+    uint16_t                            length;
+    uint8_t                             frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize>      blockBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      byteBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      decoderBuffer;
+    Hdlc::FrameBuffer<kSmallBufferSize> smallBuffer;
+    DecoderContext                      decoderContext;
+    Hdlc::Encoder                       blockEncoder(blockBuffer);
+    Hdlc::Encoder                       byteEncoder(byteBuffer);
+    Hdlc::Decoder                       decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    Hdlc::Decoder                       smallDecoder(smallBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder block processing");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration / 10; iter++)
+    {
+        uint16_t offset;
+        uint16_t numSpecials;
+
+        blockBuffer.Clear();
+        byteBuffer.Clear();
+        decoderBuffer.Clear();
+
+        length = static_cast<uint16_t>(GetRandom(kMaxFrameLength));
+
+        // Use mostly plain bytes with a few (or no) bytes needing escape,
+        // so long unescaped runs are exercised.
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            do
+            {
+                frame[i] = static_cast<uint8_t>(GetRandom(256));
+            } while ((frame[i] == kFlagSequence) || (frame[i] == kEscapeSequence) || (frame[i] == kFlagXOn) ||
+                     (frame[i] == kFlagXOff) || (frame[i] == kFlagSpecial));
+        }
+
+        numSpecials = (length > 0) ? static_cast<uint16_t>(GetRandom(4)) : 0;
+
+        for (uint16_t i = 0; i < numSpecials; i++)
+        {
+            frame[GetRandom(length)] = sHdlcSpecials[GetRandom(sizeof(sHdlcSpecials))];
+        }
+
+        // The block `Encode()` must produce the same output as encoding byte by byte.
+
+        SuccessOrQuit(blockEncoder.BeginFrame());
+        SuccessOrQuit(blockEncoder.Encode(frame, length));
+        SuccessOrQuit(blockEncoder.EndFrame());
+
+        SuccessOrQuit(byteEncoder.BeginFrame());
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(byteEncoder.Encode(frame[i]));
+        }
+
+        SuccessOrQuit(byteEncoder.EndFrame());
+
+        VerifyOrQuit(blockBuffer.GetLength() == byteBuffer.GetLength());
+        VerifyOrQuit(memcmp(blockBuffer.GetFrame(), byteBuffer.GetFrame(), blockBuffer.GetLength()) == 0);
+
+        // Feed the encoded frame to decoder in randomly sized pieces (with leading noise).
+
+        decoderContext.mWasCalled = false;
+        decoder.Reset();
+        decoder.Decode(reinterpret_cast<const uint8_t *>(sSkipText), sizeof(sSkipText) - 1);
+
+        for (offset = 0; offset < blockBuffer.GetLength();)
+        {
+            uint16_t size = static_cast<uint16_t>(GetRandom(blockBuffer.GetLength() - offset) + 1);
+
+            decoder.Decode(blockBuffer.GetFrame() + offset, size);
+            offset += size;
+        }
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                     "Decoded frame content does not match original frame");
+
+        // Verify decoding into a buffer too small for the frame fails
+        // with `NO_BUFS` and decoder recovers for the next frame.
+
+        if (length > kSmallBufferSize)
+        {
+            smallBuffer.Clear();
+            decoderContext.mWasCalled = false;
+            smallDecoder.Decode(blockBuffer.GetFrame(), blockBuffer.GetLength());
+            VerifyOrQuit(decoderContext.mWasCalled);
+            VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS, "Decoder::Decode() did not fail with NO_BUFS");
+
+            blockBuffer.Clear();
+            SuccessOrQuit(blockEncoder.BeginFrame());
+            SuccessOrQuit(blockEncoder.Encode(frame, kSmallBufferSize - 2));
+            SuccessOrQuit(blockEncoder.EndFrame());
+
+            smallBuffer.Clear();
+            decoderContext.mWasCalled = false;
+            smallDecoder.Decode(blockBuffer.GetFrame(), blockBuffer.GetLength());
+            VerifyOrQuit(decoderContext.mWasCalled);
+            VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+            VerifyOrQuit(smallBuffer.GetLength() == kSmallBufferSize - 2);
+            VerifyOrQuit(memcmp(smallBuffer.GetFrame(), frame, kSmallBufferSize - 2) == 0);
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkEncoderDecoder(void)
+{
+    enum
+    {
+        kFrameLength   = 1280,
+        kNumIterations = 20000,
+    };
+
+    uint8_t                        frame[kFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    uint64_t                       startTime;
+    uint64_t                       byteEncodeTime;
+    uint64_t                       blockEncodeTime;
+    uint64_t                       decodeTime;
+
+    // Random frame content (about 2% of bytes need escaping).
+
+    for (uint8_t &byte : frame)
+    {
+        byte = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame());
+
+        for (uint8_t byte : frame)
+        {
+            SuccessOrQuit(encoder.Encode(byte));
+        }
+
+        SuccessOrQuit(encoder.EndFrame());
+    }
+
+    byteEncodeTime = GetMonotonicTimeUsec() - startTime;
+    startTime      = GetMonotonicTimeUsec();
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, sizeof(frame)));
+        SuccessOrQuit(encoder.EndFrame());
+    }
+
+    blockEncodeTime = GetMonotonicTimeUsec() - startTime;
+    startTime       = GetMonotonicTimeUsec();
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        decoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled && (decoderContext.mError == OT_ERROR_NONE));
+    }
+
+    decodeTime = GetMonotonicTimeUsec() - startTime;
+
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, sizeof(frame)) == 0);
+
+    printf("BenchmarkEncoderDecoder(%u bytes x %u, %s FCS): byte encode %llu usec, block encode %llu usec, "
+           "decode %llu usec\n",
+           kFrameLength, kNumIterations, OPENTHREAD_HDLC_CONFIG_FCS_SLICE_BY_8_ENABLE ? "slice-by-8" : "table",
+           static_cast<unsigned long long>(byteEncodeTime), static_cast<unsigned long long>(blockEncodeTime),
+           static_cast<unsigned long long>(decodeTime));
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -653,6 +846,8 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderBlocks();
+    ot::Ncp::BenchmarkEncoderDecoder();
     printf("\nAll tests passed.\n");
     return 0;
 }
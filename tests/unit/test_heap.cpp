@@ -31,7 +31,9 @@
 #include "core/utils/heap.hpp"
 
 #include <stdlib.h>
+#include <time.h>
 
+#include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "crypto/aes_ccm.hpp"
 
@@ -167,10 +169,239 @@ void TestAllocateMultiple(void)
     }
 }
 
+/**
+ * Verifies the heap statistics.
+ *
+ */
+void TestHeapStats(void)
+{
+    ot::Utils::Heap        heap;
+    ot::Utils::Heap::Stats stats;
+    void *                 first;
+    void *                 middle;
+    void *                 last;
+    const size_t           unit = heap.GetCapacity() / 8;
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFreeSize == heap.GetCapacity(), "TestHeapStats free size is incorrect");
+    VerifyOrQuit(stats.mLargestFreeBlock == heap.GetCapacity(), "TestHeapStats largest free block is incorrect");
+    VerifyOrQuit(stats.mFreeBlockCount == 1, "TestHeapStats free block count is incorrect");
+    VerifyOrQuit(stats.mFragmentation == 0, "TestHeapStats fragmentation is incorrect");
+    VerifyOrQuit(stats.mMaxUsedSize == 0 && stats.mFailedAllocs == 0, "TestHeapStats counters are not zero");
+
+    first  = heap.CAlloc(1, unit);
+    middle = heap.CAlloc(2, unit);
+    last   = heap.CAlloc(1, unit);
+    VerifyOrQuit(first != nullptr && middle != nullptr && last != nullptr, "TestHeapStats allocating failed");
+
+    heap.Free(middle);
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFreeBlockCount == 2, "TestHeapStats free block count is incorrect");
+    VerifyOrQuit(stats.mFreeSize == heap.GetFreeSize(), "TestHeapStats free size is incorrect");
+    VerifyOrQuit(stats.mLargestFreeBlock < stats.mFreeSize, "TestHeapStats largest free block is incorrect");
+    VerifyOrQuit(stats.mFragmentation > 0, "TestHeapStats fragmentation is incorrect");
+    VerifyOrQuit(stats.mMaxUsedSize >= unit * 4, "TestHeapStats high-water mark is incorrect");
+
+    VerifyOrQuit(heap.CAlloc(1, heap.GetCapacity()) == nullptr, "TestHeapStats allocating too large succeeded");
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFailedAllocs == 1, "TestHeapStats failed allocation count is incorrect");
+
+    heap.ResetStats();
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFailedAllocs == 0, "TestHeapStats failed allocation count is not reset");
+    VerifyOrQuit(stats.mMaxUsedSize == heap.GetCapacity() - heap.GetFreeSize(),
+                 "TestHeapStats high-water mark is not reset");
+
+    heap.Free(first);
+    heap.Free(last);
+    heap.GetStats(stats);
+    VerifyOrQuit(heap.IsClean() && stats.mFreeBlockCount == 1 && stats.mFragmentation == 0,
+                 "TestHeapStats heap not clean after freeing all!");
+}
+
+static uint32_t TraceRandom(uint32_t &aSeed, uint32_t aLimit)
+{
+    // A local generator keeps the trace identical on every platform.
+    aSeed = aSeed * 1103515245 + 12345;
+    return (aSeed >> 8) % aLimit;
+}
+
+/**
+ * Replays a long-running allocation trace (many small, mostly short-lived objects such as strings and SRP records,
+ * and fewer larger session buffers), verifying the heap integrity and reporting the time taken and fragmentation.
+ *
+ */
+void TestAllocationTraceReplay(void)
+{
+    static constexpr uint16_t kMaxLiveObjects = 512;
+    static constexpr uint32_t kNumSteps       = 200000;
+    static constexpr uint32_t kMaxOperations  = kNumSteps * 2 + kMaxLiveObjects;
+    static constexpr uint16_t kInvalidSlot    = 0xffff;
+
+    struct Operation
+    {
+        uint16_t mSlot;
+        uint16_t mSize; // Zero to free the object in `mSlot`.
+    };
+
+    struct Object
+    {
+        uint16_t mSize;
+        uint32_t mExpiry;
+    };
+
+    static Operation trace[kMaxOperations];
+
+    ot::Utils::Heap        heap;
+    ot::Utils::Heap::Stats stats;
+    Object                 objects[kMaxLiveObjects];
+    void *                 pointers[kMaxLiveObjects];
+    uint32_t               numOperations    = 0;
+    uint32_t               seed             = 0x12345678;
+    uint32_t               liveBytes        = 0;
+    uint32_t               maxFragmentation = 0;
+    uint32_t               allocs           = 0;
+    clock_t                start;
+
+    // Generate the trace, keeping the live objects within 75% of the
+    // heap capacity.
+
+    memset(objects, 0, sizeof(objects));
+
+    for (uint32_t now = 0; now < kNumSteps; now++)
+    {
+        uint16_t freeSlot = kInvalidSlot;
+        uint32_t kind     = TraceRandom(seed, 100);
+        uint16_t size;
+        uint32_t lifetime;
+
+        for (uint16_t slot = 0; slot < kMaxLiveObjects; slot++)
+        {
+            if (objects[slot].mSize != 0 && objects[slot].mExpiry <= now)
+            {
+                trace[numOperations++] = {slot, 0};
+                liveBytes -= objects[slot].mSize;
+                objects[slot].mSize = 0;
+            }
+
+            if (objects[slot].mSize == 0 && freeSlot == kInvalidSlot)
+            {
+                freeSlot = slot;
+            }
+        }
+
+        if (kind < 55)
+        {
+            // Strings (e.g., `HeapString` host and service names).
+            size     = static_cast<uint16_t>(8 + TraceRandom(seed, 40));
+            lifetime = 1 + TraceRandom(seed, kind < 40 ? 50 : 20000);
+        }
+        else if (kind < 90)
+        {
+            // SRP host and service records.
+            size     = static_cast<uint16_t>(48 + TraceRandom(seed, 120));
+            lifetime = 1 + TraceRandom(seed, kind < 75 ? 200 : 20000);
+        }
+        else
+        {
+            // Session buffers (e.g., DNS queries or commissioner sessions).
+            size     = static_cast<uint16_t>(300 + TraceRandom(seed, 900));
+            lifetime = 1 + TraceRandom(seed, 500);
+        }
+
+        if (freeSlot == kInvalidSlot || liveBytes + size > heap.GetCapacity() * 3 / 4)
+        {
+            continue;
+        }
+
+        trace[numOperations++] = {freeSlot, size};
+        objects[freeSlot].mSize   = size;
+        objects[freeSlot].mExpiry = now + lifetime;
+        liveBytes += size;
+    }
+
+    for (uint16_t slot = 0; slot < kMaxLiveObjects; slot++)
+    {
+        if (objects[slot].mSize != 0)
+        {
+            trace[numOperations++] = {slot, 0};
+        }
+    }
+
+    // Replay the trace (timed), then replay it again to check the
+    // memory and collect the fragmentation.
+
+    memset(pointers, 0, sizeof(pointers));
+
+    start = clock();
+
+    for (uint32_t i = 0; i < numOperations; i++)
+    {
+        const Operation &operation = trace[i];
+
+        if (operation.mSize != 0)
+        {
+            pointers[operation.mSlot] = heap.CAlloc(1, operation.mSize);
+        }
+        else
+        {
+            heap.Free(pointers[operation.mSlot]);
+            pointers[operation.mSlot] = nullptr;
+        }
+    }
+
+    heap.GetStats(stats);
+    printf("TestAllocationTraceReplay: %u operations in %lu us (capacity %zu bytes, high-water %u bytes, %u failed "
+           "allocations)\n",
+           numOperations, static_cast<unsigned long>((clock() - start) * 1000000 / CLOCKS_PER_SEC), heap.GetCapacity(),
+           stats.mMaxUsedSize, stats.mFailedAllocs);
+
+    VerifyOrQuit(heap.IsClean() && heap.GetFreeSize() == heap.GetCapacity(),
+                 "TestAllocationTraceReplay heap not clean after replay!");
+
+    for (uint32_t i = 0; i < numOperations; i++)
+    {
+        const Operation &operation = trace[i];
+
+        if (operation.mSize != 0)
+        {
+            pointers[operation.mSlot] = heap.CAlloc(1, operation.mSize);
+            VerifyOrQuit(pointers[operation.mSlot] == nullptr ||
+                             *static_cast<uint8_t *>(pointers[operation.mSlot]) == 0,
+                         "TestAllocationTraceReplay memory not initialized to zero!");
+
+            if (pointers[operation.mSlot] != nullptr)
+            {
+                memset(pointers[operation.mSlot], 0xa5, operation.mSize);
+            }
+
+            allocs++;
+        }
+        else
+        {
+            heap.Free(pointers[operation.mSlot]);
+            pointers[operation.mSlot] = nullptr;
+        }
+
+        if (allocs % 64 == 0)
+        {
+            heap.GetStats(stats);
+            maxFragmentation = OT_MAX(maxFragmentation, stats.mFragmentation);
+        }
+    }
+
+    printf("TestAllocationTraceReplay: max fragmentation %u%%\n", maxFragmentation);
+
+    VerifyOrQuit(heap.IsClean() && heap.GetFreeSize() == heap.GetCapacity(),
+                 "TestAllocationTraceReplay heap not clean after replay!");
+}
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestHeapStats();
+    TestAllocationTraceReplay();
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/key_manager.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+static const uint32_t kKeySequences[] = {0, 1, 2, 0x7f, 0x80, 1000, 0x7fffffff, 0xfffffffe, 0xffffffff};
+
+// Number of key sequences to move away from a tested sequence so that its previous/next keys are not cached.
+static constexpr uint32_t kFarSequenceOffset = 100;
+
+void TestKeyManagerMleKeyCache(void)
+{
+    NetworkKey networkKey;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null OpenThread instance");
+
+    {
+        KeyManager &keyManager = sInstance->Get<KeyManager>();
+
+        SuccessOrQuit(networkKey.GenerateRandom());
+        keyManager.SetNetworkKey(networkKey);
+
+        for (uint32_t keySequence : kKeySequences)
+        {
+            Mle::KeyMaterial prevKey;
+            Mle::KeyMaterial nextKey;
+
+            // Derive the previous and next keys while they are not cached.
+
+            keyManager.SetCurrentKeySequence(keySequence + kFarSequenceOffset);
+            keyManager.ResetCounters();
+
+            prevKey = keyManager.GetTemporaryMleKey(keySequence - 1);
+            nextKey = keyManager.GetTemporaryMleKey(keySequence + 1);
+
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheMisses == 2);
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheHits == 0);
+            VerifyOrQuit(keyManager.GetCounters().mKeyDerivations == 2);
+            VerifyOrQuit(!(prevKey == nextKey), "keys of different sequences are equal");
+
+            // The cached keys must match the fresh derivations.
+
+            keyManager.SetCurrentKeySequence(keySequence);
+            keyManager.ResetCounters();
+
+            VerifyOrQuit(keyManager.GetTemporaryMleKey(keySequence - 1) == prevKey, "cached previous key mismatch");
+            VerifyOrQuit(keyManager.GetTemporaryMleKey(keySequence + 1) == nextKey, "cached next key mismatch");
+
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheHits == 2);
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheMisses == 0);
+            VerifyOrQuit(keyManager.GetCounters().mKeyDerivations == 0);
+
+            // The cached keys must match the current key once the key sequence moves to them.
+
+            keyManager.SetCurrentKeySequence(keySequence - 1);
+            VerifyOrQuit(keyManager.GetCurrentMleKey() == prevKey, "current key mismatch after moving back");
+
+            keyManager.SetCurrentKeySequence(keySequence + 1);
+            VerifyOrQuit(keyManager.GetCurrentMleKey() == nextKey, "current key mismatch after moving forward");
+        }
+
+        // Changing the network key must refresh the cached keys.
+
+        {
+            Mle::KeyMaterial nextKey;
+
+            keyManager.SetCurrentKeySequence(kKeySequences[0]);
+            nextKey = keyManager.GetTemporaryMleKey(kKeySequences[0] + 1);
+
+            SuccessOrQuit(networkKey.GenerateRandom());
+            keyManager.SetNetworkKey(networkKey);
+            VerifyOrQuit(!(keyManager.GetTemporaryMleKey(kKeySequences[0] + 1) == nextKey), "stale key after change");
+            nextKey = keyManager.GetTemporaryMleKey(kKeySequences[0] + 1);
+
+            keyManager.SetCurrentKeySequence(kKeySequences[0] + kFarSequenceOffset);
+            VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequences[0] + 1) == nextKey, "cached key mismatch");
+        }
+
+        keyManager.ResetCounters();
+        VerifyOrQuit(keyManager.GetCounters().mKeyDerivations == 0);
+        VerifyOrQuit(keyManager.GetCounters().mTrelKeyDerivations == 0);
+        VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheHits == 0);
+        VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheMisses == 0);
+    }
+
+    testFreeInstance(sInstance);
+
+    printf("TestKeyManagerMleKeyCache() passed\n");
+}
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+void TestKeyManagerTrelKeyCache(void)
+{
+    NetworkKey networkKey;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null OpenThread instance");
+
+    {
+        KeyManager &keyManager = sInstance->Get<KeyManager>();
+
+        SuccessOrQuit(networkKey.GenerateRandom());
+        keyManager.SetNetworkKey(networkKey);
+
+        for (uint32_t keySequence : kKeySequences)
+        {
+            Mac::KeyMaterial prevKey;
+            Mac::KeyMaterial nextKey;
+
+            keyManager.SetCurrentKeySequence(keySequence + kFarSequenceOffset);
+            keyManager.ResetCounters();
+
+            prevKey = keyManager.GetTemporaryTrelMacKey(keySequence - 1);
+            nextKey = keyManager.GetTemporaryTrelMacKey(keySequence + 1);
+
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheMisses == 2);
+            VerifyOrQuit(keyManager.GetCounters().mTrelKeyDerivations == 2);
+            VerifyOrQuit(!(prevKey == nextKey), "keys of different sequences are equal");
+
+            keyManager.SetCurrentKeySequence(keySequence);
+            keyManager.ResetCounters();
+
+            VerifyOrQuit(keyManager.GetTemporaryTrelMacKey(keySequence - 1) == prevKey, "cached previous key mismatch");
+            VerifyOrQuit(keyManager.GetTemporaryTrelMacKey(keySequence + 1) == nextKey, "cached next key mismatch");
+
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheHits == 2);
+            VerifyOrQuit(keyManager.GetCounters().mTemporaryKeyCacheMisses == 0);
+            VerifyOrQuit(keyManager.GetCounters().mTrelKeyDerivations == 0);
+
+            keyManager.SetCurrentKeySequence(keySequence - 1);
+            VerifyOrQuit(keyManager.GetCurrentTrelMacKey() == prevKey, "current key mismatch after moving back");
+
+            keyManager.SetCurrentKeySequence(keySequence + 1);
+            VerifyOrQuit(keyManager.GetCurrentTrelMacKey() == nextKey, "current key mismatch after moving forward");
+        }
+    }
+
+    testFreeInstance(sInstance);
+
+    printf("TestKeyManagerTrelKeyCache() passed\n");
+}
+#endif // OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestKeyManagerMleKeyCache();
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    ot::TestKeyManagerTrelKeyCache();
+#endif
+    printf("\nAll tests passed.\n");
+    return 0;
+}
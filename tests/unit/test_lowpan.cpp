@@ -98,6 +98,38 @@ void TestIphcVector::GetUncompressedStream(Message &aMessage)
     SuccessOrQuit(aMessage.AppendBytes(mPayload.mData, mPayload.mLength));
 }
 
+// Emulate global prefixes with contextes.
+static const uint8_t sMockNetworkData[] = {
+    0x0c, // MLE Network Data Type
+    0x20, // MLE Network Data Length
+
+    // Prefix 2001:2:0:1::/64
+    0x03, 0x0e,                                                             // Prefix TLV
+    0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x07, 0x02, // 6LoWPAN Context ID TLV
+    0x11, 0x40,                                                             // Context ID = 1, C = TRUE
+
+    // Prefix 2001:2:0:2::/64
+    0x03, 0x0e,                                                             // Prefix TLV
+    0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, // 6LoWPAN Context ID TLV
+    0x02, 0x40                                                              // Context ID = 2, C = FALSE
+};
+
+/**
+ * This function sets the Network Data from a MLE Network Data TLV.
+ *
+ */
+static void SetNetworkData(uint8_t aVersion, const uint8_t *aNetworkDataTlv, uint16_t aLength)
+{
+    Message *message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr, "Ip6::NewMessage failed");
+
+    SuccessOrQuit(message->AppendBytes(aNetworkDataTlv, aLength));
+
+    IgnoreError(sInstance->Get<NetworkData::Leader>().SetNetworkData(aVersion, aVersion, true, *message, 0));
+
+    message->Free();
+}
+
 /**
  * This function initializes Thread Interface.
  *
@@ -108,28 +140,95 @@ static void Init(void)
 
     sInstance->Get<Mle::MleRouter>().SetMeshLocalPrefix(static_cast<Mle::MeshLocalPrefix &>(meshLocalPrefix));
 
-    // Emulate global prefixes with contextes.
-    uint8_t mockNetworkData[] = {
-        0x0c, // MLE Network Data Type
-        0x20, // MLE Network Data Length
+    SetNetworkData(0, sMockNetworkData, sizeof(sMockNetworkData));
+}
 
-        // Prefix 2001:2:0:1::/64
-        0x03, 0x0e,                                                             // Prefix TLV
-        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x07, 0x02, // 6LoWPAN Context ID TLV
-        0x11, 0x40,                                                             // Context ID = 1, C = TRUE
+/**
+ * This function compresses the uncompressed stream of the given test vector and verifies the result.
+ *
+ */
+static void TestCompress(TestIphcVector &aVector, const uint8_t *aIphc, uint16_t aIphcLength)
+{
+    Message *            message = nullptr;
+    uint8_t              result[512];
+    Lowpan::BufferWriter buffer(result, 127);
 
-        // Prefix 2001:2:0:2::/64
-        0x03, 0x0e,                                                             // Prefix TLV
-        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, // 6LoWPAN Context ID TLV
-        0x02, 0x40                                                              // Context ID = 2, C = FALSE
-    };
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr);
 
-    Message *message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0);
-    VerifyOrQuit(message != nullptr, "Ip6::NewMessage failed");
+    aVector.GetUncompressedStream(*message);
+
+    VerifyOrQuit(sLowpan->Compress(*message, aVector.mMacSource, aVector.mMacDestination, buffer) == aVector.mError);
+
+    if (aVector.mError == kErrorNone)
+    {
+        uint8_t compressBytes = static_cast<uint8_t>(buffer.GetWritePointer() - result);
+
+        // Append payload to the LOWPAN_IPHC.
+        message->ReadBytes(message->GetOffset(), result + compressBytes, message->GetLength() - message->GetOffset());
+
+        DumpBuffer("Resulted LOWPAN_IPHC compressed frame", result,
+                   compressBytes + message->GetLength() - message->GetOffset());
+
+        VerifyOrQuit(compressBytes == aVector.mIphcHeader.mLength, "Lowpan::Compress failed");
+        VerifyOrQuit(message->GetOffset() == aVector.mPayloadOffset, "Lowpan::Compress failed");
+        VerifyOrQuit(memcmp(aIphc, result, aIphcLength) == 0, "Lowpan::Compress failed");
+    }
+
+    message->Free();
+}
+
+static uint32_t sBenchmarkVectors;
+static uint64_t sBenchmarkUncachedTime;
+static uint64_t sBenchmarkCachedTime;
+
+/**
+ * This function measures the time to compress the given test vector, with and without the flow cache.
+ *
+ */
+static void BenchmarkCompress(TestIphcVector &aVector)
+{
+    static constexpr uint16_t kIterations = 1000;
+
+    Message *message = nullptr;
+    uint8_t  result[127];
+    uint64_t startTime;
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr);
+
+    aVector.GetUncompressedStream(*message);
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint16_t i = 0; i < kIterations; i++)
+    {
+        Lowpan::BufferWriter buffer(result, sizeof(result));
+
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+        sLowpan->ClearFlowCache();
+#endif
+        message->SetOffset(0);
+        SuccessOrQuit(sLowpan->Compress(*message, aVector.mMacSource, aVector.mMacDestination, buffer));
+    }
+
+    sBenchmarkUncachedTime += GetMonotonicTimeUsec() - startTime;
+
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint16_t i = 0; i < kIterations; i++)
+    {
+        Lowpan::BufferWriter buffer(result, sizeof(result));
+
+        message->SetOffset(0);
+        SuccessOrQuit(sLowpan->Compress(*message, aVector.mMacSource, aVector.mMacDestination, buffer));
+    }
+
+    sBenchmarkCachedTime += GetMonotonicTimeUsec() - startTime;
+#endif
 
-    SuccessOrQuit(message->AppendBytes(mockNetworkData, sizeof(mockNetworkData)));
+    sBenchmarkVectors++;
 
-    IgnoreError(sInstance->Get<NetworkData::Leader>().SetNetworkData(0, 0, true, *message, 0));
+    message->Free();
 }
 
 /**
@@ -169,33 +268,15 @@ static void Test(TestIphcVector &aVector, bool aCompress, bool aDecompress)
 
     if (aCompress)
     {
-        Lowpan::BufferWriter buffer(result, 127);
-
-        VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr);
-
-        aVector.GetUncompressedStream(*message);
-
-        VerifyOrQuit(sLowpan->Compress(*message, aVector.mMacSource, aVector.mMacDestination, buffer) ==
-                     aVector.mError);
+        // The second compression of the same flow is served from the
+        // flow cache (when enabled) and must produce the same frame.
+        TestCompress(aVector, iphc, iphcLength);
+        TestCompress(aVector, iphc, iphcLength);
 
         if (aVector.mError == kErrorNone)
         {
-            uint8_t compressBytes = static_cast<uint8_t>(buffer.GetWritePointer() - result);
-
-            // Append payload to the LOWPAN_IPHC.
-            message->ReadBytes(message->GetOffset(), result + compressBytes,
-                               message->GetLength() - message->GetOffset());
-
-            DumpBuffer("Resulted LOWPAN_IPHC compressed frame", result,
-                       compressBytes + message->GetLength() - message->GetOffset());
-
-            VerifyOrQuit(compressBytes == aVector.mIphcHeader.mLength, "Lowpan::Compress failed");
-            VerifyOrQuit(message->GetOffset() == aVector.mPayloadOffset, "Lowpan::Compress failed");
-            VerifyOrQuit(memcmp(iphc, result, iphcLength) == 0, "Lowpan::Compress failed");
+            BenchmarkCompress(aVector);
         }
-
-        message->Free();
-        message = nullptr;
     }
 
     if (aDecompress)
@@ -1736,6 +1817,59 @@ static void TestErrorReservedNhc6(void)
  * @section Main test.
  **************************************************************************************************/
 
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+static void TestFlowCacheNetworkDataChange(void)
+{
+    // Network Data without any context.
+    static const uint8_t kEmptyNetworkData[] = {0x0c, 0x00};
+
+    TestIphcVector testVector("Flow cache follows Network Data changes");
+
+    // Setup MAC addresses.
+    testVector.SetMacSource(sTestMacSourceDefaultShort);
+    testVector.SetMacDestination(sTestMacDestinationDefaultShort);
+
+    // Setup IPv6 header.
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault), Ip6::kProtoIcmp6, 64,
+                           "2001:2:0:1:abcd:ef01:2345:6789", "2001:2:0:1:c31d:a702:0d41:beef");
+
+    // Set LOWPAN_IPHC header (stateful compression with context 1).
+    uint8_t iphc[] = {0x7a, 0xd5, 0x11, 0x3a, 0xab, 0xcd, 0xef, 0x01, 0x23, 0x45,
+                      0x67, 0x89, 0xc3, 0x1d, 0xa7, 0x02, 0x0d, 0x41, 0xbe, 0xef};
+    testVector.SetIphcHeader(iphc, sizeof(iphc));
+
+    // Set payload and error.
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    testVector.SetPayloadOffset(40);
+    testVector.SetError(kErrorNone);
+
+    Test(testVector, true, false);
+
+    // Remove the context, both addresses are now carried in-line.
+    SetNetworkData(1, kEmptyNetworkData, sizeof(kEmptyNetworkData));
+
+    {
+        Message *            message;
+        uint8_t              result[127];
+        Lowpan::BufferWriter buffer(result, sizeof(result));
+
+        VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr);
+        testVector.GetUncompressedStream(*message);
+
+        SuccessOrQuit(sLowpan->Compress(*message, testVector.mMacSource, testVector.mMacDestination, buffer));
+        VerifyOrQuit(buffer.GetWritePointer() - result == 3 + 2 * sizeof(Ip6::Address),
+                     "Lowpan::Compress used a stale flow cache entry");
+
+        message->Free();
+    }
+
+    // Restore the original Network Data.
+    SetNetworkData(2, sMockNetworkData, sizeof(sMockNetworkData));
+
+    Test(testVector, true, false);
+}
+#endif
+
 void TestLowpanIphc(void)
 {
     sInstance = testInitInstance();
@@ -1825,6 +1959,17 @@ void TestLowpanIphc(void)
     TestErrorReservedNhc5();
     TestErrorReservedNhc6();
 
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    TestFlowCacheNetworkDataChange();
+#endif
+
+    printf("BenchmarkCompress(%u vectors x 1000): uncached %llu usec", sBenchmarkVectors,
+           static_cast<unsigned long long>(sBenchmarkUncachedTime));
+#if OPENTHREAD_CONFIG_LOWPAN_FLOW_CACHE_ENABLE
+    printf(", flow cache %llu usec", static_cast<unsigned long long>(sBenchmarkCachedTime));
+#endif
+    printf("\n");
+
     testFreeInstance(sInstance);
 }
 
@@ -26,10 +26,13 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <openthread/message.h>
+
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
+#include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -236,11 +239,194 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageChunks(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize    = (kBufferSize * 3 + 24),
+        kOffsetStep = 37,
+        kLengthStep = 29,
+    };
+
+    static const uint8_t kKey[] = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                                   0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+    static const uint8_t kNonce[Crypto::AesCcm::kNonceSize] = {0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00,
+                                                                0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+
+    Instance *      instance;
+    Message *       message;
+    uint8_t         writeBuffer[kMaxSize];
+    uint8_t         readBuffer[kMaxSize];
+    uint8_t         tag[4];
+    uint8_t         messageTag[4];
+    otMessageChunk  chunks[kMaxSize / kBufferSize + 4];
+    Crypto::AesCcm  aesCcm;
+    Mac::KeyMaterial key;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr);
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize));
+
+    // Verify the chunks from `otMessageGetChunks()` cover the requested range.
+
+    for (uint16_t offset = 0; offset <= kMaxSize; offset += kOffsetStep)
+    {
+        for (uint16_t length = 0; length <= kMaxSize + kLengthStep; length += kLengthStep)
+        {
+            uint16_t expectedLength = static_cast<uint16_t>(OT_MIN(length, kMaxSize - offset));
+            uint16_t readLength     = 0;
+            uint16_t numChunks      = OT_ARRAY_LENGTH(chunks);
+
+            SuccessOrQuit(otMessageGetChunks(message, offset, length, chunks, &numChunks));
+
+            for (uint16_t i = 0; i < numChunks; i++)
+            {
+                VerifyOrQuit(chunks[i].mLength > 0);
+                VerifyOrQuit(readLength + chunks[i].mLength <= expectedLength);
+                memcpy(&readBuffer[readLength], chunks[i].mData, chunks[i].mLength);
+                readLength += chunks[i].mLength;
+            }
+
+            VerifyOrQuit(readLength == expectedLength);
+            VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset], readLength) == 0);
+
+            // With one entry less, the range no longer fits (unless empty).
+
+            if (numChunks > 0)
+            {
+                uint16_t numFewerChunks = numChunks - 1;
+
+                VerifyOrQuit(otMessageGetChunks(message, offset, length, chunks, &numFewerChunks) == OT_ERROR_NO_BUFS);
+                VerifyOrQuit(numFewerChunks == numChunks - 1);
+            }
+        }
+    }
+
+    // Verify in-place `AesCcm::Payload()` on a message matches processing a flat buffer.
+
+    key.SetFrom(*reinterpret_cast<const Mac::Key *>(kKey));
+
+    for (uint16_t offset = 0; offset < kMaxSize; offset += kOffsetStep)
+    {
+        uint16_t length = kMaxSize - offset;
+
+        memcpy(readBuffer, writeBuffer, sizeof(readBuffer));
+        aesCcm.SetKey(key);
+        aesCcm.Init(0, length, sizeof(tag), kNonce, sizeof(kNonce));
+        aesCcm.Payload(&readBuffer[offset], &readBuffer[offset], length, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+
+        aesCcm.SetKey(key);
+        aesCcm.Init(0, length, sizeof(messageTag), kNonce, sizeof(kNonce));
+        aesCcm.Payload(*message, offset, length, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(messageTag);
+
+        VerifyOrQuit(memcmp(tag, messageTag, sizeof(tag)) == 0);
+        VerifyOrQuit(message->CompareBytes(0, readBuffer, kMaxSize));
+
+        aesCcm.SetKey(key);
+        aesCcm.Init(0, length, sizeof(messageTag), kNonce, sizeof(kNonce));
+        aesCcm.Payload(*message, offset, length, Crypto::AesCcm::kDecrypt);
+        aesCcm.Finalize(messageTag);
+
+        VerifyOrQuit(memcmp(tag, messageTag, sizeof(tag)) == 0);
+        VerifyOrQuit(message->CompareBytes(0, writeBuffer, kMaxSize));
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+void BenchmarkMessageAesCcm(void)
+{
+    // Compares the MLE style AES-CCM processing through a bounce
+    // buffer against in-place processing of the message chunks.
+
+    enum : uint16_t
+    {
+        kPacketSize   = 1280,
+        kNumPackets   = 20000,
+        kBounceBuffer = 64,
+    };
+
+    static const uint8_t kNonce[Crypto::AesCcm::kNonceSize] = {0};
+
+    Instance *       instance;
+    Message *        message;
+    uint8_t          packet[kPacketSize];
+    uint8_t          buf[kBounceBuffer];
+    uint8_t          tag[4];
+    Crypto::AesCcm   aesCcm;
+    Mac::KeyMaterial key;
+    uint64_t         startTime;
+    uint64_t         copyTime;
+    uint64_t         chunkTime;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr);
+
+    Random::NonCrypto::FillBuffer(packet, sizeof(packet));
+    SuccessOrQuit(message->AppendBytes(packet, sizeof(packet)));
+
+    memset(buf, 0, sizeof(buf));
+    key.SetFrom(*reinterpret_cast<const Mac::Key *>(buf));
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint16_t i = 0; i < kNumPackets; i++)
+    {
+        aesCcm.SetKey(key);
+        aesCcm.Init(0, kPacketSize, sizeof(tag), kNonce, sizeof(kNonce));
+
+        for (uint16_t offset = 0; offset < kPacketSize;)
+        {
+            uint16_t length = message->ReadBytes(offset, buf, sizeof(buf));
+
+            aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kEncrypt);
+            message->WriteBytes(offset, buf, length);
+            offset += length;
+        }
+
+        aesCcm.Finalize(tag);
+    }
+
+    copyTime  = GetMonotonicTimeUsec() - startTime;
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint16_t i = 0; i < kNumPackets; i++)
+    {
+        aesCcm.SetKey(key);
+        aesCcm.Init(0, kPacketSize, sizeof(tag), kNonce, sizeof(kNonce));
+        aesCcm.Payload(*message, 0, kPacketSize, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+    }
+
+    chunkTime = GetMonotonicTimeUsec() - startTime;
+
+    printf("BenchmarkMessageAesCcm(%u bytes): bounce buffer %llu usec (%u bytes copied/packet), "
+           "in place %llu usec (0 bytes copied/packet)\n",
+           kPacketSize, static_cast<unsigned long long>(copyTime), 2 * kPacketSize,
+           static_cast<unsigned long long>(chunkTime));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+    ot::TestMessageChunks();
+    ot::BenchmarkMessageAesCcm();
     printf("All tests passed\n");
     return 0;
 }
@@ -32,6 +32,8 @@
 
 #include "test_platform.h"
 
+#include <time.h>
+
 #include <openthread/config.h>
 #include <openthread/ip6.h>
 
@@ -39,6 +41,7 @@
 #include "backbone_router/multicast_listeners_table.hpp"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "thread/thread_tlvs.hpp"
 
 namespace ot {
 
@@ -189,11 +192,102 @@ void testMulticastListenersTableAPIs(Instance *aInstance)
 #endif
 }
 
+void TestMulticastListenersTableBenchmark(void)
+{
+    // Registers up to 4096 Multicast Listeners in bursts of MLR.req
+    // sized groups, renews and deregisters them in bursts, and then
+    // lets the remaining ones expire.
+    //
+    // The table checks its invariants after each change when
+    // `OPENTHREAD_CONFIG_ASSERT_ENABLE` is set in simulation builds,
+    // which makes every operation linear. Meaningful numbers require
+    // building with assertions disabled.
+
+    static constexpr uint16_t kNumListeners = OT_MIN(4096, OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS);
+    static constexpr uint32_t kTimeout      = 3600 * 1000;
+
+    MulticastListenersTable &table = sInstance->Get<MulticastListenersTable>();
+    Ip6::Address             address;
+    clock_t                  start;
+    clock_t                  registerTime;
+    clock_t                  renewTime;
+    clock_t                  deregisterTime;
+    clock_t                  expireTime;
+
+    printf("TestMulticastListenersTableBenchmark(%u listeners)\n", kNumListeners);
+
+    table.Clear();
+    address = static_cast<const Ip6::Address &>(MA501);
+
+    start = clock();
+
+    for (uint16_t i = 0; i < kNumListeners; i++)
+    {
+        if (i % kIp6AddressesNumMax == 0)
+        {
+            sNow++;
+        }
+
+        address.mFields.m16[6] = HostSwap16(i / 256);
+        address.mFields.m16[7] = HostSwap16(i);
+        SuccessOrQuit(table.Add(address, TimerMilli::GetNow() + kTimeout));
+    }
+
+    registerTime = clock() - start;
+    VerifyOrQuit(table.Count() == kNumListeners);
+
+    // Renewals arrive in the reverse order of the registrations.
+
+    start = clock();
+
+    for (uint16_t i = kNumListeners; i > 0; i--)
+    {
+        if (i % kIp6AddressesNumMax == 0)
+        {
+            sNow++;
+        }
+
+        address.mFields.m16[6] = HostSwap16((i - 1) / 256);
+        address.mFields.m16[7] = HostSwap16(i - 1);
+        SuccessOrQuit(table.Add(address, TimerMilli::GetNow() + kTimeout));
+    }
+
+    renewTime = clock() - start;
+    VerifyOrQuit(table.Count() == kNumListeners);
+
+    start = clock();
+
+    for (uint16_t i = 0; i < kNumListeners; i += 4)
+    {
+        address.mFields.m16[6] = HostSwap16(i / 256);
+        address.mFields.m16[7] = HostSwap16(i);
+        table.Remove(address);
+    }
+
+    deregisterTime = clock() - start;
+    VerifyOrQuit(table.Count() == kNumListeners - (kNumListeners + 3) / 4);
+
+    sNow += kTimeout;
+
+    start = clock();
+    table.Expire();
+    expireTime = clock() - start;
+
+    VerifyOrQuit(table.Count() == 0);
+
+    printf("register %lu us, renew %lu us, deregister %lu us, expire %lu us\n",
+           static_cast<unsigned long>(registerTime * 1000000 / CLOCKS_PER_SEC),
+           static_cast<unsigned long>(renewTime * 1000000 / CLOCKS_PER_SEC),
+           static_cast<unsigned long>(deregisterTime * 1000000 / CLOCKS_PER_SEC),
+           static_cast<unsigned long>(expireTime * 1000000 / CLOCKS_PER_SEC));
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMulticastListenersTable();
+    ot::TestMulticastListenersTableBenchmark();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -456,6 +456,191 @@ void TestNetworkDataDsnSrpServices(void)
     testFreeInstance(instance);
 }
 
+class TestLookupLeader : public Leader
+{
+public:
+    void Populate(const uint8_t *aTlvs, uint8_t aTlvsLength)
+    {
+        memcpy(mTlvs, aTlvs, aTlvsLength);
+        mLength = aTlvsLength;
+        mVersion++;
+    }
+};
+
+void VerifyContext(Leader &    aLeader,
+                   const char *aAddress,
+                   Error       aError,
+                   uint8_t     aContextId,
+                   uint8_t     aLength,
+                   bool        aCompress)
+{
+    Ip6::Address    address;
+    Lowpan::Context context;
+
+    SuccessOrQuit(address.FromString(aAddress));
+    VerifyOrQuit(aLeader.GetContext(address, context) == aError, "GetContext() failed");
+
+    if (aError == kErrorNone)
+    {
+        VerifyOrQuit(context.mContextId == aContextId, "GetContext() returned wrong context id");
+        VerifyOrQuit(context.mPrefix.GetLength() == aLength, "GetContext() returned wrong prefix length");
+        VerifyOrQuit(context.mCompressFlag == aCompress, "GetContext() returned wrong compress flag");
+        VerifyOrQuit(address.MatchesPrefix(context.mPrefix), "GetContext() returned non-matching prefix");
+
+        VerifyOrQuit(aLeader.GetContext(aContextId, context) == kErrorNone, "GetContext(id) failed");
+        VerifyOrQuit(context.mPrefix.GetLength() == aLength, "GetContext(id) returned wrong prefix length");
+    }
+}
+
+void VerifyRoute(Leader &aLeader, const char *aDestination, uint16_t aRloc16, uint8_t aMatchLength)
+{
+    Ip6::Address source;
+    Ip6::Address destination;
+    uint16_t     rloc16;
+    uint8_t      matchLength;
+
+    SuccessOrQuit(source.FromString("fd00:1::1"));
+    SuccessOrQuit(destination.FromString(aDestination));
+    SuccessOrQuit(aLeader.RouteLookup(source, destination, &matchLength, &rloc16));
+    VerifyOrQuit(rloc16 == aRloc16, "RouteLookup() returned wrong rloc16");
+    VerifyOrQuit(matchLength == aMatchLength, "RouteLookup() returned wrong prefix match length");
+}
+
+void TestNetworkDataLookup(void)
+{
+    // Prefix TLVs:
+    //  - fd00:1::/64, context 1 (compress), on-mesh default route BR 0x2800
+    //  - fd00:1::1:0:0:0/80, context 2 (no compress)
+    //  - ::/0, has route 0x4c00 (medium) and 0x6c00 (low)
+    //  - 2001:db8::/32, has route 0x5000 (high)
+
+    const uint8_t kNetworkData[] = {
+        0x03, 0x14, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x11, 0x40, 0x05, 0x04,
+        0x28, 0x00, 0x03, 0x00, 0x03, 0x10, 0x00, 0x50, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x07, 0x02, 0x02, 0x50, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x06, 0x4c, 0x00, 0x00, 0x6c, 0x00, 0xc0, 0x03, 0x0b,
+        0x00, 0x20, 0x20, 0x01, 0x0d, 0xb8, 0x01, 0x03, 0x50, 0x00, 0x40,
+    };
+
+    // A single Prefix TLV fd00:2::/64, context 1 (compress), preferred-only Border Router 0x2800.
+    const uint8_t kUpdatedNetworkData[] = {
+        0x03, 0x14, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x02, 0x11, 0x40, 0x05, 0x04, 0x28, 0x00, 0x20, 0x00,
+    };
+
+    Instance *        instance;
+    TestLookupLeader *leader;
+    Ip6::Address      address;
+    Lowpan::Context   context;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataLookup()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    leader = &reinterpret_cast<TestLookupLeader &>(instance->Get<Leader>());
+    leader->Populate(kNetworkData, sizeof(kNetworkData));
+
+    VerifyContext(*leader, "fd00:1::1234", kErrorNone, 1, 64, true);
+    VerifyContext(*leader, "fd00:1::1:0:0:1", kErrorNone, 2, 80, false);
+    VerifyContext(*leader, "2001:db8::1", kErrorNotFound, 0, 0, false);
+    VerifyOrQuit(leader->GetContext(3, context) == kErrorNotFound);
+
+    SuccessOrQuit(address.FromString("fd00:1::1:0:0:1"));
+    VerifyOrQuit(leader->IsOnMesh(address));
+    SuccessOrQuit(address.FromString("2001:db8::1"));
+    VerifyOrQuit(!leader->IsOnMesh(address));
+
+    VerifyRoute(*leader, "2001:db8::1", 0x5000, 32);
+    VerifyRoute(*leader, "2002::1", 0x4c00, 0);
+
+    // Lookups must reflect changed Network Data.
+
+    leader->Populate(kUpdatedNetworkData, sizeof(kUpdatedNetworkData));
+
+    VerifyContext(*leader, "fd00:1::1234", kErrorNotFound, 0, 0, false);
+    VerifyContext(*leader, "fd00:2::1234", kErrorNone, 1, 64, true);
+    VerifyOrQuit(leader->GetContext(2, context) == kErrorNotFound);
+
+    SuccessOrQuit(address.FromString("fd00:2::1"));
+    VerifyOrQuit(!leader->IsOnMesh(address));
+    VerifyOrQuit(leader->RouteLookup(address, address, nullptr, nullptr) == kErrorNoRoute);
+
+    testFreeInstance(instance);
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkNetworkDataLookup(void)
+{
+    static constexpr uint8_t  kNumPrefixes = 8;
+    static constexpr uint32_t kNumRounds   = 20000;
+
+    uint8_t           tlvs[NetworkData::kMaxSize];
+    uint8_t           length = 0;
+    Instance *        instance;
+    TestLookupLeader *leader;
+    Ip6::Address      address;
+    Ip6::Address      destination;
+    Lowpan::Context   context;
+    uint64_t          startTime;
+    uint64_t          contextTime;
+    uint64_t          routeTime;
+
+    printf("BenchmarkNetworkDataLookup(%u) (%s) ", kNumPrefixes,
+           OPENTHREAD_CONFIG_TMF_NETDATA_LOOKUP_INDEX_ENABLE ? "indexed" : "tlvs");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    // Each Prefix TLV fd00:<i>::/64 has a context, an on-mesh default
+    // route Border Router entry and a Has Route entry.
+
+    for (uint8_t i = 0; i < kNumPrefixes; i++)
+    {
+        const uint8_t kPrefixTlv[] = {
+            0x03, 0x19, 0x00, 0x40, 0xfd, 0x00, 0x00, static_cast<uint8_t>(i + 1), 0x00, 0x00, 0x00, 0x00, 0x07,
+            0x02, static_cast<uint8_t>(0x10 | (i + 1)), 0x40, 0x05, 0x04, static_cast<uint8_t>(i << 2), 0x00,
+            0x03, 0x00, 0x01, 0x03, static_cast<uint8_t>(i << 2), 0x00, 0x00,
+        };
+
+        VerifyOrQuit(length + sizeof(kPrefixTlv) <= sizeof(tlvs));
+        memcpy(&tlvs[length], kPrefixTlv, sizeof(kPrefixTlv));
+        length += sizeof(kPrefixTlv);
+    }
+
+    leader = &reinterpret_cast<TestLookupLeader &>(instance->Get<Leader>());
+    leader->Populate(tlvs, length);
+
+    SuccessOrQuit(address.FromString("fd00:8::1"));
+    SuccessOrQuit(destination.FromString("fd00:8::2"));
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        SuccessOrQuit(leader->GetContext(address, context));
+        SuccessOrQuit(leader->GetContext(kNumPrefixes, context));
+    }
+
+    contextTime = GetMonotonicTimeUsec() - startTime;
+    startTime   = GetMonotonicTimeUsec();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        VerifyOrQuit(leader->IsOnMesh(address));
+        SuccessOrQuit(leader->RouteLookup(address, destination, nullptr, nullptr));
+    }
+
+    routeTime = GetMonotonicTimeUsec() - startTime;
+
+    printf("%llu ns per context lookup, %llu ns per on-mesh/route lookup -- PASS\n",
+           static_cast<unsigned long long>(contextTime * 1000 / (kNumRounds * 2)),
+           static_cast<unsigned long long>(routeTime * 1000 / (kNumRounds * 2)));
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -466,6 +651,8 @@ int main(void)
     ot::NetworkData::TestNetworkDataFindNextService();
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
+    ot::NetworkData::TestNetworkDataLookup();
+    ot::NetworkData::BenchmarkNetworkDataLookup();
 
     printf("\nAll tests passed\n");
     return 0;
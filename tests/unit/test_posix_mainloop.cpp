@@ -0,0 +1,246 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "test_util.hpp"
+
+#include "common/code_utils.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+static constexpr int      kNumIdleFds      = 1000;
+static constexpr uint32_t kNumIterations   = 20000;
+static constexpr uint32_t kPollTimeoutUsec = 2000;
+
+static int sIdleFds[kNumIdleFds];
+static int sNumIdleFds = 0;
+
+void OpenIdleFds(void)
+{
+    struct rlimit limit;
+
+    // Make room for the idle file descriptors, they still need to fit in an `fd_set`.
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < FD_SETSIZE && limit.rlim_max >= FD_SETSIZE)
+    {
+        limit.rlim_cur = FD_SETSIZE;
+        IgnoreReturnValue(setrlimit(RLIMIT_NOFILE, &limit));
+    }
+
+    for (sNumIdleFds = 0; sNumIdleFds < kNumIdleFds; sNumIdleFds++)
+    {
+        int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        if (fd < 0 || fd >= FD_SETSIZE - 8)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+
+            break;
+        }
+
+        sIdleFds[sNumIdleFds] = fd;
+    }
+
+    VerifyOrQuit(sNumIdleFds > 0);
+}
+
+void CloseIdleFds(void)
+{
+    for (int i = 0; i < sNumIdleFds; i++)
+    {
+        Mainloop::Manager::Get().UnregisterFd(sIdleFds[i]);
+        close(sIdleFds[i]);
+    }
+
+    sNumIdleFds = 0;
+}
+
+void PrepareContext(otSysMainloopContext &aContext, uint32_t aTimeoutUsec)
+{
+    FD_ZERO(&aContext.mReadFdSet);
+    FD_ZERO(&aContext.mWriteFdSet);
+    FD_ZERO(&aContext.mErrorFdSet);
+    aContext.mMaxFd = -1;
+
+    for (int i = 0; i < sNumIdleFds; i++)
+    {
+        FD_SET(sIdleFds[i], &aContext.mReadFdSet);
+
+        if (sIdleFds[i] > aContext.mMaxFd)
+        {
+            aContext.mMaxFd = sIdleFds[i];
+        }
+    }
+
+    aContext.mTimeout.tv_sec  = static_cast<time_t>(aTimeoutUsec / 1000000);
+    aContext.mTimeout.tv_usec = static_cast<suseconds_t>(aTimeoutUsec % 1000000);
+}
+
+int PollWithSelect(otSysMainloopContext &aContext)
+{
+    return select(aContext.mMaxFd + 1, &aContext.mReadFdSet, &aContext.mWriteFdSet, &aContext.mErrorFdSet,
+                  &aContext.mTimeout);
+}
+
+int PollWithNothing(otSysMainloopContext &aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    return 0;
+}
+
+int PollWithEpoll(otSysMainloopContext &aContext)
+{
+    return Mainloop::Manager::Get().Poll(aContext);
+}
+
+void SignalFd(int aFd)
+{
+    uint64_t value = 1;
+
+    VerifyOrQuit(write(aFd, &value, sizeof(value)) == sizeof(value));
+}
+
+void ClearFd(int aFd)
+{
+    uint64_t value;
+
+    VerifyOrQuit(read(aFd, &value, sizeof(value)) == sizeof(value));
+}
+
+void TestPollEvents(int (*aPoll)(otSysMainloopContext &), const char *aName)
+{
+    otSysMainloopContext context;
+    int                  readyFd = sIdleFds[sNumIdleFds / 2];
+    uint64_t             start;
+    uint64_t             elapsed;
+
+    printf("TestPollEvents(%s)\n", aName);
+
+    // No fd is ready, the poll must time out.
+    PrepareContext(context, kPollTimeoutUsec);
+    start   = GetMonotonicTimeUsec();
+    VerifyOrQuit(aPoll(context) == 0);
+    elapsed = GetMonotonicTimeUsec() - start;
+    VerifyOrQuit(elapsed >= kPollTimeoutUsec, "returned before the timeout expired");
+
+    for (int i = 0; i < sNumIdleFds; i++)
+    {
+        VerifyOrQuit(!FD_ISSET(sIdleFds[i], &context.mReadFdSet));
+    }
+
+    // A single fd becomes ready, only it must be reported.
+    SignalFd(readyFd);
+    PrepareContext(context, kPollTimeoutUsec);
+    VerifyOrQuit(aPoll(context) == 1);
+
+    for (int i = 0; i < sNumIdleFds; i++)
+    {
+        VerifyOrQuit(FD_ISSET(sIdleFds[i], &context.mReadFdSet) == (sIdleFds[i] == readyFd));
+    }
+
+    ClearFd(readyFd);
+
+    // The fd is still registered but no longer requested, it must not be reported.
+    SignalFd(readyFd);
+    PrepareContext(context, 0);
+    FD_CLR(readyFd, &context.mReadFdSet);
+    VerifyOrQuit(aPoll(context) == 0);
+    VerifyOrQuit(!FD_ISSET(readyFd, &context.mReadFdSet));
+    ClearFd(readyFd);
+}
+
+double BenchmarkPoll(int (*aPoll)(otSysMainloopContext &))
+{
+    otSysMainloopContext context;
+    uint64_t             start;
+
+    start = GetMonotonicTimeUsec();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        PrepareContext(context, 0);
+        VerifyOrQuit(aPoll(context) == 0);
+    }
+
+    return static_cast<double>(GetMonotonicTimeUsec() - start) / kNumIterations;
+}
+
+void TestMainloopBenchmark(void)
+{
+    double setupUsec;
+    double selectUsec;
+    double epollTransientUsec;
+    double epollRegisteredUsec;
+
+    OpenIdleFds();
+
+    TestPollEvents(PollWithSelect, "select");
+    TestPollEvents(PollWithEpoll, "epoll, unregistered");
+
+    setupUsec          = BenchmarkPoll(PollWithNothing);
+    selectUsec         = BenchmarkPoll(PollWithSelect);
+    epollTransientUsec = BenchmarkPoll(PollWithEpoll);
+
+    for (int i = 0; i < sNumIdleFds; i++)
+    {
+        SuccessOrQuit(Mainloop::Manager::Get().RegisterFd(sIdleFds[i]));
+    }
+
+    TestPollEvents(PollWithEpoll, "epoll, registered");
+
+    epollRegisteredUsec = BenchmarkPoll(PollWithEpoll);
+
+    printf("Mainloop poll with %d idle fds (%u iterations):\n", sNumIdleFds, kNumIterations);
+    printf("  context setup only   : %8.3f usec/iteration\n", setupUsec);
+    printf("  select               : %8.3f usec/iteration\n", selectUsec);
+    printf("  epoll (unregistered) : %8.3f usec/iteration\n", epollTransientUsec);
+    printf("  epoll (registered)   : %8.3f usec/iteration\n", epollRegisteredUsec);
+
+    CloseIdleFds();
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    ot::Posix::TestMainloopBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,387 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file benchmarks restoring the RCP properties after an RCP reset against a simulated RCP.
+ */
+
+// The RCP restoration is disabled by default, it is enabled here to exercise `RestoreProperties()`. The source match
+// tables are sized for a router with many sleepy children, this only changes the `RadioSpinel` instance of this test.
+#undef OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT
+#define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 1
+#define OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES 512
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/platform/time.h>
+
+#include "test_util.hpp"
+
+#include "common/code_utils.hpp"
+#include "lib/spinel/radio_spinel.hpp"
+
+static uint64_t sNow = 0; ///< Virtual time in microseconds, advanced by the simulated RCP.
+
+extern "C" uint64_t otPlatTimeGet(void)
+{
+    return sNow;
+}
+
+namespace ot {
+namespace Spinel {
+
+/**
+ * This class simulates an RCP connected over a UART, it implements the `InterfaceType` used by `RadioSpinel`.
+ *
+ * The UART is modeled in both directions as a serial link at `kBaudRate`, and the RCP processes one request at a time
+ * taking `kProcessingTime`. Waiting for a frame advances the virtual time to the time the frame is fully received.
+ *
+ */
+class SimulatedRcp
+{
+public:
+    enum
+    {
+        kBaudRate        = 115200,
+        kBitsPerByte     = 10, ///< Start and stop bits included.
+        kHdlcOverhead    = 4,  ///< Flag and FCS octets.
+        kProcessingTime  = 50, ///< Time for the RCP to handle a request (in usec).
+        kMaxQueuedFrames = 32,
+    };
+
+    SimulatedRcp(SpinelInterface::ReceiveFrameCallback aCallback,
+                 void *                                aCallbackContext,
+                 SpinelInterface::RxFrameBuffer &      aFrameBuffer)
+        : mReceiveFrameCallback(aCallback)
+        , mReceiveFrameContext(aCallbackContext)
+        , mRxFrameBuffer(aFrameBuffer)
+        , mQueueHead(0)
+        , mQueueLength(0)
+        , mHostTxEnd(0)
+        , mRcpTxEnd(0)
+        , mRcpBusyEnd(0)
+    {
+        sRcp = this;
+        Reset();
+    }
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength);
+    otError WaitForFrame(uint64_t aTimeoutUs);
+
+    void     Deinit(void) {}
+    void     OnRcpReset(void) {}
+    otError  ResetConnection(void) { return OT_ERROR_NONE; }
+    uint32_t GetBusSpeed(void) const { return kBaudRate; }
+
+    void InjectReset(void)
+    {
+        Reset();
+        SendLastStatus(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_STATUS_RESET_POWER_ON, sNow);
+    }
+
+    uint16_t GetShortEntryCount(void) const { return mShortEntryCount; }
+    uint16_t GetExtEntryCount(void) const { return mExtEntryCount; }
+    uint32_t GetRequestCount(void) const { return mRequestCount; }
+
+    static SimulatedRcp &Get(void) { return *sRcp; }
+
+private:
+    struct Frame
+    {
+        uint64_t mDeliveryTime;
+        uint16_t mLength;
+        uint8_t  mBuffer[SpinelInterface::kMaxFrameSize];
+    };
+
+    static uint64_t GetFrameTime(uint16_t aLength)
+    {
+        return static_cast<uint64_t>(aLength + kHdlcOverhead) * kBitsPerByte * 1000000 / kBaudRate;
+    }
+
+    void Reset(void)
+    {
+        mShortEntryCount = 0;
+        mExtEntryCount   = 0;
+        mRequestCount    = 0;
+    }
+
+    void Enqueue(const uint8_t *aFrame, uint16_t aLength, uint64_t aReadyTime)
+    {
+        Frame &frame = mQueue[(mQueueHead + mQueueLength) % kMaxQueuedFrames];
+
+        VerifyOrQuit(mQueueLength < kMaxQueuedFrames, "Too many queued frames");
+        mQueueLength++;
+
+        mRcpTxEnd           = OT_MAX(aReadyTime, mRcpTxEnd) + GetFrameTime(aLength);
+        frame.mDeliveryTime = mRcpTxEnd;
+        frame.mLength       = aLength;
+        memcpy(frame.mBuffer, aFrame, aLength);
+    }
+
+    void SendLastStatus(uint8_t aHeader, spinel_status_t aStatus, uint64_t aReadyTime)
+    {
+        uint8_t        buffer[16];
+        spinel_ssize_t packed = spinel_datatype_pack(buffer, sizeof(buffer), "Ciii", aHeader, SPINEL_CMD_PROP_VALUE_IS,
+                                                     SPINEL_PROP_LAST_STATUS, aStatus);
+
+        VerifyOrQuit(packed > 0);
+        Enqueue(buffer, static_cast<uint16_t>(packed), aReadyTime);
+    }
+
+    static SimulatedRcp *sRcp;
+
+    SpinelInterface::ReceiveFrameCallback mReceiveFrameCallback;
+    void *                                mReceiveFrameContext;
+    SpinelInterface::RxFrameBuffer &      mRxFrameBuffer;
+
+    Frame    mQueue[kMaxQueuedFrames];
+    uint8_t  mQueueHead;
+    uint8_t  mQueueLength;
+    uint64_t mHostTxEnd;  ///< Time the host finishes sending its last frame.
+    uint64_t mRcpTxEnd;   ///< Time the RCP finishes sending its last frame.
+    uint64_t mRcpBusyEnd; ///< Time the RCP finishes handling its last request.
+    uint16_t mShortEntryCount;
+    uint16_t mExtEntryCount;
+    uint32_t mRequestCount;
+};
+
+SimulatedRcp *SimulatedRcp::sRcp = nullptr;
+
+otError SimulatedRcp::SendFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    uint8_t           header;
+    unsigned int      command;
+    spinel_prop_key_t key;
+    const uint8_t *   value;
+    spinel_size_t     valueLength;
+    uint8_t           response[SpinelInterface::kMaxFrameSize];
+    spinel_ssize_t    packed;
+    uint64_t          readyTime;
+
+    VerifyOrQuit(spinel_datatype_unpack(aFrame, aLength, "Ci", &header, &command) > 0);
+
+    mHostTxEnd  = OT_MAX(sNow, mHostTxEnd) + GetFrameTime(aLength);
+    mRcpBusyEnd = OT_MAX(mHostTxEnd, mRcpBusyEnd) + kProcessingTime;
+    readyTime   = mRcpBusyEnd;
+
+    if (command == SPINEL_CMD_RESET)
+    {
+        InjectReset();
+        ExitNow();
+    }
+
+    VerifyOrQuit(spinel_datatype_unpack(aFrame, aLength, "CiiD", &header, &command, &key, &value, &valueLength) > 0);
+    mRequestCount++;
+
+    switch (command)
+    {
+    case SPINEL_CMD_PROP_VALUE_GET:
+        switch (key)
+        {
+        case SPINEL_PROP_PROTOCOL_VERSION:
+            packed = spinel_datatype_pack(response, sizeof(response), "Ciiii", header, SPINEL_CMD_PROP_VALUE_IS, key,
+                                          SPINEL_PROTOCOL_VERSION_THREAD_MAJOR, SPINEL_PROTOCOL_VERSION_THREAD_MINOR);
+            break;
+
+        case SPINEL_PROP_NCP_VERSION:
+            packed = spinel_datatype_pack(response, sizeof(response), "CiiU", header, SPINEL_CMD_PROP_VALUE_IS, key,
+                                          "SIMULATED-RCP");
+            break;
+
+        case SPINEL_PROP_HWADDR:
+        {
+            const uint8_t eui64[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+            packed = spinel_datatype_pack(response, sizeof(response), "CiiE", header, SPINEL_CMD_PROP_VALUE_IS, key,
+                                          eui64);
+            break;
+        }
+
+        case SPINEL_PROP_CAPS:
+            packed = spinel_datatype_pack(response, sizeof(response), "Ciiii", header, SPINEL_CMD_PROP_VALUE_IS, key,
+                                          SPINEL_CAP_CONFIG_RADIO, SPINEL_CAP_MAC_RAW);
+            break;
+
+        case SPINEL_PROP_PHY_RX_SENSITIVITY:
+            packed = spinel_datatype_pack(response, sizeof(response), "Ciic", header, SPINEL_CMD_PROP_VALUE_IS, key,
+                                          -100);
+            break;
+
+        case SPINEL_PROP_RCP_TIMESTAMP:
+            packed = spinel_datatype_pack(response, sizeof(response), "CiiX", header, SPINEL_CMD_PROP_VALUE_IS, key,
+                                          sNow);
+            break;
+
+        default:
+            SendLastStatus(header, SPINEL_STATUS_PROP_NOT_FOUND, readyTime);
+            ExitNow();
+        }
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_SET:
+        // Like older RCPs, the simulated RCP does not support the max transmit power property.
+        if (key == SPINEL_PROP_PHY_CHAN_MAX_POWER)
+        {
+            SendLastStatus(header, SPINEL_STATUS_PROP_NOT_FOUND, readyTime);
+            ExitNow();
+        }
+
+        packed = spinel_datatype_pack(response, sizeof(response), "CiiD", header, SPINEL_CMD_PROP_VALUE_IS, key, value,
+                                      valueLength);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_INSERT:
+        if (key == SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES)
+        {
+            mShortEntryCount++;
+        }
+        else if (key == SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES)
+        {
+            mExtEntryCount++;
+        }
+
+        packed = spinel_datatype_pack(response, sizeof(response), "CiiD", header, SPINEL_CMD_PROP_VALUE_INSERTED, key,
+                                      value, valueLength);
+        break;
+
+    default:
+        SendLastStatus(header, SPINEL_STATUS_INVALID_COMMAND, readyTime);
+        ExitNow();
+    }
+
+    VerifyOrQuit(packed > 0);
+    Enqueue(response, static_cast<uint16_t>(packed), readyTime);
+
+exit:
+    return OT_ERROR_NONE;
+}
+
+otError SimulatedRcp::WaitForFrame(uint64_t aTimeoutUs)
+{
+    otError error = OT_ERROR_NONE;
+    Frame * frame = &mQueue[mQueueHead];
+
+    if (mQueueLength == 0 || frame->mDeliveryTime > sNow + aTimeoutUs)
+    {
+        sNow += aTimeoutUs;
+        ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+    }
+
+    sNow       = OT_MAX(sNow, frame->mDeliveryTime);
+    mQueueHead = (mQueueHead + 1) % kMaxQueuedFrames;
+    mQueueLength--;
+
+    SuccessOrQuit(mRxFrameBuffer.WriteBytes(frame->mBuffer, frame->mLength));
+    mReceiveFrameCallback(mReceiveFrameContext);
+
+exit:
+    return error;
+}
+
+struct ProcessContext
+{
+};
+
+static RadioSpinel<SimulatedRcp, ProcessContext> sRadioSpinel;
+
+void TestRestorePropertiesBenchmark(void)
+{
+    static constexpr uint16_t kNumShortEntries = 400;
+    static constexpr uint16_t kNumExtEntries   = 100;
+
+    uint64_t startTime;
+    uint64_t programTime;
+    uint64_t restoreTime;
+    uint32_t numRequests;
+
+    sRadioSpinel.Init(/* aResetRadio */ true, /* aRestoreDatasetFromNcp */ false,
+                      /* aSkipRcpCompatibilityCheck */ true);
+    SuccessOrQuit(sRadioSpinel.Enable(nullptr));
+
+    for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
+    {
+        VerifyOrQuit(sRadioSpinel.SetChannelMaxTransmitPower(channel, 10) == OT_ERROR_NOT_FOUND);
+    }
+
+    // Program the source match tables one request at a time, as the core does when children attach.
+    startTime = sNow;
+
+    for (uint16_t i = 0; i < kNumShortEntries; i++)
+    {
+        SuccessOrQuit(sRadioSpinel.AddSrcMatchShortEntry(0x0401 + i));
+    }
+
+    for (uint16_t i = 0; i < kNumExtEntries; i++)
+    {
+        otExtAddress extAddress;
+
+        memset(extAddress.m8, 0xa5, sizeof(extAddress));
+        extAddress.m8[6] = static_cast<uint8_t>(i >> 8);
+        extAddress.m8[7] = static_cast<uint8_t>(i & 0xff);
+        SuccessOrQuit(sRadioSpinel.AddSrcMatchExtEntry(extAddress));
+    }
+
+    programTime = sNow - startTime;
+
+    VerifyOrQuit(SimulatedRcp::Get().GetShortEntryCount() == kNumShortEntries);
+    VerifyOrQuit(SimulatedRcp::Get().GetExtEntryCount() == kNumExtEntries);
+
+    // Reset the RCP, the next request detects it and restores all the properties before being retried.
+    SimulatedRcp::Get().InjectReset();
+
+    startTime = sNow;
+    SuccessOrQuit(sRadioSpinel.SetPanId(0xface));
+    restoreTime = sNow - startTime;
+    numRequests = SimulatedRcp::Get().GetRequestCount();
+
+    VerifyOrQuit(SimulatedRcp::Get().GetShortEntryCount() == kNumShortEntries);
+    VerifyOrQuit(SimulatedRcp::Get().GetExtEntryCount() == kNumExtEntries);
+
+    printf("Restore %u source match entries over a %u baud UART (%u pipelined requests):\n",
+           kNumShortEntries + kNumExtEntries, SimulatedRcp::kBaudRate, OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS);
+    printf("  programming entries one at a time : %8.1f ms\n", programTime / 1000.0);
+    printf("  restoring after RCP reset         : %8.1f ms (%u requests)\n", restoreTime / 1000.0, numRequests);
+
+#if OPENTHREAD_SPINEL_CONFIG_MAX_PIPELINED_REQUESTS > 1
+    VerifyOrQuit(restoreTime < programTime, "Pipelined restore is not faster than one request at a time");
+#endif
+
+    sRadioSpinel.Deinit();
+}
+
+} // namespace Spinel
+} // namespace ot
+
+int main(void)
+{
+    ot::Spinel::TestRestorePropertiesBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,561 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/config.h>
+#include <openthread/dns_client.h>
+#include <openthread/ip6.h>
+#include <openthread/srp_client.h>
+#include <openthread/srp_server.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/radio.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/instance.hpp"
+#include "common/settings.hpp"
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE && \
+    OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE && OPENTHREAD_FTD
+
+// The SRP server is exercised through its public API: a single
+// device becomes leader and registers hosts with its own SRP client,
+// then resolves them through its own DNS client and DNS-SD server.
+
+namespace ot {
+
+static constexpr uint16_t kMaxNumHosts       = 320;
+static constexpr char     kService[]         = "_test._udp";
+static constexpr char     kServiceFullName[] = "_test._udp.default.service.arpa.";
+
+static Instance *sInstance;
+
+// Fake time and radio
+
+static uint32_t     sNow;
+static uint32_t     sAlarmTime;
+static bool         sAlarmOn;
+static uint32_t     sMicroAlarmTime;
+static bool         sMicroAlarmOn;
+static otRadioFrame sRadioTxFrame;
+static uint8_t      sRadioTxFramePsdu[OT_RADIO_FRAME_MAX_SIZE];
+static bool         sRadioTxOngoing;
+
+extern "C" {
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return sNow;
+}
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+void otPlatAlarmMilliStop(otInstance *)
+{
+    sAlarmOn = false;
+}
+
+uint32_t otPlatAlarmMicroGetNow(void)
+{
+    return sNow * 1000;
+}
+
+void otPlatAlarmMicroStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sMicroAlarmOn   = true;
+    sMicroAlarmTime = aT0 + aDt;
+}
+
+void otPlatAlarmMicroStop(otInstance *)
+{
+    sMicroAlarmOn = false;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *)
+{
+    return &sRadioTxFrame;
+}
+
+otError otPlatRadioTransmit(otInstance *, otRadioFrame *)
+{
+    sRadioTxOngoing = true;
+
+    return OT_ERROR_NONE;
+}
+
+} // extern "C"
+
+static void ProcessRadioTxAndTasklets(void)
+{
+    do
+    {
+        if (sRadioTxOngoing)
+        {
+            sRadioTxOngoing = false;
+            otPlatRadioTxStarted(sInstance, &sRadioTxFrame);
+            otPlatRadioTxDone(sInstance, &sRadioTxFrame, nullptr, OT_ERROR_NONE);
+        }
+
+        otTaskletsProcess(sInstance);
+    } while (otTaskletsArePending(sInstance) || sRadioTxOngoing);
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t endTime = sNow + aDuration;
+
+    while (true)
+    {
+        uint32_t nextTime = endTime;
+
+        ProcessRadioTxAndTasklets();
+
+        if (sAlarmOn && (static_cast<int32_t>(sAlarmTime - nextTime) < 0))
+        {
+            nextTime = sAlarmTime;
+        }
+
+        if (sMicroAlarmOn && (static_cast<int32_t>((sMicroAlarmTime + 999) / 1000 - nextTime) < 0))
+        {
+            nextTime = (sMicroAlarmTime + 999) / 1000;
+        }
+
+        if (static_cast<int32_t>(nextTime - sNow) > 0)
+        {
+            sNow = nextTime;
+        }
+
+        if (sAlarmOn && (static_cast<int32_t>(sAlarmTime - sNow) <= 0))
+        {
+            sAlarmOn = false;
+            otPlatAlarmMilliFired(sInstance);
+        }
+        else if (sMicroAlarmOn && (static_cast<int32_t>(sMicroAlarmTime - sNow * 1000) <= 0))
+        {
+            sMicroAlarmOn = false;
+            otPlatAlarmMicroFired(sInstance);
+        }
+        else if (sNow == endTime)
+        {
+            break;
+        }
+    }
+
+    ProcessRadioTxAndTasklets();
+}
+
+// SRP client
+
+static char               sHostNames[kMaxNumHosts][Dns::Name::kMaxNameSize];
+static char               sInstanceNames[kMaxNumHosts][Dns::Name::kMaxLabelSize];
+static otSrpClientService sServices[kMaxNumHosts];
+static bool               sUpdateDone;
+static Error              sUpdateError;
+
+static void HandleSrpClientUpdate(otError                    aError,
+                                  const otSrpClientHostInfo *aHostInfo,
+                                  const otSrpClientService * aServices,
+                                  const otSrpClientService * aRemovedServices,
+                                  void *                     aContext)
+{
+    OT_UNUSED_VARIABLE(aHostInfo);
+    OT_UNUSED_VARIABLE(aServices);
+    OT_UNUSED_VARIABLE(aRemovedServices);
+    OT_UNUSED_VARIABLE(aContext);
+
+    sUpdateDone  = true;
+    sUpdateError = aError;
+}
+
+static void PrepareHost(uint16_t aIndex, uint16_t aInstanceIndex)
+{
+    otSrpClientService &service = sServices[aIndex];
+
+    snprintf(sHostNames[aIndex], sizeof(sHostNames[aIndex]), "host%u", aIndex);
+    snprintf(sInstanceNames[aIndex], sizeof(sInstanceNames[aIndex]), "ins%u", aInstanceIndex);
+
+    memset(&service, 0, sizeof(service));
+    service.mName         = kService;
+    service.mInstanceName = sInstanceNames[aIndex];
+    service.mPort         = 1000 + aIndex;
+}
+
+// Registers a host with one service and waits for the update to
+// complete. The SRP client then forgets the host, so that the next
+// host can be registered. The server keeps it until its lease expires.
+static Error RegisterHost(uint16_t aIndex, uint16_t aInstanceIndex)
+{
+    PrepareHost(aIndex, aInstanceIndex);
+
+    SuccessOrQuit(otSrpClientSetHostName(sInstance, sHostNames[aIndex]));
+    SuccessOrQuit(otSrpClientSetHostAddresses(sInstance, otThreadGetMeshLocalEid(sInstance), 1));
+    SuccessOrQuit(otSrpClientAddService(sInstance, &sServices[aIndex]));
+
+    sUpdateDone = false;
+
+    for (uint16_t i = 0; (i < 200) && !sUpdateDone; i++)
+    {
+        AdvanceTime(10);
+    }
+
+    VerifyOrQuit(sUpdateDone, "SRP update did not complete");
+
+    otSrpClientClearHostAndServices(sInstance);
+
+    return sUpdateError;
+}
+
+static Error RegisterHost(uint16_t aIndex)
+{
+    return RegisterHost(aIndex, aIndex);
+}
+
+static uint16_t CountServerHosts(void)
+{
+    uint16_t               count = 0;
+    const otSrpServerHost *host  = nullptr;
+
+    while ((host = otSrpServerGetNextHost(sInstance, host)) != nullptr)
+    {
+        if (!otSrpServerHostIsDeleted(host))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+static void ForgetSrpClientKey(void)
+{
+    // The SRP client generates a new key for its next update, which
+    // then looks like it comes from another device.
+
+    SuccessOrQuit(sInstance->Get<Settings>().Delete<Settings::SrpEcdsaKey>());
+}
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE && \
+    OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+
+// DNS client
+
+struct DnsResult
+{
+    bool     mDone;
+    Error    mError;
+    uint16_t mNumInstances;
+    char     mHostName[Dns::Name::kMaxNameSize];
+};
+
+static DnsResult sDnsResult;
+
+static void HandleBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse, void *aContext)
+{
+    char label[Dns::Name::kMaxLabelSize];
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    sDnsResult.mDone         = true;
+    sDnsResult.mError        = aError;
+    sDnsResult.mNumInstances = 0;
+
+    while (aError == OT_ERROR_NONE)
+    {
+        aError = otDnsBrowseResponseGetServiceInstance(aResponse, sDnsResult.mNumInstances, label, sizeof(label));
+
+        if (aError == OT_ERROR_NONE)
+        {
+            sDnsResult.mNumInstances++;
+        }
+    }
+}
+
+static void HandleServiceResponse(otError aError, const otDnsServiceResponse *aResponse, void *aContext)
+{
+    otDnsServiceInfo info;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    sDnsResult.mDone        = true;
+    sDnsResult.mError       = aError;
+    sDnsResult.mHostName[0] = '\0';
+
+    if (aError == OT_ERROR_NONE)
+    {
+        memset(&info, 0, sizeof(info));
+        info.mHostNameBuffer     = sDnsResult.mHostName;
+        info.mHostNameBufferSize = sizeof(sDnsResult.mHostName);
+        SuccessOrQuit(otDnsServiceResponseGetServiceInfo(aResponse, &info));
+    }
+}
+
+static void PrepareDnsQueryConfig(otDnsQueryConfig &aConfig)
+{
+    memset(&aConfig, 0, sizeof(aConfig));
+    aConfig.mServerSockAddr.mAddress = *otThreadGetMeshLocalEid(sInstance);
+    aConfig.mServerSockAddr.mPort    = 53;
+}
+
+static uint16_t Browse(void)
+{
+    otDnsQueryConfig config;
+
+    PrepareDnsQueryConfig(config);
+    sDnsResult.mDone = false;
+    SuccessOrQuit(otDnsClientBrowse(sInstance, kServiceFullName, HandleBrowseResponse, nullptr, &config));
+    AdvanceTime(100);
+    VerifyOrQuit(sDnsResult.mDone, "DNS browse did not complete");
+    SuccessOrQuit(sDnsResult.mError);
+
+    return sDnsResult.mNumInstances;
+}
+
+static Error ResolveService(uint16_t aInstanceIndex)
+{
+    otDnsQueryConfig config;
+    char             label[Dns::Name::kMaxLabelSize];
+
+    PrepareDnsQueryConfig(config);
+    snprintf(label, sizeof(label), "ins%u", aInstanceIndex);
+    sDnsResult.mDone = false;
+    SuccessOrQuit(
+        otDnsClientResolveService(sInstance, label, kServiceFullName, HandleServiceResponse, nullptr, &config));
+    AdvanceTime(100);
+    VerifyOrQuit(sDnsResult.mDone, "DNS service resolution did not complete");
+
+    return sDnsResult.mError;
+}
+
+static bool ResolvesToHost(uint16_t aInstanceIndex, uint16_t aHostIndex)
+{
+    char hostName[Dns::Name::kMaxNameSize];
+
+    snprintf(hostName, sizeof(hostName), "host%u.default.service.arpa.", aHostIndex);
+
+    return (ResolveService(aInstanceIndex) == kErrorNone) && (strcmp(sDnsResult.mHostName, hostName) == 0);
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && ...
+
+static void InitTest(void)
+{
+    otSrpServerLeaseConfig leaseConfig;
+
+    sNow            = 0;
+    sAlarmOn        = false;
+    sMicroAlarmOn   = false;
+    sRadioTxOngoing = false;
+    memset(&sRadioTxFrame, 0, sizeof(sRadioTxFrame));
+    sRadioTxFrame.mPsdu = sRadioTxFramePsdu;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    // Become leader, then start the SRP server and wait for it to
+    // publish its address in the Network Data.
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadBecomeLeader(sInstance));
+    AdvanceTime(10000);
+    VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+
+    // Allow short leases, so that the tests can let them expire.
+
+    otSrpServerGetLeaseConfig(sInstance, &leaseConfig);
+    leaseConfig.mMinLease    = 10;
+    leaseConfig.mMinKeyLease = 20;
+    SuccessOrQuit(otSrpServerSetLeaseConfig(sInstance, &leaseConfig));
+
+    otSrpServerSetEnabled(sInstance, true);
+    AdvanceTime(30000);
+    VerifyOrQuit(otSrpServerGetState(sInstance) == OT_SRP_SERVER_STATE_RUNNING, "SRP server did not start");
+
+    otSrpClientSetCallback(sInstance, HandleSrpClientUpdate, nullptr);
+    otSrpClientEnableAutoStartMode(sInstance, nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(otSrpClientIsRunning(sInstance), "SRP client did not start");
+}
+
+static void FinalizeTest(void)
+{
+    otSrpClientStop(sInstance);
+    otSrpServerSetEnabled(sInstance, false);
+    SuccessOrQuit(otThreadSetEnabled(sInstance, false));
+    SuccessOrQuit(otIp6SetEnabled(sInstance, false));
+    testFreeInstance(sInstance);
+}
+
+void TestSrpServerNameLookup(void)
+{
+    static constexpr uint16_t kNumHosts       = 8;
+    static constexpr uint16_t kShortLeaseHost = 2;
+
+    printf("TestSrpServerNameLookup");
+
+    InitTest();
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        // One host gets short leases so that it is removed later.
+
+        otSrpClientSetLeaseInterval(sInstance, (i == kShortLeaseHost) ? 10 : 0);
+        otSrpClientSetKeyLeaseInterval(sInstance, (i == kShortLeaseHost) ? 20 : 0);
+
+        SuccessOrQuit(RegisterHost(i), "Registering a new host failed");
+    }
+
+    otSrpClientSetLeaseInterval(sInstance, 0);
+    otSrpClientSetKeyLeaseInterval(sInstance, 0);
+
+    VerifyOrQuit(CountServerHosts() == kNumHosts);
+
+    // An update from the same key is accepted, while the host name or
+    // a service instance name of another key is a conflict.
+
+    SuccessOrQuit(RegisterHost(3), "An update from the same key was rejected");
+
+    ForgetSrpClientKey();
+    VerifyOrQuit(RegisterHost(3) == kErrorDuplicated, "Host name conflict was not detected");
+    VerifyOrQuit(RegisterHost(kNumHosts, 5) == kErrorDuplicated, "Service instance name conflict was not detected");
+    VerifyOrQuit(CountServerHosts() == kNumHosts);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE && \
+    OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+    VerifyOrQuit(Browse() == kNumHosts);
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        VerifyOrQuit(ResolvesToHost(i, i), "Service instance resolved to a wrong host");
+    }
+
+    VerifyOrQuit(ResolveService(kNumHosts) == kErrorNotFound);
+#endif
+
+    // Once its key lease expires, the server removes the host and its
+    // service entirely.
+
+    AdvanceTime(30 * 1000);
+    VerifyOrQuit(CountServerHosts() == kNumHosts - 1);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE && \
+    OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+    VerifyOrQuit(Browse() == kNumHosts - 1);
+    VerifyOrQuit(ResolveService(kShortLeaseHost) == kErrorNotFound, "Removed service is still resolved");
+
+    // Names of a removed host can be used by another key.
+
+    SuccessOrQuit(RegisterHost(kShortLeaseHost), "Name of a removed host could not be registered");
+    VerifyOrQuit(Browse() == kNumHosts);
+    VerifyOrQuit(ResolvesToHost(kShortLeaseHost, kShortLeaseHost));
+#endif
+
+    FinalizeTest();
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkSrpServer(uint16_t aNumHosts)
+{
+    uint64_t updateTime = 0;
+    uint64_t lookupTime = 0;
+
+    printf("BenchmarkSrpServer(%u) (%s) ", aNumHosts,
+           OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_ENABLE ? "indexed" : "linear");
+
+    VerifyOrQuit(aNumHosts <= kMaxNumHosts);
+
+    InitTest();
+
+    // An update validates the host and instance names against all
+    // registered hosts before the host is added. The time also
+    // includes signing and verifying the update.
+
+    for (uint16_t i = 0; i < aNumHosts; i++)
+    {
+        uint64_t startTime = GetMonotonicTimeUsec();
+
+        SuccessOrQuit(RegisterHost(i), "Registering a host failed");
+        updateTime += GetMonotonicTimeUsec() - startTime;
+    }
+
+    VerifyOrQuit(CountServerHosts() == aNumHosts);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE && \
+    OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+    // A service resolution looks up the service instance and its host.
+
+    for (uint16_t i = 0; i < aNumHosts; i++)
+    {
+        uint64_t startTime = GetMonotonicTimeUsec();
+
+        VerifyOrQuit(ResolvesToHost(i, i));
+        lookupTime += GetMonotonicTimeUsec() - startTime;
+    }
+#endif
+
+    printf("%llu us per update, %llu us per service resolution -- PASS\n",
+           static_cast<unsigned long long>(updateTime / aNumHosts),
+           static_cast<unsigned long long>(lookupTime / aNumHosts));
+
+    FinalizeTest();
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestSrpServerNameLookup();
+    ot::BenchmarkSrpServer(8);
+
+    // Several hundred hosts need more than the internal heap can hold
+    // (`-DOT_EXTERNAL_HEAP=ON`).
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    ot::BenchmarkSrpServer(ot::kMaxNumHosts);
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#else
+int main(void)
+{
+    return 0;
+}
+#endif
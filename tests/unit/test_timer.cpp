@@ -27,6 +27,7 @@
  */
 
 #include "test_platform.h"
+#include "test_util.hpp"
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -593,6 +594,215 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * `OrderTimer` sub-classes a timer type and records the order in which timers fire.
+ */
+template <typename TimerType> class OrderTimer : public TimerType
+{
+public:
+    OrderTimer(ot::Instance &aInstance, uint8_t aIndex)
+        : TimerType(aInstance, OrderTimer::HandleTimerFired)
+        , mIndex(aIndex)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer)
+    {
+        VerifyOrQuit(sFiredCount < OT_ARRAY_LENGTH(sFiredOrder), "TestSameFireTime: Too many timers fired.");
+        sFiredOrder[sFiredCount++] = static_cast<OrderTimer &>(aTimer).mIndex;
+    }
+
+    static uint8_t  sFiredOrder[8];
+    static uint32_t sFiredCount;
+
+private:
+    uint8_t mIndex;
+};
+
+template <typename TimerType> uint8_t  OrderTimer<TimerType>::sFiredOrder[8];
+template <typename TimerType> uint32_t OrderTimer<TimerType>::sFiredCount;
+
+/**
+ * Test that timers with the same fire time fire in the order they were started.
+ */
+template <typename TimerType> int TestSameFireTime(void)
+{
+    const uint32_t         kTimeT0                    = 1000;
+    const uint32_t         kTimerInterval             = 100;
+    const uint8_t          kNumTimers                 = 8;
+    const uint8_t          kRestartedIndex            = 2;
+    const uint8_t          kExpectedOrder[kNumTimers] = {0, 1, 3, 4, 5, 6, 7, 2};
+    ot::Instance *         instance                   = testInitInstance();
+    OrderTimer<TimerType> *timers[kNumTimers];
+    TestTimer<TimerType>   earlyTimer(*instance);
+    TestTimer<TimerType>   lateTimer(*instance);
+
+    printf("TestSameFireTime() ");
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    OrderTimer<TimerType>::sFiredCount = 0;
+    sNow                               = kTimeT0;
+
+    for (uint8_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i] = new OrderTimer<TimerType>(*instance, i);
+    }
+
+    // Interleave timers with other fire times and stop/restart some
+    // of them to reshape the scheduler's internal structure.
+
+    lateTimer.Start(kTimerInterval * 2);
+
+    for (OrderTimer<TimerType> *timer : timers)
+    {
+        timer->Start(kTimerInterval);
+        earlyTimer.Start(kTimerInterval / 2);
+    }
+
+    earlyTimer.Stop();
+    timers[kRestartedIndex]->Stop();
+    timers[kRestartedIndex]->Start(kTimerInterval);
+    lateTimer.Stop();
+
+    sNow += kTimerInterval;
+
+    while (sTimerOn && (sNow - sPlatT0 >= sPlatDt))
+    {
+        AlarmFired<TimerType>(instance);
+    }
+
+    VerifyOrQuit(OrderTimer<TimerType>::sFiredCount == kNumTimers, "TestSameFireTime: Fired count failed.");
+    VerifyOrQuit(memcmp(OrderTimer<TimerType>::sFiredOrder, kExpectedOrder, sizeof(kExpectedOrder)) == 0,
+                 "TestSameFireTime: Timers fired out of start order.");
+
+    for (OrderTimer<TimerType> *timer : timers)
+    {
+        delete timer;
+    }
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
+/**
+ * `BenchmarkTimer` sub-classes a timer type and verifies that timers fire in order of their fire time.
+ */
+template <typename TimerType> class BenchmarkTimer : public TimerType
+{
+public:
+    explicit BenchmarkTimer(ot::Instance &aInstance)
+        : TimerType(aInstance, BenchmarkTimer::HandleTimerFired)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer)
+    {
+        VerifyOrQuit(aTimer.GetFireTime() <= ot::Time(sNow), "Benchmark: Timer fired early.");
+        VerifyOrQuit(aTimer.GetFireTime() >= sLastFireTime, "Benchmark: Timer fired out of order.");
+
+        sLastFireTime = aTimer.GetFireTime();
+        sFiredCount++;
+    }
+
+    static ot::Time sLastFireTime;
+    static uint32_t sFiredCount;
+};
+
+template <typename TimerType> ot::Time BenchmarkTimer<TimerType>::sLastFireTime;
+template <typename TimerType> uint32_t BenchmarkTimer<TimerType>::sFiredCount;
+
+/**
+ * Benchmark the timer scheduler with a large number of timers and a random sequence of start/stop/fire operations.
+ *
+ * The time is started close to a 32-bit wrap so that the wrap-around is also exercised. Build with and without
+ * `OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE` to compare the two scheduler implementations.
+ */
+template <typename TimerType> int TestTimerSchedulerBenchmark(void)
+{
+    const uint32_t kNumTimers     = 500;
+    const uint32_t kNumOperations = 10000;
+    const uint32_t kMaxInterval   = 5000;
+    const uint32_t kMaxTimeStep   = 50;
+
+    ot::Instance *             instance = testInitInstance();
+    BenchmarkTimer<TimerType> *timers[kNumTimers];
+    uint32_t                   seed = 0x12345678;
+    uint64_t                   startTime;
+    uint64_t                   elapsed;
+
+    printf("TestTimerSchedulerBenchmark() (%s) ",
+           OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE ? "pairing heap" : "sorted list");
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    sNow                                     = 0U - 100000U;
+    BenchmarkTimer<TimerType>::sLastFireTime = ot::Time(sNow);
+    BenchmarkTimer<TimerType>::sFiredCount   = 0;
+
+    for (BenchmarkTimer<TimerType> *&timer : timers)
+    {
+        timer = new BenchmarkTimer<TimerType>(*instance);
+    }
+
+    startTime = GetMonotonicTimeUsec();
+
+    for (uint32_t op = 0; op < kNumOperations; op++)
+    {
+        BenchmarkTimer<TimerType> *timer;
+
+        seed  = seed * 1103515245 + 12345;
+        timer = timers[(seed >> 8) % kNumTimers];
+
+        switch ((seed >> 4) % 4)
+        {
+        case 0:
+        case 1:
+            timer->Start(1 + (seed >> 16) % kMaxInterval);
+            break;
+
+        case 2:
+            timer->Stop();
+            break;
+
+        case 3:
+            sNow += (seed >> 16) % kMaxTimeStep;
+
+            // Fire all expired timers (while the platform alarm is due).
+
+            while (sTimerOn && (sNow - sPlatT0 >= sPlatDt))
+            {
+                AlarmFired<TimerType>(instance);
+            }
+
+            break;
+        }
+    }
+
+    elapsed = GetMonotonicTimeUsec() - startTime;
+
+    for (BenchmarkTimer<TimerType> *timer : timers)
+    {
+        VerifyOrQuit(!timer->IsRunning() || (timer->GetFireTime() > ot::Time(sNow)), "Benchmark: Timer missed.");
+        timer->Stop();
+        delete timer;
+    }
+
+    VerifyOrQuit(!sTimerOn, "Benchmark: Platform Timer State Failed.");
+
+    printf("%u ops, %u fired, %llu usec --> PASSED\n", kNumOperations, BenchmarkTimer<TimerType>::sFiredCount,
+           static_cast<unsigned long long>(elapsed));
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -685,6 +895,8 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestSameFireTime<TimerType>();
+    TestTimerSchedulerBenchmark<TimerType>();
 }
 
 int main(void)
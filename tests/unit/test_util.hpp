@@ -43,4 +43,14 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * This function returns the current value of a monotonic clock in microseconds.
+ *
+ * It is intended for measuring elapsed time in benchmark tests.
+ *
+ * @returns The current monotonic time in microseconds.
+ *
+ */
+uint64_t GetMonotonicTimeUsec(void);
+
 #endif